@@ -12,6 +12,7 @@ import sys
 from pathlib import Path
 
 # First party libraries
+from hdl_registers.generator.python.accessor import PythonAccessorGenerator
 from hdl_registers.generator.python.python_class import PythonClassGenerator
 from hdl_registers.parser.toml import from_toml
 
@@ -29,6 +30,8 @@ def main(output_folder: Path):
 
     PythonClassGenerator(register_list=register_list, output_folder=output_folder).create()
 
+    PythonAccessorGenerator(register_list=register_list, output_folder=output_folder).create()
+
 
 if __name__ == "__main__":
     main(output_folder=Path(sys.argv[1]))
@@ -0,0 +1,99 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+import sys
+from typing import Optional, Union
+
+# Local folder libraries
+from .constant import Constant
+
+
+class ArrayConstant(Constant):
+    """
+    Represent a constant array, e.g. a lookup table of filter coefficients or calibration values.
+
+    All elements must be of the same type, either integer or floating-point.
+    The element type is given by :attr:`.element_type`.
+    The array is generated with all values set at compile time in C/C++ and VHDL, so that it
+    does not need any initialization at run time.
+    """
+
+    __slots__ = ("name", "description", "_value")
+
+    def __init__(
+        self,
+        name: str,
+        value: Union[list[int], list[float]],
+        description: Optional[str] = None,
+    ):
+        """
+        Arguments:
+            name: The name of the constant.
+            value: The constant value.
+                A non-empty list where the elements are either all ``int`` or all ``float``.
+            description: Textual description for the constant.
+        """
+        self.name = sys.intern(name)
+        self.description = sys.intern("" if description is None else description)
+
+        self._value: Union[list[int], list[float]] = []
+        # Assign self._value via setter
+        self.value = value
+
+    @property
+    def value(self) -> Union[list[int], list[float]]:
+        """
+        Getter for value.
+        """
+        return self._value
+
+    @value.setter
+    def value(self, value: Union[list[int], list[float]]) -> None:
+        """
+        Setter for value that performs sanity checks.
+        """
+        if not isinstance(value, list):
+            raise ValueError(
+                f'Constant "{self.name}" has invalid data type "{type(value)}". Value: "{value}".'
+            )
+
+        if not value:
+            raise ValueError(f'Array constant "{self.name}" must have at least one element.')
+
+        # Note that 'bool' is a sub-type of 'int', hence the exact type comparison.
+        element_types = {type(element) for element in value}
+        if element_types not in [{int}, {float}]:
+            raise ValueError(
+                f'Array constant "{self.name}" must have elements that are either all integer '
+                f'or all float. Value: "{value}".'
+            )
+
+        self._value = list(value)
+
+    @property
+    def element_type(self) -> type:
+        """
+        The type of all the elements, either ``int`` or ``float``.
+        """
+        return type(self._value[0])
+
+    @property
+    def length(self) -> int:
+        """
+        The number of elements in the array.
+        """
+        return len(self._value)
+
+    def __repr__(self) -> str:
+        return f"""{self.__class__.__name__}(\
+name={self.name},\
+value={self.value},\
+description={self.description},\
+)"""
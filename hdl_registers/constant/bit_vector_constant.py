@@ -8,6 +8,7 @@
 # --------------------------------------------------------------------------------------------------
 
 # Standard libraries
+import sys
 from typing import Optional
 
 # Local folder libraries
@@ -15,6 +16,8 @@ from .constant import Constant
 
 
 class BitVectorConstant(Constant):
+    __slots__ = ("name", "description", "_is_hexadecimal_not_binary", "_prefix", "_value")
+
     separator_character = "_"
     allowed_binary_characters = "01" + separator_character
     allowed_hexadecimal_characters = "0123456789abcdefABCDEF" + separator_character
@@ -27,8 +30,8 @@ class BitVectorConstant(Constant):
                 or hexadecimal characters. Underscore may be used as a separator.
             description: Textual description for the constant.
         """
-        self.name = name
-        self.description = "" if description is None else description
+        self.name = sys.intern(name)
+        self.description = sys.intern("" if description is None else description)
 
         # Assigned in 'value' setter.
         self._is_hexadecimal_not_binary = False
@@ -133,3 +136,5 @@ class UnsignedVectorConstant(BitVectorConstant):
     (as opposed to a **plain value** of the same type in Python, which would use the
     :class:`.UnsignedVector` class).
     """
+
+    __slots__ = ()
@@ -8,6 +8,7 @@
 # --------------------------------------------------------------------------------------------------
 
 # Standard libraries
+import sys
 from typing import Optional
 
 # Local folder libraries
@@ -15,6 +16,8 @@ from .constant import Constant
 
 
 class BooleanConstant(Constant):
+    __slots__ = ("name", "description", "_value")
+
     def __init__(self, name: str, value: bool, description: Optional[str] = None):
         """
         Arguments:
@@ -22,8 +25,8 @@ class BooleanConstant(Constant):
             value: The constant value.
             description: Textual description for the constant.
         """
-        self.name = name
-        self.description = "" if description is None else description
+        self.name = sys.intern(name)
+        self.description = sys.intern("" if description is None else description)
 
         self._value = False
         # Assign self._value via setter
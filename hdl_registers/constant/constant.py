@@ -19,6 +19,9 @@ class Constant(ABC):
     Lists a few properties that must be available.
     """
 
+    # Subclasses shall also use slots, to keep the memory footprint of each constant object down.
+    __slots__ = ()
+
     name: str
     description: str
 
@@ -8,6 +8,7 @@
 # --------------------------------------------------------------------------------------------------
 
 # Standard libraries
+import sys
 from typing import Optional
 
 # Local folder libraries
@@ -26,6 +27,8 @@ class FloatConstant(Constant):
       the precision in C/C++/VHDL generators.
     """
 
+    __slots__ = ("name", "description", "_value")
+
     def __init__(self, name: str, value: float, description: Optional[str] = None):
         """
         Arguments:
@@ -33,8 +36,8 @@ class FloatConstant(Constant):
             value: The constant value.
             description: Textual description for the constant.
         """
-        self.name = name
-        self.description = "" if description is None else description
+        self.name = sys.intern(name)
+        self.description = sys.intern("" if description is None else description)
 
         self._value = 0.0
         # Assign self._value via setter
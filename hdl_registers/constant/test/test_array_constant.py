@@ -0,0 +1,72 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+from copy import copy
+
+# Third party libraries
+import pytest
+
+# First party libraries
+from hdl_registers.constant.array_constant import ArrayConstant
+
+
+def test_constant():
+    constant = ArrayConstant(name="apa", value=[1, -2, 3], description="desc")
+
+    assert constant.name == "apa"
+    assert constant.value == [1, -2, 3]
+    assert constant.description == "desc"
+    assert constant.element_type is int
+    assert constant.length == 3
+
+    constant = ArrayConstant(name="apa", value=[0.5])
+    assert constant.element_type is float
+    assert constant.length == 1
+
+
+def test_invalid_data_type():
+    with pytest.raises(ValueError) as exception_info:
+        ArrayConstant(name="apa", value=(1, 2))
+    assert (
+        str(exception_info.value)
+        == 'Constant "apa" has invalid data type "<class \'tuple\'>". Value: "(1, 2)".'
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        ArrayConstant(name="apa", value=[])
+    assert str(exception_info.value) == 'Array constant "apa" must have at least one element.'
+
+    for value in [[1, 2.5], [True, False], ["a"]]:
+        with pytest.raises(ValueError) as exception_info:
+            ArrayConstant(name="apa", value=value)
+        assert str(exception_info.value) == (
+            'Array constant "apa" must have elements that are either all integer or all float. '
+            f'Value: "{value}".'
+        )
+
+
+def test_repr():
+    data = ArrayConstant(name="apa", value=[1, 2])
+
+    # Check that repr is an actual representation, not just "X object at 0xABCDEF"
+    assert "apa" in repr(data)
+    assert repr(data) == repr(copy(data))
+
+    # Different name
+    other = ArrayConstant(name="hest", value=[1, 2])
+    assert repr(data) != repr(other)
+
+    # Different value
+    other = ArrayConstant(name="apa", value=[1, 3])
+    assert repr(data) != repr(other)
+
+    # Different description
+    data = ArrayConstant(name="apa", value=[1, 2], description="X")
+    assert repr(data) != repr(other)
@@ -7,6 +7,9 @@
 # https://github.com/hdl-registers/hdl-registers
 # --------------------------------------------------------------------------------------------------
 
+# Standard libraries
+import sys
+
 # Local folder libraries
 from .register_field import RegisterField
 
@@ -17,6 +20,8 @@ class Bit(RegisterField):
     Used to represent a bit field in a register.
     """
 
+    __slots__ = ("name", "_base_index", "description", "_default_value")
+
     width = 1
 
     def __init__(self, name: str, index: int, description: str, default_value: str):
@@ -27,9 +32,9 @@ class Bit(RegisterField):
             description: Textual bit description.
             default_value: Default value. Either "1" or "0".
         """
-        self.name = name
+        self.name = sys.intern(name)
         self._base_index = index
-        self.description = description
+        self.description = sys.intern(description)
 
         self._default_value = ""
         # Assign self._default_value via setter
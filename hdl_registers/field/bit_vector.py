@@ -7,6 +7,9 @@
 # https://github.com/hdl-registers/hdl-registers
 # --------------------------------------------------------------------------------------------------
 
+# Standard libraries
+import sys
+
 # Local folder libraries
 from .register_field import DEFAULT_FIELD_TYPE, RegisterField
 from .register_field_type import FieldType, Fixed
@@ -18,6 +21,15 @@ class BitVector(RegisterField):
     Used to represent a bit vector field in a register.
     """
 
+    __slots__ = (
+        "name",
+        "_base_index",
+        "description",
+        "_width",
+        "_default_value",
+        "_field_type",
+    )
+
     def __init__(
         self,
         name: str,
@@ -38,9 +50,9 @@ class BitVector(RegisterField):
                 only "1" and "0".
             field_type: The field type used to interpret the bits of the field.
         """
-        self.name = name
+        self.name = sys.intern(name)
         self._base_index = base_index
-        self.description = description
+        self.description = sys.intern(description)
 
         # The width of the field affects the base index of the next fields.
         # Hence the user is not allowed to change it, nor the base index of this field,
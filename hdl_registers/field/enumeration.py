@@ -7,9 +7,17 @@
 # https://github.com/hdl-registers/hdl-registers
 # --------------------------------------------------------------------------------------------------
 
+# Standard libraries
+import sys
+from typing import TYPE_CHECKING, Any
+
 # Local folder libraries
 from .register_field import RegisterField
 
+if TYPE_CHECKING:
+    # Third party libraries
+    import numpy
+
 
 class EnumerationElement:
     """
@@ -26,10 +34,12 @@ class EnumerationElement:
     It is deemed more flexible to use a simple class for now.
     """
 
+    __slots__ = ("_name", "_value", "description")
+
     def __init__(self, name: str, value: int, description: str):
-        self._name = name
+        self._name = sys.intern(name)
         self._value = value
-        self.description = description
+        self.description = sys.intern(description)
 
     @property
     def name(self) -> str:
@@ -66,6 +76,8 @@ class Enumeration(RegisterField):
     Used to represent an enumeration field in a register.
     """
 
+    __slots__ = ("name", "_base_index", "description", "_elements", "_default_value")
+
     def __init__(
         self,
         name: str,
@@ -82,9 +94,9 @@ class Enumeration(RegisterField):
             elements: Dictionary mapping element names to their description.
             default_value: The name of the element that shall be set as default.
         """
-        self.name = name
+        self.name = sys.intern(name)
         self._base_index = base_index
-        self.description = description
+        self.description = sys.intern(description)
 
         # The number of elements affects the width of the field, which affects the base index of the
         # next fields.
@@ -206,6 +218,42 @@ class Enumeration(RegisterField):
     def set_value(self, field_value: EnumerationElement) -> int:  # type: ignore[override]
         return super().set_value(field_value=field_value.value)
 
+    def get_values(self, register_values: Any) -> "numpy.ndarray":
+        """
+        See super method for details.
+        Note that the result is an array of element values (integers),
+        not of :class:`.EnumerationElement` objects.
+        Adds sanity checks that all values correspond to an element.
+        """
+        result = super().get_values(register_values=register_values)
+        self._check_values_are_elements(values=result)
+
+        return result
+
+    def set_values(self, field_values: Any) -> "numpy.ndarray":
+        """
+        See super method for details.
+        Note that the argument shall be an array of element values (integers),
+        not of :class:`.EnumerationElement` objects.
+        Adds sanity checks that all values correspond to an element.
+        """
+        # Third party libraries
+        import numpy  # pylint: disable=import-outside-toplevel
+
+        field_values = numpy.asarray(field_values)
+        self._check_values_are_elements(values=field_values)
+
+        return super().set_values(field_values=field_values)
+
+    def _check_values_are_elements(self, values: "numpy.ndarray") -> None:
+        # Third party libraries
+        import numpy  # pylint: disable=import-outside-toplevel
+
+        is_element = numpy.isin(values, [element.value for element in self._elements])
+        if not is_element.all():
+            # Raises an exception with a descriptive message.
+            self.get_element_by_value(value=values[~is_element][0])
+
     def __repr__(self) -> str:
         return f"""{self.__class__.__name__}(\
 name={self.name},\
@@ -7,10 +7,18 @@
 # https://github.com/hdl-registers/hdl-registers
 # --------------------------------------------------------------------------------------------------
 
+# Standard libraries
+import sys
+from typing import TYPE_CHECKING, Any
+
 # Local folder libraries
 from .register_field import RegisterField
 from .register_field_type import FieldType, Signed, Unsigned
 
+if TYPE_CHECKING:
+    # Third party libraries
+    import numpy
+
 
 class Integer(RegisterField):  # pylint: disable=too-many-instance-attributes
 
@@ -18,6 +26,16 @@ class Integer(RegisterField):  # pylint: disable=too-many-instance-attributes
     Used to represent an integer field in a register.
     """
 
+    __slots__ = (
+        "name",
+        "_base_index",
+        "description",
+        "_min_value",
+        "_max_value",
+        "_default_value",
+        "_field_type",
+    )
+
     def __init__(
         self,
         name: str,
@@ -36,9 +54,9 @@ class Integer(RegisterField):  # pylint: disable=too-many-instance-attributes
             min_value: The maximum value that this field shall be able to represent.
             default_value: Default value. Must be within the specified range.
         """
-        self.name = name
+        self.name = sys.intern(name)
         self._base_index = base_index
-        self.description = description
+        self.description = sys.intern(description)
 
         # These affect the width of the field, and hence the base index of the next fields.
         # Hence the user is not allowed to change them, nor the base index of this field,
@@ -213,6 +231,37 @@ class Integer(RegisterField):  # pylint: disable=too-many-instance-attributes
 
         return super().set_value(field_value=field_value)
 
+    def get_values(self, register_values: Any) -> "numpy.ndarray":
+        """
+        See super method for details.
+        Adds sanity checks of the values.
+        """
+        result = super().get_values(register_values=register_values)
+        self._check_values_in_range(values=result, message="Register field value")
+
+        return result
+
+    def set_values(self, field_values: Any) -> "numpy.ndarray":
+        """
+        See super method for details.
+        Adds sanity checks of the values.
+        """
+        # Third party libraries
+        import numpy  # pylint: disable=import-outside-toplevel
+
+        field_values = numpy.asarray(field_values)
+        self._check_values_in_range(values=field_values, message="Value")
+
+        return super().set_values(field_values=field_values)
+
+    def _check_values_in_range(self, values: "numpy.ndarray", message: str) -> None:
+        out_of_range = (values < self.min_value) | (values > self.max_value)
+        if out_of_range.any():
+            raise ValueError(
+                f'{message} "{values[out_of_range][0]}" not inside "{self.name}" field\'s '
+                f"legal range: ({self.min_value}, {self.max_value})."
+            )
+
     def __repr__(self) -> str:
         return f"""{self.__class__.__name__}(\
 name={self.name},\
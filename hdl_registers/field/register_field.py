@@ -9,11 +9,15 @@
 
 # Standard libraries
 from abc import ABC, abstractmethod
-from typing import Union
+from typing import TYPE_CHECKING, Any, Union
 
 # Local folder libraries
 from .register_field_type import FieldType, Unsigned
 
+if TYPE_CHECKING:
+    # Third party libraries
+    import numpy
+
 DEFAULT_FIELD_TYPE = Unsigned()
 
 
@@ -24,6 +28,10 @@ class RegisterField(ABC):
     Lists a few methods that must be implemented.
     """
 
+    # Subclasses shall also use slots, to keep the memory footprint of each field object down.
+    # There can be millions of field objects in a large register list.
+    __slots__ = ()
+
     # Must set these two as class members in subclasses.
     name: str
     description: str
@@ -146,6 +154,66 @@ class RegisterField(ABC):
 
         return value_shifted & mask
 
+    def get_values(self, register_values: Any) -> "numpy.ndarray":
+        """
+        Get the values of this field, given an array of register values.
+        Same as :meth:`.get_value`, but the masking, shifting, sign extension and fixed-point
+        scaling is done on the whole array at once with vectorized NumPy operations.
+        Use this when decoding large amounts of data, e.g. register captures.
+
+        Requires the ``numpy`` Python package, which is not a dependency of ``hdl_registers``
+        otherwise.
+
+        Arguments:
+            register_values: Values of the register that this field belongs to.
+                A NumPy array or anything that can be converted to one, e.g. a list.
+                For best performance, pass a NumPy array with ``dtype`` ``uint32``, which will not
+                be copied.
+
+        Return:
+            NumPy array with the values of the field.
+            If the field has a non-zero number of fractional bits, the ``dtype`` of the result
+            will be floating point.
+            Otherwise it will be an integer ``dtype``.
+
+            Note that a subclass might implement sanity checks on the values.
+        """
+        # Third party libraries
+        import numpy  # pylint: disable=import-outside-toplevel
+
+        register_values = numpy.asarray(register_values, dtype=numpy.uint32)
+
+        value_unsigned = (register_values >> self.base_index) & ((1 << self.width) - 1)
+        return self.field_type.convert_from_unsigned_binary_array(self.width, value_unsigned)
+
+    def set_values(self, field_values: Any) -> "numpy.ndarray":
+        """
+        Convert an array of field values into the bit-shifted unsigned integers ready
+        to be written to the register.
+        Same as :meth:`.set_value`, but the conversion is done on the whole array at once with
+        vectorized NumPy operations.
+
+        Requires the ``numpy`` Python package, which is not a dependency of ``hdl_registers``
+        otherwise.
+
+        Arguments:
+            field_values: Desired values to set the field to.
+                A NumPy array or anything that can be converted to one, e.g. a list.
+
+        Return:
+            NumPy array, with ``dtype`` ``uint32``, with the register values.
+            The bits of the other fields in the register are set to zero.
+        """
+        # Third party libraries
+        import numpy  # pylint: disable=import-outside-toplevel
+
+        value_unsigned = self.field_type.convert_to_unsigned_binary_array(
+            self.width, numpy.asarray(field_values)
+        )
+
+        result: numpy.ndarray = (value_unsigned << self.base_index).astype(numpy.uint32)
+        return result
+
     @abstractmethod
     def __repr__(self) -> str:
         pass
@@ -45,6 +45,30 @@ def test_get_value():
     assert field.get_value(register_value) == -0.00390625
 
 
+def test_get_values_and_set_values():
+    numpy = pytest.importorskip("numpy")
+
+    field = BitVector(
+        name="",
+        base_index=2,
+        description="",
+        width=16,
+        default_value="0" * 16,
+        field_type=SignedFixedPoint.from_bit_widths(integer_bit_width=8, fraction_bit_width=8),
+    )
+    register_values = [0b11111111_00000011_11111111_11111100, 0b00000000_00000000_00000110_00000011]
+
+    values = field.get_values(register_values)
+    assert values.tolist() == [field.get_value(value) for value in register_values]
+    assert values.tolist() == [-0.00390625, 1.5]
+
+    assert field.set_values(values).dtype == numpy.uint32
+    assert field.set_values(values).tolist() == [field.set_value(value) for value in values]
+
+    with pytest.raises(ValueError):
+        field.set_values([0, 128])
+
+
 def test_max_binary_value():
     bit_vector = BitVector(
         name="", base_index=0, description="", width=2, default_value=format(0, "02b")
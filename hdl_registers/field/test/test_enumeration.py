@@ -230,6 +230,55 @@ def test_set_value():
     assert enumeration.set_value(field_value=enumeration.elements[2]) == 2 << base_index
 
 
+def test_get_values_and_set_values():
+    numpy = pytest.importorskip("numpy")
+
+    base_index = 3
+
+    enumeration = Enumeration(
+        name="apa",
+        base_index=base_index,
+        description="",
+        elements={
+            "element0": "",
+            "element1": "",
+            "element2": "",
+        },
+        default_value="element0",
+    )
+
+    # Ones outside of this field. Should be masked out when getting value.
+    register_base_value = 0b1110_0111
+    register_values = [
+        register_base_value + (2 << base_index),
+        register_base_value,
+        register_base_value + (1 << base_index),
+    ]
+
+    values = enumeration.get_values(register_values=register_values)
+    assert values.tolist() == [2, 0, 1]
+
+    assert enumeration.set_values(field_values=values).tolist() == [
+        2 << base_index,
+        0,
+        1 << base_index,
+    ]
+
+    with pytest.raises(ValueError) as exception_info:
+        enumeration.get_values(register_values=register_values + [3 << base_index])
+    assert (
+        str(exception_info.value)
+        == 'Enumeration "apa", requested element value does not exist. Got: "3".'
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        enumeration.set_values(field_values=numpy.array([0, 3]))
+    assert (
+        str(exception_info.value)
+        == 'Enumeration "apa", requested element value does not exist. Got: "3".'
+    )
+
+
 def test_repr():
     enumeration = Enumeration(
         name="apa",
@@ -248,6 +248,39 @@ def test_set_value_should_raise_exception_if_value_out_of_range():
     assert str(exception_info.value) == 'Value "-8" not inside "apa" field\'s legal range: (-1, 7).'
 
 
+def test_get_values_and_set_values():
+    numpy = pytest.importorskip("numpy")
+
+    integer = Integer(
+        name="apa", base_index=3, min_value=-100, max_value=127, description="", default_value=0
+    )
+
+    register_values = numpy.array(
+        [int("10101010111", base=2), int("01010101000", base=2)], dtype=numpy.uint32
+    )
+    values = integer.get_values(register_values)
+    assert values.tolist() == [-86, 85]
+
+    assert integer.set_values(values).tolist() == [
+        int("10101010000", base=2),
+        int("01010101000", base=2),
+    ]
+
+    with pytest.raises(ValueError) as exception_info:
+        integer.get_values([0, int("10000000000", base=2)])
+    assert (
+        str(exception_info.value)
+        == 'Register field value "-128" not inside "apa" field\'s legal range: (-100, 127).'
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        integer.set_values([0, 3, -101])
+    assert (
+        str(exception_info.value)
+        == 'Value "-101" not inside "apa" field\'s legal range: (-100, 127).'
+    )
+
+
 def test_default_value_uint():
     def _get_default_value_uint(min_value, max_value, default_value):
         return Integer(
@@ -220,3 +220,56 @@ def test_repr():
     assert repr(ufixed0) == repr(ufixed1) != repr(ufixed2)
     assert repr(sfixed0) == repr(sfixed1) != repr(sfixed2)
     assert repr(ufixed0) != repr(sfixed0) != repr(ufixed0) != repr(sfixed0)
+
+
+@pytest.mark.parametrize(
+    "field_type, bit_width",
+    [
+        (Unsigned(), 8),
+        (Unsigned(), 32),
+        (Signed(), 2),
+        (Signed(), 8),
+        (Signed(), 32),
+        (UnsignedFixedPoint(max_bit_index=-1, min_bit_index=-2), 2),
+        (UnsignedFixedPoint(max_bit_index=5, min_bit_index=-2), 8),
+        (UnsignedFixedPoint(max_bit_index=9, min_bit_index=8), 2),
+        (SignedFixedPoint(max_bit_index=-1, min_bit_index=-2), 2),
+        (SignedFixedPoint(max_bit_index=5, min_bit_index=-2), 8),
+        (SignedFixedPoint(max_bit_index=9, min_bit_index=8), 2),
+    ],
+)
+def test_array_conversion_matches_scalar_conversion(field_type: FieldType, bit_width: int):
+    numpy = pytest.importorskip("numpy")
+
+    unsigned = [0, 1, 2**bit_width - 1, 2 ** (bit_width - 1), 2 ** (bit_width - 1) - 1]
+    unsigned += list(range(min(2**bit_width, 300)))
+
+    restored = field_type.convert_from_unsigned_binary_array(
+        bit_width, numpy.array(unsigned, dtype=numpy.uint32)
+    )
+    expected = [field_type.convert_from_unsigned_binary(bit_width, value) for value in unsigned]
+    assert restored.tolist() == expected
+
+    assert field_type.convert_to_unsigned_binary_array(bit_width, restored).tolist() == unsigned
+
+
+@pytest.mark.parametrize(
+    "field_type, bit_width",
+    [
+        (Unsigned(), 8),
+        (Signed(), 8),
+        (UnsignedFixedPoint(max_bit_index=5, min_bit_index=-2), 8),
+        (SignedFixedPoint(max_bit_index=5, min_bit_index=-2), 8),
+    ],
+)
+def test_array_out_of_range(field_type: FieldType, bit_width: int):
+    numpy = pytest.importorskip("numpy")
+
+    value = field_type.min_value(bit_width) - 0.00001
+    with pytest.raises(ValueError) as exception_info:
+        field_type.convert_to_unsigned_binary_array(bit_width, numpy.array([0, value, 0]))
+    assert str(exception_info.value).startswith(f"Value: {value} out of range of 8-bit")
+
+    value = field_type.max_value(bit_width) + 0.00001
+    with pytest.raises(ValueError):
+        field_type.convert_to_unsigned_binary_array(bit_width, numpy.array([value]))
@@ -12,6 +12,7 @@ from pathlib import Path
 from typing import TYPE_CHECKING, Any, Optional
 
 # First party libraries
+from hdl_registers.constant.array_constant import ArrayConstant
 from hdl_registers.constant.bit_vector_constant import UnsignedVectorConstant
 from hdl_registers.constant.boolean_constant import BooleanConstant
 from hdl_registers.constant.float_constant import FloatConstant
@@ -19,12 +20,14 @@ from hdl_registers.constant.integer_constant import IntegerConstant
 from hdl_registers.constant.string_constant import StringConstant
 from hdl_registers.field.enumeration import Enumeration
 from hdl_registers.generator.register_code_generator import RegisterCodeGenerator
+from hdl_registers.programming_sequence import SequenceOpcode
 from hdl_registers.register import REGISTER_MODES, Register
 from hdl_registers.register_list import RegisterList
 
 if TYPE_CHECKING:
     # First party libraries
     from hdl_registers.register_array import RegisterArray
+    from hdl_registers.register_pair import RegisterPair
 
 # There is no unit test of this class that checks the generated code. It is instead functionally
 # tested in the file 'test_compiled_c_code.py'. That test generates C code from an example
@@ -46,12 +49,24 @@ class CHeaderGenerator(RegisterCodeGenerator):
     * A ``struct`` type with all registers as members, which can be memory mapped directly.
 
     * For each register, ``#define`` constants with the index and address of the register.
+      The comment of a static register says that its value can be cached.
+
+    * For each commit register of double-buffered registers, a ``#define`` macro that writes
+      the commit register.
 
     * For each field in each register, ``#define`` constants with the bit shift, bit mask and
       inverse bit mask of the field.
+
+    * For each register pair, ``#define`` constants with the index and address of the pair,
+      and functions that read or write the pair as one 64-bit value.
+      With ``FPGA_REGS_DATA_WIDTH`` defined to 64 when compiling, for a 64-bit register bus,
+      the pair is accessed with one single 64-bit load or store.
+
+    * For each programming sequence, a table of compiled entries.
+      As well as a function that runs such a table on the registers.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "1.7.0"
 
     SHORT_DESCRIPTION = "C header"
 
@@ -93,10 +108,12 @@ class CHeaderGenerator(RegisterCodeGenerator):
 #ifndef {define_name}
 #define {define_name}
 
+{self._data_width()}\
 {self._constants()}
 {self._number_of_registers()}
 {self._register_struct()}
 {self._register_defines()}\
+{self._programming_sequences()}\
 #endif {self.comment(define_name)}"""
 
         return c_code
@@ -130,8 +147,29 @@ class CHeaderGenerator(RegisterCodeGenerator):
                         f"Mode '{REGISTER_MODES[register.mode].mode_readable}'.", indent=2
                     )
                     array_structs += f"  uint32_t {register.name};\n"
+
+                num_padding = register_object.stride - len(register_object.registers)
+                if num_padding:
+                    array_structs += self.comment(
+                        f"Padding to a stride of {register_object.stride} registers. "
+                        f"In total {register_object.num_padding_registers} unused registers.",
+                        indent=2,
+                    )
+                    array_structs += f"  uint32_t _padding[{num_padding}];\n"
+
                 array_structs += f"}} {array_struct_type};\n\n"
 
+                if register_object.num_alignment_registers:
+                    register_struct += self.comment(
+                        f"Unused registers that align the '{register_object.name}' array to its "
+                        "stride.",
+                        indent=2,
+                    )
+                    register_struct += (
+                        f"  uint32_t _{register_object.name}_alignment"
+                        f"[{register_object.num_alignment_registers}];\n"
+                    )
+
                 register_struct += (
                     f"  {array_struct_type} {register_object.name}[{register_object.length}];\n"
                 )
@@ -155,9 +193,203 @@ class CHeaderGenerator(RegisterCodeGenerator):
         c_code = ""
         for register, register_array in self.iterate_registers():
             c_code += self._addr_define(register, register_array)
+            c_code += self._commit_define(register)
             c_code += self._field_definitions(register, register_array)
             c_code += "\n"
 
+        for register_pair, low, high in self.iterate_register_pairs():
+            c_code += self._register_pair_defines(register_pair=register_pair, low=low, high=high)
+            c_code += "\n"
+
+        return c_code
+
+    def _data_width(self) -> str:
+        """
+        Data width of the register bus, that decides how register pairs are accessed.
+        Guarded so that it is defined only once, even if many headers are included.
+        """
+        if not self.register_list.register_pairs:
+            return ""
+
+        return """\
+// Data width of the register bus, 32 or 64.
+// With 64, each register pair is read or written with one single 64-bit access, which is atomic.
+// The base address of the register map must then be eight-byte aligned.
+// Can be overridden by defining the macro before including this header.
+#ifndef FPGA_REGS_DATA_WIDTH
+#define FPGA_REGS_DATA_WIDTH 32
+#endif
+
+// The register with the lower address is in bits 31:0 of a 64-bit bus word.
+#if FPGA_REGS_DATA_WIDTH == 64 && defined(__BYTE_ORDER__)
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "A 64-bit register bus is supported on little-endian hosts only."
+#endif
+#endif
+
+"""
+
+    def _register_pair_defines(
+        self, register_pair: "RegisterPair", low: Register, high: Register
+    ) -> str:
+        name = self._format_qualified_register_name(
+            array_name=None, register_name=register_pair.name
+        ).upper()
+
+        c_code = self.comment_block(
+            f"Address of the '{register_pair.name}' register pair.\n"
+            f"Bits 31:0 are the '{low.name}' register and bits 63:32 are the '{high.name}' "
+            "register."
+        )
+        c_code += f"#define {name}_INDEX ({low.index}u)\n"
+        c_code += f"#define {name}_ADDR (4u * {name}_INDEX)\n"
+
+        function_name = name.lower()
+        regs_type = f"{self.name}_regs_t"
+
+        if low.is_bus_readable and high.is_bus_readable:
+            c_code += self.comment_block(
+                f"Read the '{low.name}' register and the '{high.name}' register, "
+                "and return them as one 64-bit value.\n"
+                "With a 64-bit register bus, the two registers are read in one bus transaction, "
+                "so the value is read atomically.\n"
+                f"Otherwise, '{low.name}' is read first and '{high.name}' after it, in two "
+                "separate bus transactions, so the value is not read atomically."
+            )
+            c_code += f"""\
+static inline uint64_t {function_name}_get(const volatile {regs_type} *registers)
+{{
+#if FPGA_REGS_DATA_WIDTH == 64
+  return *(const volatile uint64_t *)((const volatile uint8_t *)registers + {name}_ADDR);
+#else
+  const uint64_t low = registers->{low.name};
+  const uint64_t high = registers->{high.name};
+  return (high << 32) | low;
+#endif
+}}
+"""
+
+        if low.is_bus_writeable and high.is_bus_writeable:
+            c_code += self.comment_block(
+                f"Write bits 31:0 of the value to the '{low.name}' register, and bits 63:32 "
+                f"to the '{high.name}' register.\n"
+                "With a 64-bit register bus, the two registers are written in one bus "
+                "transaction, so the value is written atomically.\n"
+                f"Otherwise, '{low.name}' is written first and '{high.name}' after it, in two "
+                "separate bus transactions, so the value is not written atomically."
+            )
+            c_code += f"""\
+static inline void {function_name}_set(volatile {regs_type} *registers, uint64_t value)
+{{
+#if FPGA_REGS_DATA_WIDTH == 64
+  *(volatile uint64_t *)((volatile uint8_t *)registers + {name}_ADDR) = value;
+#else
+  registers->{low.name} = (uint32_t)value;
+  registers->{high.name} = (uint32_t)(value >> 32);
+#endif
+}}
+"""
+
+        return c_code
+
+    def _programming_sequences(self) -> str:
+        """
+        Tables of the compiled programming sequences, and an interpreter that runs them.
+        """
+        if not self.register_list.programming_sequences:
+            return ""
+
+        prefix = self.name.upper()
+        entry_type = f"{self.name}_sequence_entry_t"
+
+        c_code = self.comment("Operations of the entries in a programming sequence table.")
+        for opcode in SequenceOpcode:
+            c_code += f"#define {prefix}_SEQUENCE_{opcode.name} ({opcode.value}u)\n"
+
+        c_code += f"""
+{self.comment("One entry in a programming sequence table.")}\
+typedef struct {entry_type}
+{{
+{self.comment(f"One of the '{prefix}_SEQUENCE_*' operations.", indent=2)}\
+  uint32_t opcode;
+{self.comment("Byte address of the register, relative to the register map.", indent=2)}\
+  uint32_t address;
+  uint32_t mask;
+  uint32_t value;
+}} {entry_type};
+
+"""
+
+        for programming_sequence, entries in self.iterate_programming_sequences():
+            name = f"{prefix}_{programming_sequence.name.upper()}_SEQUENCE"
+
+            c_code += self.get_separator_line()
+            c_code += self.comment(f"Programming sequence '{programming_sequence.name}'.")
+            c_code += self.comment_block(programming_sequence.description)
+            c_code += f"#define {name}_LENGTH ({len(entries)}u)\n"
+            c_code += f"static const {entry_type} {name}[{len(entries)}] = {{\n"
+            for entry in entries:
+                c_code += self.comment(entry.comment, indent=2)
+                c_code += (
+                    f"  {{{prefix}_SEQUENCE_{entry.opcode.name}, 0x{entry.address:X}u, "
+                    f"0x{entry.mask:X}u, 0x{entry.value:X}u}},\n"
+                )
+            c_code += "};\n\n"
+
+        c_code += self.get_separator_line()
+        c_code += self.comment_block(
+            "Run a programming sequence table on the registers.\n"
+            f"Argument 'registers' is a pointer to the '{self.name}_regs_t' register struct, "
+            "casted to 'volatile uint32_t *'.\n"
+            "Function 'delay_us' is called for each delay entry.\n"
+            "Argument 'max_polls' is the maximum number of reads for each wait entry, "
+            "or zero for no limit.\n"
+            "Returns zero when done, or non-zero if a wait entry reached 'max_polls'."
+        )
+        c_code += f"""\
+static inline int {self.name}_run_sequence(
+  volatile uint32_t *registers,
+  const {entry_type} *entries,
+  uint32_t num_entries,
+  void (*delay_us)(uint32_t),
+  uint32_t max_polls)
+{{
+  for (uint32_t entry_index = 0; entry_index < num_entries; entry_index++)
+  {{
+    const {entry_type} *entry = &entries[entry_index];
+    volatile uint32_t *reg = &registers[entry->address / 4u];
+
+    switch (entry->opcode)
+    {{
+      case {prefix}_SEQUENCE_WRITE:
+        *reg = entry->value;
+        break;
+
+      case {prefix}_SEQUENCE_MODIFY:
+        *reg = (*reg & ~entry->mask) | entry->value;
+        break;
+
+      case {prefix}_SEQUENCE_WAIT:
+        for (uint32_t num_polls = 1; (*reg & entry->mask) != entry->value; num_polls++)
+        {{
+          if (max_polls != 0u && num_polls >= max_polls)
+          {{
+            return 1;
+          }}
+        }}
+        break;
+
+      case {prefix}_SEQUENCE_DELAY:
+        delay_us(entry->value);
+        break;
+    }}
+  }}
+
+  return 0;
+}}
+
+"""
+
         return c_code
 
     def _addr_define(self, register: Register, register_array: Optional["RegisterArray"]) -> str:
@@ -173,13 +405,18 @@ class CHeaderGenerator(RegisterCodeGenerator):
         if register_array:
             comment += f" (array_index < {register_array.length})"
         comment += f".\nMode '{REGISTER_MODES[register.mode].mode_readable}'."
+        if register.static:
+            comment += (
+                "\nStatic, i.e. the value does not change after reset. "
+                "Can be read once and cached by software."
+            )
 
         c_code = self.comment_block(comment)
 
         if register_array:
             c_code += (
                 f"#define {name}_INDEX(array_index) ({register_array.base_index}u + "
-                f"(array_index) * {len(register_array.registers)}u + {register.index}u)\n"
+                f"(array_index) * {register_array.stride}u + {register.index}u)\n"
             )
             c_code += f"#define {name}_ADDR(array_index) (4u * {name}_INDEX(array_index))\n"
         else:
@@ -188,6 +425,24 @@ class CHeaderGenerator(RegisterCodeGenerator):
 
         return c_code
 
+    def _commit_define(self, register: Register) -> str:
+        if not register.commits:
+            return ""
+
+        name = self.qualified_register_name(register=register).upper()
+        committed = ", ".join(f"'{committed}'" for committed in register.commits)
+
+        c_code = self.comment_block(
+            f"Commit the double-buffered {committed} to fabric, all at the same time.\n"
+            f"Argument is a pointer to the '{self.name}_regs_t' register struct."
+        )
+        c_code += (
+            f"#define {name}_COMMIT(registers) "
+            f"((registers)->{register.name} = {register.default_value}u)\n"
+        )
+
+        return c_code
+
     def _field_definitions(
         self, register: Register, register_array: Optional["RegisterArray"]
     ) -> str:
@@ -254,6 +509,16 @@ enum {self.to_pascal_case(name)}
                 # "unsigned" and "long" as suffix.
                 # Makes it possible to use large numbers for e.g. base addresses.
                 value = f"{constant.prefix}{constant.value_without_separator}UL"
+            elif isinstance(constant, ArrayConstant):
+                # Element types match the scalar integer and float constants above.
+                # "static" for the same reason as the string constant above.
+                element_type = "double" if constant.element_type is float else "int"
+                elements = ", ".join(str(element) for element in constant.value)
+                declaration = (
+                    f"#define {constant_name}_LENGTH ({constant.length}u)\n"
+                    f"static const {element_type} {constant_name}[{constant.length}] = "
+                    f"{{{elements}}};"
+                )
             else:
                 raise ValueError(f"Got unexpected constant type. {constant}")
 
@@ -0,0 +1,397 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+from pathlib import Path
+from typing import Any
+
+# First party libraries
+from hdl_registers.generator.register_code_generator import RegisterCodeGenerator
+from hdl_registers.generator.register_map_rom import (
+    BIT_VECTOR_SIGNED,
+    BIT_VECTOR_SIGNED_FIXED_POINT,
+    BIT_VECTOR_UNSIGNED,
+    BIT_VECTOR_UNSIGNED_FIXED_POINT,
+    ELEMENT_ENTRY_LENGTH,
+    FIELD_ENTRY_LENGTH,
+    FIELD_TYPE_BIT,
+    FIELD_TYPE_BIT_VECTOR,
+    FIELD_TYPE_ENUMERATION,
+    FIELD_TYPE_INTEGER,
+    HASH_LENGTH,
+    HEADER_ELEMENTS_OFFSET,
+    HEADER_FIELDS_OFFSET,
+    HEADER_HASH,
+    HEADER_LENGTH,
+    HEADER_MAGIC,
+    HEADER_NUM_ELEMENTS,
+    HEADER_NUM_FIELDS,
+    HEADER_NUM_REGISTERS,
+    HEADER_NUM_WORDS,
+    HEADER_REGISTERS_OFFSET,
+    HEADER_STRINGS_OFFSET,
+    HEADER_STRINGS_SIZE,
+    HEADER_VERSION,
+    MAGIC,
+    MODE_CODES,
+    REGISTER_ENTRY_LENGTH,
+    VERSION,
+    RegisterMapRom,
+)
+
+# There is no unit test of this class that checks the generated code. It is instead functionally
+# tested in the file 'test_compiled_c_code.py', where the ROM content is decoded in a C program.
+
+
+class CRegisterMapRomGenerator(RegisterCodeGenerator):
+    """
+    Generate a C header with functions that decode and validate the content of the register map ROM.
+    See the :ref:`generator_register_map_rom` article for usage details.
+
+    The header will contain:
+
+    * The expected hash and length of the ROM content.
+
+    * A function that checks that a ROM, read from the FPGA, is valid and describes the same
+      register map as the one that the header was generated from.
+
+    * Functions that look up registers, fields and enumeration elements in the ROM.
+
+    The header can be used from both C and C++.
+    """
+
+    __version__ = "1.0.0"
+
+    SHORT_DESCRIPTION = "C register map ROM decoder"
+
+    COMMENT_START = "//"
+
+    @property
+    def output_file(self) -> Path:
+        """
+        Result will be placed in this file.
+        """
+        return self.output_folder / f"{self.name}_register_map_rom.h"
+
+    def get_code(self, **kwargs: Any) -> str:
+        """
+        Get a complete C header with the ROM decoder.
+        """
+        rom = RegisterMapRom(register_list=self.register_list)
+        words = rom.get_words()
+
+        define_name = f"{self.name.upper()}_REGISTER_MAP_ROM_H"
+
+        c_code = f"""\
+{self.header}
+#ifndef {define_name}
+#define {define_name}
+
+#include <stdint.h>
+#include <string.h>
+
+{self._constants(words=words)}
+{self._types()}
+{self._check_function()}
+{self._access_functions()}
+#endif {self.comment(define_name)}"""
+
+        return c_code
+
+    def _constants(self, words: list[int]) -> str:
+        prefix = f"{self.name.upper()}_REGISTER_MAP_ROM"
+        hash_words = ", ".join(
+            f"0x{word:08X}u" for word in words[HEADER_HASH : HEADER_HASH + HASH_LENGTH]
+        )
+
+        c_code = self.comment("Identifies the content of a register map ROM, and its layout.")
+        c_code += f"#define {prefix}_MAGIC (0x{MAGIC:08X}u)\n"
+        c_code += f"#define {prefix}_VERSION ({VERSION}u)\n\n"
+
+        c_code += self.comment("Number of 32-bit words in the ROM of this register map.")
+        c_code += f"#define {prefix}_NUM_WORDS ({words[HEADER_NUM_WORDS]}u)\n\n"
+
+        c_code += self.comment_block(
+            "The 'object_hash' of the register list that this header was generated from.\n"
+            "A ROM with the same hash describes the same register map."
+        )
+        c_code += f"static const uint32_t {prefix}_HASH[{HASH_LENGTH}] = {{{hash_words}}};\n\n"
+
+        c_code += self.comment("Codes for the mode of a register.")
+        for mode, code in MODE_CODES.items():
+            c_code += f"#define {prefix}_MODE_{mode.upper()} ({code}u)\n"
+
+        c_code += "\n" + self.comment("Codes for the type of a field.")
+        for type_name, code in [
+            ("BIT", FIELD_TYPE_BIT),
+            ("BIT_VECTOR", FIELD_TYPE_BIT_VECTOR),
+            ("ENUMERATION", FIELD_TYPE_ENUMERATION),
+            ("INTEGER", FIELD_TYPE_INTEGER),
+        ]:
+            c_code += f"#define {prefix}_FIELD_TYPE_{type_name} ({code}u)\n"
+
+        c_code += "\n" + self.comment("Codes for the interpretation of the bits of a bit vector.")
+        for type_name, code in [
+            ("UNSIGNED", BIT_VECTOR_UNSIGNED),
+            ("SIGNED", BIT_VECTOR_SIGNED),
+            ("UNSIGNED_FIXED_POINT", BIT_VECTOR_UNSIGNED_FIXED_POINT),
+            ("SIGNED_FIXED_POINT", BIT_VECTOR_SIGNED_FIXED_POINT),
+        ]:
+            c_code += f"#define {prefix}_BIT_VECTOR_{type_name} ({code}u)\n"
+
+        c_code += "\n" + self.comment(f"Return values of '{self.name}_register_map_rom_check'.")
+        c_code += f"#define {prefix}_OK (0)\n"
+        c_code += f"#define {prefix}_INVALID (1)\n"
+        c_code += f"#define {prefix}_HASH_MISMATCH (2)\n"
+
+        return c_code
+
+    def _types(self) -> str:
+        prefix = f"{self.name.upper()}_REGISTER_MAP_ROM"
+        register_type = f"{self.name}_register_map_rom_register_t"
+        field_type = f"{self.name}_register_map_rom_field_t"
+
+        index_comment = self.comment_block(
+            "Index of the register.\n"
+            "For a register in an array, the index of the register in the first array element.",
+            indent=2,
+        )
+        data_comment = self.comment_block(
+            "For an enumeration: The index of the first element, and the number of elements.\n"
+            "For an integer: The minimum and maximum value, in two's complement.\n"
+            f"For a bit vector: One of the '{prefix}_BIT_VECTOR_*' codes,\n"
+            "and the number of fractional bits.",
+            indent=2,
+        )
+
+        return f"""\
+{self.comment("A register, as described by the ROM.")}\
+typedef struct {register_type}
+{{
+{index_comment}\
+  uint32_t index;
+{self.comment(f"One of the '{prefix}_MODE_*' codes.", indent=2)}\
+  uint32_t mode;
+  uint32_t num_fields;
+{self.comment("Index of the first field of the register, in the field table.", indent=2)}\
+  uint32_t first_field;
+  uint32_t default_value;
+  const char *name;
+{self.comment("Empty string if the register is not in an array.", indent=2)}\
+  const char *array_name;
+{self.comment("Zero if the register is not in an array.", indent=2)}\
+  uint32_t array_length;
+{self.comment("Number of registers between two elements of the array.", indent=2)}\
+  uint32_t array_stride;
+}} {register_type};
+
+{self.comment("A field, as described by the ROM.")}\
+typedef struct {field_type}
+{{
+  uint32_t base_index;
+  uint32_t width;
+{self.comment(f"One of the '{prefix}_FIELD_TYPE_*' codes.", indent=2)}\
+  uint32_t type;
+  const char *name;
+{data_comment}\
+  uint32_t data[2];
+}} {field_type};
+"""
+
+    def _check_function(self) -> str:
+        prefix = f"{self.name.upper()}_REGISTER_MAP_ROM"
+
+        description = self.comment_block(
+            "Check that the ROM content is valid,\n"
+            "and that it describes the same register map as this header.\n"
+            "Argument 'rom' points to the ROM content, read from the FPGA into memory.\n"
+            "Argument 'num_words' is the number of words that were read.\n"
+            "Strings are packed little-endian, so the decoder assumes a little-endian host.\n"
+            f"Returns '{prefix}_OK' if the ROM is valid and describes this register map.\n"
+            f"Returns '{prefix}_INVALID' if the ROM is malformed.\n"
+            f"Returns '{prefix}_HASH_MISMATCH' if the ROM describes another register map."
+        )
+        null_character = "'\\0'"
+
+        table_checks = ""
+        for offset, num_entries, entry_length in [
+            (HEADER_REGISTERS_OFFSET, HEADER_NUM_REGISTERS, REGISTER_ENTRY_LENGTH),
+            (HEADER_FIELDS_OFFSET, HEADER_NUM_FIELDS, FIELD_ENTRY_LENGTH),
+            (HEADER_ELEMENTS_OFFSET, HEADER_NUM_ELEMENTS, ELEMENT_ENTRY_LENGTH),
+        ]:
+            table_checks += (
+                f"(uint64_t)rom[{offset}] + (uint64_t)rom[{num_entries}] * {entry_length}u "
+                "> rom_length\n      || "
+            )
+        table_checks = table_checks.removesuffix("\n      || ")
+
+        return f"""\
+{description}\
+static inline int {self.name}_register_map_rom_check(const uint32_t *rom, uint32_t num_words)
+{{
+  if (num_words < {HEADER_LENGTH}u
+      || rom[{HEADER_MAGIC}] != {prefix}_MAGIC
+      || rom[{HEADER_VERSION}] != {prefix}_VERSION
+      || rom[{HEADER_NUM_WORDS}] > num_words)
+  {{
+    return {prefix}_INVALID;
+  }}
+
+  {self.comment("All tables must be within the ROM.")}\
+  const uint64_t rom_length = rom[{HEADER_NUM_WORDS}];
+  const uint64_t strings_size = rom[{HEADER_STRINGS_SIZE}];
+  if ({table_checks}
+      || (uint64_t)rom[{HEADER_STRINGS_OFFSET}] * 4u + strings_size > rom_length * 4u
+      || strings_size == 0u)
+  {{
+    return {prefix}_INVALID;
+  }}
+
+  {self.comment("The last string must be terminated, so that no string lookup can overrun.")}\
+  const char *strings = (const char *)&rom[rom[{HEADER_STRINGS_OFFSET}]];
+  if (strings[strings_size - 1u] != {null_character})
+  {{
+    return {prefix}_INVALID;
+  }}
+
+  for (uint32_t hash_index = 0; hash_index < {HASH_LENGTH}u; hash_index++)
+  {{
+    if (rom[{HEADER_HASH}u + hash_index] != {prefix}_HASH[hash_index])
+    {{
+      return {prefix}_HASH_MISMATCH;
+    }}
+  }}
+
+  return {prefix}_OK;
+}}
+"""
+
+    def _access_functions(self) -> str:
+        register_type = f"{self.name}_register_map_rom_register_t"
+        field_type = f"{self.name}_register_map_rom_field_t"
+        function = f"{self.name}_register_map_rom"
+
+        registers_offset = f"rom[{HEADER_REGISTERS_OFFSET}]"
+        fields_offset = f"rom[{HEADER_FIELDS_OFFSET}]"
+        elements_offset = f"rom[{HEADER_ELEMENTS_OFFSET}]"
+
+        precondition = self.comment_block(
+            "The functions below shall only be called with a ROM that has passed the check above,\n"
+            "and with indexes that are less than the corresponding count."
+        )
+        find_register_description = self.comment_block(
+            "Find a register by name.\n"
+            "Argument 'array_name' is the name of the register array, or NULL for a plain "
+            "register.\n"
+            "Returns the index of the register in the register table, or -1 if it is not found."
+        )
+        find_field_description = self.comment_block(
+            "Find a field by name, within the given register.\n"
+            "Returns the index of the field in the field table, or -1 if it is not found."
+        )
+
+        return f"""\
+{precondition}\
+static inline uint32_t {function}_num_registers(const uint32_t *rom)
+{{
+  return rom[{HEADER_NUM_REGISTERS}];
+}}
+
+{self.comment("Get the string at the given byte offset in the string table.")}\
+static inline const char *{function}_string(const uint32_t *rom, uint32_t offset)
+{{
+  if (offset >= rom[{HEADER_STRINGS_SIZE}])
+  {{
+    return "";
+  }}
+
+  return (const char *)&rom[rom[{HEADER_STRINGS_OFFSET}]] + offset;
+}}
+
+static inline void {function}_get_register(
+  const uint32_t *rom, uint32_t register_index, {register_type} *result)
+{{
+  const uint32_t *entry = &rom[{registers_offset} + register_index * {REGISTER_ENTRY_LENGTH}u];
+
+  result->index = entry[0];
+  result->mode = entry[1] & 0xFFu;
+  result->num_fields = (entry[1] >> 8u) & 0xFFu;
+  result->array_stride = entry[1] >> 16u;
+  result->array_length = entry[2];
+  result->name = {function}_string(rom, entry[3]);
+  result->array_name = {function}_string(rom, entry[4]);
+  result->first_field = entry[5];
+  result->default_value = entry[6];
+}}
+
+static inline void {function}_get_field(
+  const uint32_t *rom, uint32_t field_index, {field_type} *result)
+{{
+  const uint32_t *entry = &rom[{fields_offset} + field_index * {FIELD_ENTRY_LENGTH}u];
+
+  result->base_index = entry[0] & 0xFFu;
+  result->width = (entry[0] >> 8u) & 0xFFu;
+  result->type = (entry[0] >> 16u) & 0xFFu;
+  result->name = {function}_string(rom, entry[1]);
+  result->data[0] = entry[2];
+  result->data[1] = entry[3];
+}}
+
+{self.comment("The value of an enumeration element is its position in the enumeration.")}\
+static inline const char *{function}_get_element_name(
+  const uint32_t *rom, uint32_t element_index)
+{{
+  const uint32_t *entry = &rom[{elements_offset} + element_index * {ELEMENT_ENTRY_LENGTH}u];
+
+  return {function}_string(rom, entry[0]);
+}}
+
+{find_register_description}\
+static inline int32_t {function}_find_register(
+  const uint32_t *rom, const char *name, const char *array_name)
+{{
+  {register_type} reg;
+
+  for (uint32_t register_index = 0;
+       register_index < {function}_num_registers(rom);
+       register_index++)
+  {{
+    {function}_get_register(rom, register_index, &reg);
+
+    if (strcmp(reg.name, name) == 0
+        && strcmp(reg.array_name, array_name == NULL ? "" : array_name) == 0)
+    {{
+      return (int32_t)register_index;
+    }}
+  }}
+
+  return -1;
+}}
+
+{find_field_description}\
+static inline int32_t {function}_find_field(
+  const uint32_t *rom, const {register_type} *reg, const char *name)
+{{
+  {field_type} field;
+
+  for (uint32_t field_index = reg->first_field;
+       field_index < reg->first_field + reg->num_fields;
+       field_index++)
+  {{
+    {function}_get_field(rom, field_index, &field);
+
+    if (strcmp(field.name, name) == 0)
+    {{
+      return (int32_t)field_index;
+    }}
+  }}
+
+  return -1;
+}}
+"""
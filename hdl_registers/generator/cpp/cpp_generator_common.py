@@ -22,6 +22,7 @@ if TYPE_CHECKING:
     from hdl_registers.field.register_field import RegisterField
     from hdl_registers.register import Register
     from hdl_registers.register_array import RegisterArray
+    from hdl_registers.register_pair import RegisterPair
 
 
 class CppGeneratorCommon(RegisterCodeGenerator):
@@ -82,7 +83,7 @@ class CppGeneratorCommon(RegisterCodeGenerator):
 
     @staticmethod
     def _register_getter_function_name(
-        register: "Register", register_array: Optional["RegisterArray"]
+        register: "Register", register_array: Optional["RegisterArray"], ordered: bool = False
     ) -> str:
         result = "get"
 
@@ -91,6 +92,9 @@ class CppGeneratorCommon(RegisterCodeGenerator):
 
         result += f"_{register.name}"
 
+        if ordered:
+            result += "_ordered"
+
         return result
 
     def _register_getter_function_signature(
@@ -98,9 +102,10 @@ class CppGeneratorCommon(RegisterCodeGenerator):
         register: "Register",
         register_array: Optional["RegisterArray"],
         indent: Optional[int] = None,
+        ordered: bool = False,
     ) -> str:
         function_name = self._register_getter_function_name(
-            register=register, register_array=register_array
+            register=register, register_array=register_array, ordered=ordered
         )
         result = f"{function_name}("
 
@@ -160,7 +165,7 @@ class CppGeneratorCommon(RegisterCodeGenerator):
 
     @staticmethod
     def _register_setter_function_name(
-        register: "Register", register_array: Optional["RegisterArray"]
+        register: "Register", register_array: Optional["RegisterArray"], ordered: bool = False
     ) -> str:
         result = "set"
 
@@ -169,6 +174,9 @@ class CppGeneratorCommon(RegisterCodeGenerator):
 
         result += f"_{register.name}"
 
+        if ordered:
+            result += "_ordered"
+
         return result
 
     def _register_setter_function_signature(
@@ -176,11 +184,12 @@ class CppGeneratorCommon(RegisterCodeGenerator):
         register: "Register",
         register_array: Optional["RegisterArray"],
         indent: Optional[int] = None,
+        ordered: bool = False,
     ) -> str:
         indentation = self.get_indentation(indent=indent)
 
         function_name = self._register_setter_function_name(
-            register=register, register_array=register_array
+            register=register, register_array=register_array, ordered=ordered
         )
         result = f"{function_name}(\n"
 
@@ -191,6 +200,61 @@ class CppGeneratorCommon(RegisterCodeGenerator):
 
         return result
 
+    @staticmethod
+    def _static_cache_name(register: "Register", register_array: Optional["RegisterArray"]) -> str:
+        """
+        Name of the class member that holds the cached value of a static register.
+        """
+        result = "m"
+
+        if register_array:
+            result += f"_{register_array.name}"
+
+        result += f"_{register.name}_cache"
+
+        return result
+
+    @property
+    def _has_static_registers(self) -> bool:
+        return any(register.static for register, _ in self.iterate_registers())
+
+    @staticmethod
+    def _run_sequence_signature() -> str:
+        return (
+            "run_sequence(const fpga_regs::SequenceEntry *entries, size_t num_entries, "
+            "void (*delay_us)(uint32_t), uint32_t max_polls)"
+        )
+
+    @staticmethod
+    def _register_pair_getter_signature(register_pair: "RegisterPair") -> str:
+        return f"get_{register_pair.name}()"
+
+    @staticmethod
+    def _register_pair_setter_signature(register_pair: "RegisterPair") -> str:
+        return f"set_{register_pair.name}(uint64_t pair_value)"
+
+    @staticmethod
+    def _register_pair_description(
+        register_pair: "RegisterPair", low: "Register", high: "Register"
+    ) -> str:
+        return (
+            f"Methods for the '{register_pair.name}' register pair.\n"
+            f"Bits 31:0 are the '{low.name}' register and bits 63:32 are the '{high.name}' "
+            "register."
+        )
+
+    @staticmethod
+    def _commit_function_name(register: "Register") -> str:
+        return f"commit_{register.name}"
+
+    @staticmethod
+    def _commit_description(register: "Register") -> str:
+        committed = ", ".join(f"'{committed}'" for committed in register.commits)
+        return (
+            f"Commit the double-buffered {committed} to fabric, all at the same time.\n"
+            f"Writes the '{register.name}' register."
+        )
+
     @staticmethod
     def _field_setter_function_name(
         register: "Register",
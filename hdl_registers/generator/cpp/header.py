@@ -23,7 +23,17 @@ class CppHeaderGenerator(CppGeneratorCommon):
     The class header will contain:
 
     * for each register, signature of getter and setter methods for reading/writing the register as
-      an ``uint``.
+      an ``uint``, as well as the ordered variants of them.
+
+    * for each commit register of double-buffered registers, signature of a commit method.
+
+    * for each static register, a member that caches its value.
+      As well as the signature of a method that clears the cached values.
+      The members are atomic, which makes the class non-copyable and non-movable.
+
+    * for each register pair, signature of 64-bit getter and setter methods.
+
+    * signature of a method that runs programming sequence tables.
 
     * for each field in each register, signature of getter and setter methods for reading/writing
       the field as its native type (enumeration, positive/negative int, etc.).
@@ -32,7 +42,7 @@ class CppHeaderGenerator(CppGeneratorCommon):
         depending on the mode of the register.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "1.6.0"
 
     SHORT_DESCRIPTION = "C++ header"
 
@@ -53,7 +63,9 @@ class CppHeaderGenerator(CppGeneratorCommon):
         cpp_code += "  {\n"
 
         cpp_code += "  private:\n"
-        cpp_code += "    volatile uint32_t *m_registers;\n\n"
+        cpp_code += "    volatile uint32_t *m_registers;\n"
+        cpp_code += self._static_caches()
+        cpp_code += "\n"
 
         cpp_code += "  public:\n"
         cpp_code += f"    {self._constructor_signature()};\n\n"
@@ -78,6 +90,11 @@ class CppHeaderGenerator(CppGeneratorCommon):
                 )
                 cpp_code += function(return_type_name="uint32_t", signature=signature)
 
+                signature = self._register_getter_function_signature(
+                    register=register, register_array=register_array, ordered=True
+                )
+                cpp_code += function(return_type_name="uint32_t", signature=signature)
+
                 for field in register.fields:
                     field_type_name = self._field_value_type_name(
                         register=register, register_array=register_array, field=field
@@ -106,6 +123,15 @@ class CppHeaderGenerator(CppGeneratorCommon):
 
                 cpp_code += function(return_type_name="void", signature=signature)
 
+                signature = self._register_setter_function_signature(
+                    register=register, register_array=register_array, ordered=True
+                )
+                cpp_code += function(return_type_name="void", signature=signature)
+
+                if register.commits:
+                    signature = f"{self._commit_function_name(register=register)}()"
+                    cpp_code += function(return_type_name="void", signature=signature)
+
                 for field in register.fields:
                     signature = self._field_setter_function_signature(
                         register=register,
@@ -123,6 +149,38 @@ class CppHeaderGenerator(CppGeneratorCommon):
                     )
                     cpp_code += function(return_type_name="uint32_t", signature=signature)
 
+        for register_pair, low, high in self.iterate_register_pairs():
+            cpp_code += f"\n{self.get_separator_line()}"
+
+            description = self._register_pair_description(
+                register_pair=register_pair, low=low, high=high
+            )
+            cpp_code += self.comment_block(
+                text=f"{description}\nSee interface header for documentation."
+            )
+
+            if low.is_bus_readable and high.is_bus_readable:
+                signature = self._register_pair_getter_signature(register_pair=register_pair)
+                cpp_code += function(return_type_name="uint64_t", signature=signature)
+
+            if low.is_bus_writeable and high.is_bus_writeable:
+                signature = self._register_pair_setter_signature(register_pair=register_pair)
+                cpp_code += function(return_type_name="void", signature=signature)
+
+        if self._has_static_registers:
+            cpp_code += f"\n{self.get_separator_line()}"
+            cpp_code += self.comment_block(
+                text="Static register cache.\nSee interface header for documentation."
+            )
+            cpp_code += function(return_type_name="void", signature="reset_static_cache()")
+
+        if self.register_list.programming_sequences:
+            cpp_code += f"\n{self.get_separator_line()}"
+            cpp_code += self.comment_block(
+                text="Programming sequences.\nSee interface header for documentation."
+            )
+            cpp_code += function(return_type_name="bool", signature=self._run_sequence_signature())
+
         cpp_code += "  };\n"
 
         cpp_code_top = f"""\
@@ -133,3 +191,34 @@ class CppHeaderGenerator(CppGeneratorCommon):
 
 """
         return cpp_code_top + self._with_namespace(cpp_code)
+
+    def _static_caches(self) -> str:
+        """
+        Members that hold the cached values of static registers.
+        Atomic so that the getters can be called from many threads.
+        """
+        cpp_code = ""
+
+        for register, register_array in self.iterate_registers():
+            if not register.static:
+                continue
+
+            name = self._static_cache_name(register=register, register_array=register_array)
+            if register_array:
+                name += f"[{register_array.length}]"
+
+            cpp_code += f"    mutable std::atomic<uint64_t> {name}{{}};\n"
+
+        if cpp_code:
+            cpp_code = (
+                "\n"
+                + self.comment_block(
+                    text=(
+                        "Cached values of the static registers.\n"
+                        "Bit 32 is set when the value has been read from the bus."
+                    )
+                )
+                + cpp_code
+            )
+
+        return cpp_code
@@ -18,12 +18,14 @@ from hdl_registers.field.integer import Integer
 
 # Local folder libraries
 from .cpp_generator_common import CppGeneratorCommon
+from .trace import TRACE_NAME
 
 if TYPE_CHECKING:
     # First party libraries
     from hdl_registers.field.register_field import RegisterField
     from hdl_registers.register import Register
     from hdl_registers.register_array import RegisterArray
+    from hdl_registers.register_pair import RegisterPair
 
 
 class CppImplementationGenerator(CppGeneratorCommon):
@@ -41,9 +43,29 @@ class CppImplementationGenerator(CppGeneratorCommon):
 
       * The setter will read-modify-write the register to update only the specified field,
         depending on the mode of the register.
+
+    * for each register, implementation of the ordered getter and setter methods, that issue a
+      memory barrier after the read and before the write, respectively.
+
+    * for each commit register of double-buffered registers, implementation of a commit method.
+
+    * for each static register, a getter that reads the register over the bus only the first
+      time, and returns the cached value after that.
+      As well as a method that clears the cached values.
+
+    * for each register pair, implementation of 64-bit getter and setter methods.
+      If the ``FPGA_REGS_DATA_WIDTH`` macro is 64, for a 64-bit register bus, they access the pair
+      with one single 64-bit load or store.
+      Otherwise, they access the low register and then the high register.
+
+    * if there are programming sequences, implementation of a method that runs a programming
+      sequence table.
+
+    If the ``FPGA_REGS_TRACE`` macro is defined when compiling, every register read and write is
+    recorded by the trace backend from :class:`.CppTraceGenerator`.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "1.9.0"
 
     SHORT_DESCRIPTION = "C++ implementation"
 
@@ -79,6 +101,7 @@ class CppImplementationGenerator(CppGeneratorCommon):
 
             if register.is_bus_readable:
                 cpp_code += self._register_getter_function(register, register_array)
+                cpp_code += self._register_ordered_getter_function(register, register_array)
 
                 for field in register.fields:
                     cpp_code += self._field_getter_function(register, register_array, field=field)
@@ -88,6 +111,10 @@ class CppImplementationGenerator(CppGeneratorCommon):
 
             if register.is_bus_writeable:
                 cpp_code += self._register_setter_function(register, register_array)
+                cpp_code += self._register_ordered_setter_function(register, register_array)
+
+                if register.commits:
+                    cpp_code += self._commit_function(register=register)
 
                 for field in register.fields:
                     cpp_code += self._field_setter_function(register, register_array, field=field)
@@ -95,11 +122,74 @@ class CppImplementationGenerator(CppGeneratorCommon):
                         register, register_array, field=field
                     )
 
+        for register_pair, low, high in self.iterate_register_pairs():
+            cpp_code += f"{self.get_separator_line(indent=2)}"
+
+            description = self._register_pair_description(
+                register_pair=register_pair, low=low, high=high
+            )
+            cpp_code += self.comment_block(
+                text=f"{description}\nSee interface header for documentation.", indent=2
+            )
+            cpp_code += "\n"
+
+            if low.is_bus_readable and high.is_bus_readable:
+                cpp_code += self._register_pair_getter_function(
+                    register_pair=register_pair, low=low
+                )
+
+            if low.is_bus_writeable and high.is_bus_writeable:
+                cpp_code += self._register_pair_setter_function(
+                    register_pair=register_pair, low=low
+                )
+
+        if self._has_static_registers:
+            cpp_code += f"{self.get_separator_line(indent=2)}"
+            cpp_code += self.comment_block(
+                text="Static register cache.\nSee interface header for documentation.", indent=2
+            )
+            cpp_code += "\n"
+            cpp_code += self._reset_static_cache_function()
+
+        if self.register_list.programming_sequences:
+            cpp_code += f"{self.get_separator_line(indent=2)}"
+            cpp_code += self.comment_block(
+                text="Programming sequences.\nSee interface header for documentation.", indent=2
+            )
+            cpp_code += "\n"
+            cpp_code += self._run_sequence_function()
+
         cpp_code_top = f"{self.header}\n"
         cpp_code_top += f'#include "include/{self.name}.h"\n\n'
+        cpp_code_top += "#ifdef FPGA_REGS_TRACE\n"
+        cpp_code_top += f'#include "include/{TRACE_NAME}.h"\n'
+        cpp_code_top += "#endif\n\n"
 
         return cpp_code_top + self._with_namespace(cpp_code)
 
+    def _reset_static_cache_function(self) -> str:
+        cpp_code = f"  void {self._class_name}::reset_static_cache() const\n"
+        cpp_code += "  {\n"
+        cpp_code += "    // Clear bit 32, so that each register is read over the bus again.\n"
+
+        for register, register_array in self.iterate_registers():
+            if not register.static:
+                continue
+
+            cache_name = self._static_cache_name(register=register, register_array=register_array)
+            if register_array:
+                cpp_code += f"""\
+    for (std::atomic<uint64_t> &cache : {cache_name})
+    {{
+      cache.store(0, std::memory_order_relaxed);
+    }}
+"""
+            else:
+                cpp_code += f"    {cache_name}.store(0, std::memory_order_relaxed);\n"
+
+        cpp_code += "  }\n\n"
+        return cpp_code
+
     def _register_setter_function(
         self, register: "Register", register_array: Optional["RegisterArray"]
     ) -> str:
@@ -115,11 +205,12 @@ class CppImplementationGenerator(CppGeneratorCommon):
             )
             cpp_code += (
                 f"    const size_t index = {register_array.base_index} "
-                f"+ array_index * {len(register_array.registers)} + {register.index};\n"
+                f"+ array_index * {register_array.stride} + {register.index};\n"
             )
         else:
             cpp_code += f"    const size_t index = {register.index};\n"
 
+        cpp_code += self._trace(value="register_value", is_write=True)
         cpp_code += "    m_registers[index] = register_value;\n"
         cpp_code += "  }\n\n"
         return cpp_code
@@ -260,16 +351,220 @@ class CppImplementationGenerator(CppGeneratorCommon):
             )
             cpp_code += (
                 f"    const size_t index = {register_array.base_index} "
-                f"+ array_index * {len(register_array.registers)} + {register.index};\n"
+                f"+ array_index * {register_array.stride} + {register.index};\n"
             )
         else:
             cpp_code += f"    const size_t index = {register.index};\n"
 
-        cpp_code += "    const uint32_t result = m_registers[index];\n\n"
+        if register.static:
+            cache_name = self._static_cache_name(register=register, register_array=register_array)
+            if register_array:
+                cache_name += "[array_index]"
+
+            cpp_code += f"""
+    // Static register, that is read over the bus only the first time.
+    // Bit 32 of the cache is set when the value has been read.
+    std::atomic<uint64_t> &cache = {cache_name};
+    const uint64_t cached_value = cache.load(std::memory_order_relaxed);
+    if (cached_value >> 32)
+    {{
+      return static_cast<uint32_t>(cached_value);
+    }}
+
+"""
+
+        cpp_code += "    const uint32_t result = m_registers[index];\n"
+        cpp_code += self._trace(value="result", is_write=False)
+
+        if register.static:
+            cpp_code += (
+                "    cache.store((uint64_t(1) << 32) | result, std::memory_order_relaxed);\n"
+            )
+
+        cpp_code += "\n"
         cpp_code += "    return result;\n"
         cpp_code += "  }\n\n"
         return cpp_code
 
+    def _register_ordered_setter_function(
+        self, register: "Register", register_array: Optional["RegisterArray"]
+    ) -> str:
+        signature = self._register_setter_function_signature(
+            register=register, register_array=register_array, indent=2, ordered=True
+        )
+        setter_name = self._register_setter_function_name(
+            register=register, register_array=register_array
+        )
+        arguments = "array_index, register_value" if register_array else "register_value"
+
+        cpp_code = f"  void {self._class_name}::{signature} const\n"
+        cpp_code += "  {\n"
+        cpp_code += "    barrier();\n"
+        cpp_code += f"    {setter_name}({arguments});\n"
+        cpp_code += "  }\n\n"
+        return cpp_code
+
+    def _commit_function(self, register: "Register") -> str:
+        setter_name = self._register_setter_function_name(register=register, register_array=None)
+
+        cpp_code = (
+            f"  void {self._class_name}::{self._commit_function_name(register=register)}() const\n"
+        )
+        cpp_code += "  {\n"
+        cpp_code += self.comment("The commit is triggered by the write, regardless of value.")
+        cpp_code += f"    {setter_name}({register.default_value});\n"
+        cpp_code += "  }\n\n"
+        return cpp_code
+
+    def _register_ordered_getter_function(
+        self, register: "Register", register_array: Optional["RegisterArray"]
+    ) -> str:
+        signature = self._register_getter_function_signature(
+            register=register, register_array=register_array, indent=2, ordered=True
+        )
+        getter_name = self._register_getter_function_name(
+            register=register, register_array=register_array
+        )
+        arguments = "array_index" if register_array else ""
+
+        cpp_code = f"  uint32_t {self._class_name}::{signature} const\n"
+        cpp_code += "  {\n"
+        cpp_code += f"    const uint32_t result = {getter_name}({arguments});\n"
+        cpp_code += "    barrier();\n\n"
+        cpp_code += "    return result;\n"
+        cpp_code += "  }\n\n"
+        return cpp_code
+
+    def _register_pair_getter_function(self, register_pair: "RegisterPair", low: "Register") -> str:
+        signature = self._register_pair_getter_signature(register_pair=register_pair)
+
+        return f"""\
+  uint64_t {self._class_name}::{signature} const
+  {{
+    const size_t index = {low.index};
+#if FPGA_REGS_DATA_WIDTH == 64
+    const uint64_t result = *reinterpret_cast<volatile uint64_t *>(&m_registers[index]);
+#else
+    const uint64_t low = m_registers[index];
+    const uint64_t high = m_registers[index + 1];
+    const uint64_t result = (high << 32) | low;
+#endif
+{self._trace_pair(value="result", is_write=False)}
+    return result;
+  }}
+
+"""
+
+    def _register_pair_setter_function(self, register_pair: "RegisterPair", low: "Register") -> str:
+        signature = self._register_pair_setter_signature(register_pair=register_pair)
+
+        return f"""\
+  void {self._class_name}::{signature} const
+  {{
+    const size_t index = {low.index};
+{self._trace_pair(value="pair_value", is_write=True)}\
+#if FPGA_REGS_DATA_WIDTH == 64
+    *reinterpret_cast<volatile uint64_t *>(&m_registers[index]) = pair_value;
+#else
+    m_registers[index] = static_cast<uint32_t>(pair_value);
+    m_registers[index + 1] = static_cast<uint32_t>(pair_value >> 32);
+#endif
+  }}
+
+"""
+
+    @staticmethod
+    def _trace_pair(value: str, is_write: bool) -> str:
+        """
+        Record the access of a register pair in the trace as one access to each register,
+        if tracing is enabled when compiling.
+        """
+        is_write_string = "true" if is_write else "false"
+        return f"""\
+#ifdef FPGA_REGS_TRACE
+    trace::record(&m_registers[index], static_cast<uint32_t>({value}), {is_write_string});
+    trace::record(&m_registers[index + 1], static_cast<uint32_t>({value} >> 32), {is_write_string});
+#endif
+"""
+
+    def _run_sequence_function(self) -> str:
+        """
+        Interpreter for programming sequence tables.
+        Accesses the registers directly rather than via the getters and setters, to avoid the
+        function call overhead for each entry.
+        """
+        return f"""\
+  bool {self._class_name}::{self._run_sequence_signature()} const
+  {{
+    for (size_t entry_index = 0; entry_index < num_entries; ++entry_index)
+    {{
+      const fpga_regs::SequenceEntry &entry = entries[entry_index];
+      const size_t index = entry.address / 4;
+
+      switch (entry.opcode)
+      {{
+        case fpga_regs::SequenceOpcode::write:
+        {{
+{self._trace(value="entry.value", is_write=True, indent=10)}\
+          m_registers[index] = entry.value;
+          break;
+        }}
+
+        case fpga_regs::SequenceOpcode::modify:
+        {{
+          const uint32_t current_value = m_registers[index];
+{self._trace(value="current_value", is_write=False, indent=10)}\
+          const uint32_t result_value = (current_value & ~entry.mask) | entry.value;
+{self._trace(value="result_value", is_write=True, indent=10)}\
+          m_registers[index] = result_value;
+          break;
+        }}
+
+        case fpga_regs::SequenceOpcode::wait:
+        {{
+          for (uint32_t num_polls = 1;; ++num_polls)
+          {{
+            const uint32_t current_value = m_registers[index];
+{self._trace(value="current_value", is_write=False, indent=12)}\
+            if ((current_value & entry.mask) == entry.value)
+            {{
+              break;
+            }}
+
+            if (max_polls != 0 && num_polls >= max_polls)
+            {{
+              return false;
+            }}
+          }}
+          break;
+        }}
+
+        case fpga_regs::SequenceOpcode::delay:
+        {{
+          assert(delay_us != nullptr);
+          delay_us(entry.value);
+          break;
+        }}
+      }}
+    }}
+
+    return true;
+  }}
+
+"""
+
+    @staticmethod
+    def _trace(value: str, is_write: bool, indent: int = 4) -> str:
+        """
+        Record the register access in the trace, if tracing is enabled when compiling.
+        """
+        is_write_string = "true" if is_write else "false"
+        return f"""\
+#ifdef FPGA_REGS_TRACE
+{" " * indent}trace::record(&m_registers[index], {value}, {is_write_string});
+#endif
+"""
+
     def _field_getter_function(
         self,
         register: "Register",
@@ -12,6 +12,7 @@ from pathlib import Path
 from typing import TYPE_CHECKING, Any, Optional
 
 # First party libraries
+from hdl_registers.constant.array_constant import ArrayConstant
 from hdl_registers.constant.bit_vector_constant import UnsignedVectorConstant
 from hdl_registers.constant.boolean_constant import BooleanConstant
 from hdl_registers.constant.float_constant import FloatConstant
@@ -21,6 +22,7 @@ from hdl_registers.field.bit import Bit
 from hdl_registers.field.bit_vector import BitVector
 from hdl_registers.field.enumeration import Enumeration
 from hdl_registers.field.integer import Integer
+from hdl_registers.programming_sequence import SequenceOpcode
 from hdl_registers.register import REGISTER_MODES
 
 # Local folder libraries
@@ -31,6 +33,7 @@ if TYPE_CHECKING:
     from hdl_registers.field.register_field import RegisterField
     from hdl_registers.register import Register
     from hdl_registers.register_array import RegisterArray
+    from hdl_registers.register_pair import RegisterPair
 
 
 class CppInterfaceGenerator(CppGeneratorCommon):
@@ -54,9 +57,26 @@ class CppInterfaceGenerator(CppGeneratorCommon):
 
       * The setter will read-modify-write the register to update only the specified field,
         depending on the mode of the register.
+
+    * for each register, ordered variants of the getter and setter methods,
+      that also issue a memory barrier.
+
+    * for each commit register of double-buffered registers, signature of a commit method.
+
+    * for each register pair, signature of 64-bit getter and setter methods.
+      As well as the ``FPGA_REGS_DATA_WIDTH`` macro, that decides if they use one single 64-bit
+      access, for a 64-bit register bus.
+
+    * if there are static registers, signature of a method that clears their cached values.
+
+    * for each programming sequence, a table of compiled entries.
+      As well as the signature of a method that runs such a table.
+
+    * A memory barrier function and a ``RegisterBatch`` scope class, that are shared by
+      all register lists.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "1.9.0"
 
     SHORT_DESCRIPTION = "C++ interface header"
 
@@ -99,6 +119,8 @@ class CppInterfaceGenerator(CppGeneratorCommon):
 
         cpp_code += self._num_registers()
 
+        cpp_code += self._programming_sequences()
+
         cpp_code += f"    virtual ~I{self._class_name}() {{}}\n\n"
 
         for register, register_array in self.iterate_registers():
@@ -113,14 +135,36 @@ class CppInterfaceGenerator(CppGeneratorCommon):
             cpp_code += "\n"
 
             if register.is_bus_readable:
-                cpp_code += self.comment(
-                    "Getter that will read the whole register's value over the register bus."
-                )
+                if register.static:
+                    cpp_code += self.comment_block(
+                        text=(
+                            "Getter that will read the whole register's value over the register "
+                            "bus the first time it is called.\n"
+                            "The register is static, so later calls return a cached value "
+                            "without any bus access."
+                        )
+                    )
+                else:
+                    cpp_code += self.comment(
+                        "Getter that will read the whole register's value over the register bus."
+                    )
                 signature = self._register_getter_function_signature(
                     register=register, register_array=register_array
                 )
                 cpp_code += f"    virtual uint32_t {signature} const = 0;\n\n"
 
+                cpp_code += self.comment_block(
+                    text=(
+                        "Same as the getter above, but followed by a memory barrier.\n"
+                        "Memory accesses after the call, e.g. to DMA buffers, "
+                        "are ordered after the register read."
+                    )
+                )
+                signature = self._register_getter_function_signature(
+                    register=register, register_array=register_array, ordered=True
+                )
+                cpp_code += f"    virtual uint32_t {signature} const = 0;\n\n"
+
             if register.is_bus_writeable:
                 cpp_code += self.comment(
                     "Setter that will write the whole register's value over the register bus."
@@ -130,21 +174,252 @@ class CppInterfaceGenerator(CppGeneratorCommon):
                 )
                 cpp_code += f"    virtual void {signature} const = 0;\n\n"
 
+                cpp_code += self.comment_block(
+                    text=(
+                        "Same as the setter above, but preceded by a memory barrier.\n"
+                        "Memory accesses before the call, e.g. to DMA buffers, "
+                        "are ordered before the register write."
+                    )
+                )
+                signature = self._register_setter_function_signature(
+                    register=register, register_array=register_array, ordered=True
+                )
+                cpp_code += f"    virtual void {signature} const = 0;\n\n"
+
+            if register.commits:
+                cpp_code += self.comment_block(text=self._commit_description(register=register))
+                cpp_code += (
+                    f"    virtual void {self._commit_function_name(register=register)}() "
+                    "const = 0;\n\n"
+                )
+
             cpp_code += self._field_interface(register, register_array)
 
+        for register_pair, low, high in self.iterate_register_pairs():
+            cpp_code += self._register_pair_interface(register_pair, low, high)
+
+        if self._has_static_registers:
+            cpp_code += self.get_separator_line()
+            cpp_code += self.comment_block(
+                text=(
+                    "Clear the cached values of all static registers, so that each one is read "
+                    "over the register bus again the next time its getter is called.\n"
+                    "For example after the FPGA has been reset or re-programmed."
+                )
+            )
+            cpp_code += "    virtual void reset_static_cache() const = 0;\n\n"
+
+        if self.register_list.programming_sequences:
+            cpp_code += self.get_separator_line()
+            cpp_code += self.comment_block(
+                text=(
+                    "Run a programming sequence table, e.g. one of the '*_sequence' tables above, "
+                    "on the registers.\n"
+                    "Function 'delay_us' is called for each delay entry.\n"
+                    "Argument 'max_polls' is the maximum number of reads for each wait entry, "
+                    "or zero for no limit.\n"
+                    "Returns true when done, or false if a wait entry reached 'max_polls'."
+                )
+            )
+            cpp_code += f"    virtual bool {self._run_sequence_signature()} const = 0;\n\n"
+
         cpp_code += "  };\n\n"
 
         cpp_code_top = f"""\
 {self.header}
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <cstdlib>
 
+{self._memory_ordering()}
+{self._data_width()}\
+{self._sequence_types()}\
 """
         return cpp_code_top + self._with_namespace(cpp_code)
 
+    @staticmethod
+    def _memory_ordering() -> str:
+        """
+        Memory barrier and batch scope that are common to all register lists.
+        Guarded so that it is defined only once, even if many interface headers are included.
+        """
+        return """\
+#ifndef FPGA_REGS_MEMORY_ORDERING
+#define FPGA_REGS_MEMORY_ORDERING
+
+// Memory barrier used by the ordered register accessors and by 'fpga_regs::RegisterBatch'.
+// Orders register accesses against other memory accesses, e.g. to DMA buffers.
+// Can be overridden by defining the macro before including this header.
+#ifndef FPGA_REGS_BARRIER
+#if defined(__aarch64__) || defined(__arm__)
+#define FPGA_REGS_BARRIER() __asm__ volatile("dmb osh" ::: "memory")
+#else
+#define FPGA_REGS_BARRIER() std::atomic_thread_fence(std::memory_order_seq_cst)
+#endif
+#endif
+
+namespace fpga_regs
+{
+
+  inline void barrier()
+  {
+    FPGA_REGS_BARRIER();
+  }
+
+  // Scope for a group of register accesses, made with the default accessors, that need to be
+  // ordered against other memory accesses.
+  // Issues one memory barrier when the scope ends, instead of one for each access.
+  class RegisterBatch
+  {
+  public:
+    RegisterBatch() {}
+    RegisterBatch(const RegisterBatch &) = delete;
+    RegisterBatch &operator=(const RegisterBatch &) = delete;
+
+    ~RegisterBatch()
+    {
+      barrier();
+    }
+  };
+
+} /* namespace fpga_regs */
+
+#endif
+"""
+
+    def _data_width(self) -> str:
+        """
+        Data width of the register bus, that decides how register pairs are accessed.
+        Guarded so that it is defined only once, even if many interface headers are included.
+        """
+        if not self.register_list.register_pairs:
+            return ""
+
+        return """\
+// Data width of the register bus, 32 or 64.
+// With 64, each register pair is read or written with one single 64-bit access, which is atomic.
+// The base address of the register map must then be eight-byte aligned.
+// Can be overridden by defining the macro before including this header.
+#ifndef FPGA_REGS_DATA_WIDTH
+#define FPGA_REGS_DATA_WIDTH 32
+#endif
+
+// The register with the lower address is in bits 31:0 of a 64-bit bus word.
+#if FPGA_REGS_DATA_WIDTH == 64 && defined(__BYTE_ORDER__)
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "A 64-bit register bus is supported on little-endian hosts only."
+#endif
+#endif
+
+"""
+
+    def _sequence_types(self) -> str:
+        """
+        Types of the programming sequence tables, that are common to all register lists.
+        Guarded so that they are defined only once, even if many interface headers are included.
+        """
+        if not self.register_list.programming_sequences:
+            return ""
+
+        opcodes = "".join(
+            f"    {opcode.name.lower()} = {opcode.value},\n" for opcode in SequenceOpcode
+        )
+
+        return f"""\
+#ifndef FPGA_REGS_SEQUENCE
+#define FPGA_REGS_SEQUENCE
+
+namespace fpga_regs
+{{
+
+  // Operations of the entries in a programming sequence table.
+  enum class SequenceOpcode : uint32_t
+  {{
+{opcodes}\
+  }};
+
+  // One entry in a programming sequence table.
+  struct SequenceEntry
+  {{
+    SequenceOpcode opcode;
+    // Byte address of the register, relative to the register map.
+    uint32_t address;
+    uint32_t mask;
+    uint32_t value;
+  }};
+
+}} /* namespace fpga_regs */
+
+#endif
+
+"""
+
+    def _programming_sequences(self) -> str:
+        """
+        Tables of the compiled programming sequences.
+        """
+        cpp_code = ""
+
+        for programming_sequence, entries in self.iterate_programming_sequences():
+            cpp_code += self.comment(f"Programming sequence '{programming_sequence.name}'.")
+            cpp_code += self.comment_block(programming_sequence.description)
+            cpp_code += (
+                f"    static constexpr std::array<fpga_regs::SequenceEntry, {len(entries)}> "
+                f"{programming_sequence.name}_sequence = {{{{\n"
+            )
+            for entry in entries:
+                cpp_code += self.comment(entry.comment, indent=6)
+                cpp_code += (
+                    f"      {{fpga_regs::SequenceOpcode::{entry.opcode.name.lower()}, "
+                    f"0x{entry.address:X}, 0x{entry.mask:X}, 0x{entry.value:X}}},\n"
+                )
+            cpp_code += "    }};\n\n"
+
+        return cpp_code
+
+    def _register_pair_interface(
+        self, register_pair: "RegisterPair", low: "Register", high: "Register"
+    ) -> str:
+        cpp_code = self.get_separator_line()
+        cpp_code += self.comment_block(
+            text=self._register_pair_description(register_pair=register_pair, low=low, high=high)
+        )
+        cpp_code += "\n"
+
+        if low.is_bus_readable and high.is_bus_readable:
+            cpp_code += self.comment_block(
+                text=(
+                    "Getter that will read the low register and the high register over the "
+                    "register bus.\n"
+                    "With a 64-bit register bus, see 'FPGA_REGS_DATA_WIDTH', the two registers are "
+                    "read in one bus transaction, so the value is read atomically.\n"
+                    "Otherwise, the low register is read first and the high register after it, in "
+                    "two separate bus transactions, so the value is not read atomically."
+                )
+            )
+            signature = self._register_pair_getter_signature(register_pair=register_pair)
+            cpp_code += f"    virtual uint64_t {signature} const = 0;\n\n"
+
+        if low.is_bus_writeable and high.is_bus_writeable:
+            cpp_code += self.comment_block(
+                text=(
+                    "Setter that will write the low register and the high register over the "
+                    "register bus.\n"
+                    "With a 64-bit register bus, see 'FPGA_REGS_DATA_WIDTH', the two registers are "
+                    "written in one bus transaction, so the value is written atomically.\n"
+                    "Otherwise, the low register is written first and the high register after it, "
+                    "in two separate bus transactions, so the value is not written atomically."
+                )
+            )
+            signature = self._register_pair_setter_signature(register_pair=register_pair)
+            cpp_code += f"    virtual void {signature} const = 0;\n\n"
+
+        return cpp_code
+
     def _constants(self) -> str:
         cpp_code = ""
 
@@ -171,6 +446,13 @@ class CppInterfaceGenerator(CppGeneratorCommon):
             elif isinstance(constant, UnsignedVectorConstant):
                 type_declaration = " auto"
                 value = f"{constant.prefix}{constant.value_without_separator}"
+            elif isinstance(constant, ArrayConstant):
+                # A "constexpr" static member is implicitly "inline" (C++17), so the array is
+                # defined only once in the program and needs no initialization at run time.
+                # Element types match the scalar integer and float constants above.
+                element_type = "double" if constant.element_type is float else "int"
+                type_declaration = f"expr std::array<{element_type}, {constant.length}>"
+                value = "{" + ", ".join(str(element) for element in constant.value) + "}"
             else:
                 raise ValueError(f"Got unexpected constant type. {constant}")
 
@@ -330,6 +612,10 @@ class CppInterfaceGenerator(CppGeneratorCommon):
   {{
     // Number of times the registers of the array are repeated.
     static const auto array_length = {register_array.length};
+    // Number of register indexes between the start of two repetitions of the array.
+    static const auto array_stride = {register_array.stride};
+    // Number of register indexes, in total, that pad the array to its stride.
+    static const auto num_padding_registers = {register_array.num_padding_registers};
   }};
 
 """
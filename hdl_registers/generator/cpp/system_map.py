@@ -0,0 +1,227 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+from pathlib import Path
+from typing import Any
+
+# First party libraries
+from hdl_registers.generator.system_code_generator import (
+    REGISTER_SIZE_BYTES,
+    RegisterListInstance,
+    SystemCodeGenerator,
+)
+from hdl_registers.register import Register
+
+# Local folder libraries
+from .cpp_generator_common import CppGeneratorCommon
+
+
+class CppSystemMapGenerator(SystemCodeGenerator):
+    """
+    Generate a C++ header with the address map of a whole system, i.e. many register lists placed
+    at different base addresses.
+    See the :ref:`generator_cpp` article for usage details.
+
+    The header will contain:
+
+    * The base address and size of the system address space, i.e. the span that has to be
+      memory mapped in order to access all the register lists.
+
+    * For each register list instance, ``constexpr`` values for its absolute base address, its
+      offset within the system address space and the absolute address of each register.
+
+    * A class with one :class:`.CppHeaderGenerator` class object for each register list instance,
+      that all use the same memory mapping.
+
+    The C++ header, interface header and implementation for each register list must be generated
+    separately.
+    """
+
+    __version__ = "1.1.0"
+
+    SHORT_DESCRIPTION = "C++ system map header"
+
+    COMMENT_START = "//"
+
+    DEFAULT_INDENTATION_LEVEL = 4
+
+    def __init__(self, name: str, register_lists: list[RegisterListInstance], output_folder: Path):
+        """
+        For argument description, please see the super class.
+        """
+        super().__init__(name=name, register_lists=register_lists, output_folder=output_folder)
+
+        self._class_name = self.to_pascal_case(snake_string=self.name)
+
+    @property
+    def output_file(self) -> Path:
+        """
+        Result will be placed in this file.
+        """
+        return self.output_folder / f"{self.name}.h"
+
+    def get_code(self, **kwargs: Any) -> str:
+        """
+        Get a complete C++ header with the system address map and a class for accessing
+        all register lists.
+        """
+        cpp_code = f"  namespace {self.name}\n"
+        cpp_code += "  {\n\n"
+
+        cpp_code += self.comment_block(
+            text=(
+                "Absolute address where the system address space starts.\n"
+                "I.e. the lowest base address of all the register lists."
+            )
+        )
+        cpp_code += f"    constexpr uint64_t base_address = {self._address(self.base_address)};\n\n"
+
+        cpp_code += self.comment_block(
+            text=(
+                "Number of bytes in the system address space.\n"
+                "One memory mapping of this size, starting at 'base_address',\n"
+                "covers the registers of all the register lists."
+            )
+        )
+        cpp_code += f"    constexpr size_t mapping_size = {self._offset(self.size)};\n\n"
+
+        for register_list in self.register_lists:
+            cpp_code += self._register_list_addresses(register_list=register_list)
+
+        cpp_code += f"  }} /* namespace {self.name} */\n\n"
+
+        cpp_code += self._system_class()
+
+        includes = ""
+        included_names = set()
+        for register_list in self.register_lists:
+            if register_list.register_list.name not in included_names:
+                includes += f'#include "{register_list.register_list.name}.h"\n'
+                included_names.add(register_list.register_list.name)
+
+        cpp_code_top = f"""\
+{self.header}
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+{includes}
+"""
+        return cpp_code_top + CppGeneratorCommon._with_namespace(cpp_code)
+
+    @staticmethod
+    def _address(value: int) -> str:
+        return f"0x{value:08X}uLL"
+
+    @staticmethod
+    def _offset(value: int) -> str:
+        return f"0x{value:X}uL"
+
+    def _register_list_addresses(self, register_list: RegisterListInstance) -> str:
+        cpp_code = self.get_separator_line()
+        cpp_code += self.comment(
+            f"Addresses of the '{register_list.name}' instance of the "
+            f"'{register_list.register_list.name}' register list."
+        )
+        cpp_code += f"    namespace {register_list.name}\n"
+        cpp_code += "    {\n"
+
+        cpp_code += self.comment(
+            "Absolute address where the registers of this instance start.", indent=6
+        )
+        address = self._address(register_list.base_address)
+        cpp_code += f"      constexpr uint64_t base_address = {address};\n\n"
+
+        cpp_code += self.comment(
+            "Byte offset of this instance within the system address space.", indent=6
+        )
+        offset = self._offset(register_list.base_address - self.base_address)
+        cpp_code += f"      constexpr size_t offset = {offset};\n\n"
+
+        cpp_code += self.comment("Absolute address of each register.", indent=6)
+        cpp_code += "      namespace address\n"
+        cpp_code += "      {\n"
+
+        for register_object in register_list.register_list.register_objects:
+            if isinstance(register_object, Register):
+                address = self._address(
+                    register_list.base_address + register_object.index * REGISTER_SIZE_BYTES
+                )
+                cpp_code += f"        constexpr uint64_t {register_object.name} = {address};\n"
+
+            else:
+                array_length = (
+                    f"::fpga_regs::{register_list.register_list.name}::"
+                    f"{register_object.name}::array_length"
+                )
+                stride = self._offset(register_object.stride * REGISTER_SIZE_BYTES)
+
+                for register in register_object.registers:
+                    address = self._address(
+                        register_list.base_address
+                        + register_object.get_start_index(array_index=0) * REGISTER_SIZE_BYTES
+                        + register.index * REGISTER_SIZE_BYTES
+                    )
+
+                    cpp_code += f"""\
+        constexpr uint64_t {register_object.name}_{register.name}(size_t array_index)
+        {{
+          assert(array_index < {array_length});
+          return {address} + array_index * {stride};
+        }}
+"""
+
+        cpp_code += "      } /* namespace address */\n"
+        cpp_code += f"    }} /* namespace {register_list.name} */\n\n"
+
+        return cpp_code
+
+    def _system_class(self) -> str:
+        cpp_code = self.comment_block(
+            text=(
+                f"Access to the registers of all the register lists in the '{self.name}' system,\n"
+                "using one memory mapping of the whole system address space."
+            ),
+            indent=2,
+        )
+        cpp_code += f"  class {self._class_name}\n"
+        cpp_code += "  {\n"
+        cpp_code += "  public:\n"
+
+        cpp_code += self.comment_block(
+            text=(
+                "'mapping' is the virtual address where the system 'base_address' is mapped,\n"
+                "e.g. the result of one 'mmap' call with size 'mapping_size'."
+            )
+        )
+        cpp_code += f"    {self._class_name}(volatile uint8_t *mapping)"
+
+        separator = "\n        : "
+        for register_list in self.register_lists:
+            offset = f"::fpga_regs::{self.name}::{register_list.name}::offset"
+            cpp_code += f"{separator}{register_list.name}(mapping + {offset})"
+            separator = ",\n          "
+
+        cpp_code += "\n    {\n"
+        cpp_code += "      // Empty\n"
+        cpp_code += "    }\n"
+
+        for register_list in self.register_lists:
+            class_name = self.to_pascal_case(snake_string=register_list.register_list.name)
+
+            cpp_code += "\n"
+            cpp_code += self.comment(f"Registers of the '{register_list.name}' instance.")
+            cpp_code += f"    {class_name} {register_list.name};\n"
+
+        cpp_code += "  };\n\n"
+
+        return cpp_code
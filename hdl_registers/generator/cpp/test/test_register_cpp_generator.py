@@ -45,3 +45,14 @@ def test_read_only_register_has_no_setters(cpp_test_toml_code):
 def test_write_only_register_has_no_setters(cpp_test_toml_code):
     assert "set_command" in cpp_test_toml_code
     assert "get_command" not in cpp_test_toml_code
+
+
+def test_ordered_accessors_follow_register_mode(cpp_test_toml_code):
+    assert "get_status_ordered" in cpp_test_toml_code
+    assert "set_command_ordered" in cpp_test_toml_code
+    assert "get_config_ordered" in cpp_test_toml_code
+    assert "set_config_ordered" in cpp_test_toml_code
+
+    # Memory ordering helpers are defined once, even if many interface headers are included.
+    assert cpp_test_toml_code.count("#ifndef FPGA_REGS_MEMORY_ORDERING") == 1
+    assert "class RegisterBatch" in cpp_test_toml_code
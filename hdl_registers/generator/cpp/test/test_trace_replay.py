@@ -0,0 +1,173 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Note that the trace recording of the generated C++ code, and reading of the trace file,
+# is also tested in the file 'test_compiled_cpp_code.py'.
+
+# Standard libraries
+import struct
+
+# Third party libraries
+import pytest
+
+# First party libraries
+from hdl_registers.generator.cpp.trace_replay import Trace, TraceEntry, TraceReplay
+from hdl_registers.generator.system_code_generator import RegisterListInstance
+from hdl_registers.register_list import RegisterList
+
+
+def get_replay():
+    apa = RegisterList(name="apa")
+    apa.append_register(name="config", mode="r_w", description="")
+    apa.append_register(name="command", mode="wpulse", description="")
+    register_array = apa.append_register_array(name="channels", length=2, description="")
+    register_array.append_register(name="gain", mode="w", description="")
+    register_array.append_register(name="status", mode="r", description="")
+
+    return TraceReplay(
+        register_lists=[
+            RegisterListInstance(register_list=apa, base_address=0x4000_1000),
+            RegisterListInstance(register_list=apa, base_address=0x4000_0000, name="apa_0"),
+        ]
+    )
+
+
+def entry(timestamp_ns, offset, value, is_write, thread=0):
+    return TraceEntry(
+        timestamp_ns=timestamp_ns, offset=offset, value=value, thread=thread, is_write=is_write
+    )
+
+
+def test_register_names():
+    replay = get_replay()
+
+    assert replay.base_address == 0x4000_0000
+    assert replay.size == 0x1000 + 6 * 4
+
+    assert replay.get_register_name(0) == "apa_0.config"
+    assert replay.get_register_name(0x1004) == "apa.command"
+    assert replay.get_register_name(0x1010) == "apa.channels[1].gain"
+    assert replay.get_register_name(0x1014) == "apa.channels[1].status"
+    assert replay.get_register_name(0x100) == "<unknown offset 0x100>"
+
+
+def test_find_redundant_accesses():
+    replay = get_replay()
+    trace = Trace(
+        entries=[
+            entry(0, offset=0x1000, value=3, is_write=True),
+            # Write of same value.
+            entry(1, offset=0x1000, value=3, is_write=True),
+            # Other instance of the same register list is a different register.
+            entry(2, offset=0x0000, value=3, is_write=True),
+            # Read back of value that was written.
+            entry(3, offset=0x1000, value=3, is_write=False),
+            # Write-pulse register, every write has an effect.
+            entry(4, offset=0x1004, value=1, is_write=True),
+            entry(5, offset=0x1004, value=1, is_write=True),
+            # Read-only register, value may change.
+            entry(6, offset=0x100C, value=7, is_write=False),
+            entry(7, offset=0x100C, value=7, is_write=False),
+            # Write-only register.
+            entry(8, offset=0x1008, value=2, is_write=True),
+            entry(9, offset=0x1008, value=2, is_write=True),
+            entry(10, offset=0x1008, value=1, is_write=True),
+            # Offset outside of register lists is ignored.
+            entry(11, offset=0x100, value=1, is_write=True),
+            entry(12, offset=0x100, value=1, is_write=True),
+        ]
+    )
+
+    redundant_accesses = replay.find_redundant_accesses(trace=trace)
+    assert [
+        (redundant_access.entry.timestamp_ns, redundant_access.register_name)
+        for redundant_access in redundant_accesses
+    ] == [(1, "apa.config"), (3, "apa.config"), (9, "apa.channels[0].gain")]
+
+    report = replay.get_report(trace=trace)
+    assert "13 accesses (3 reads, 10 writes) from 1 threads.\n" in report
+    assert "3 redundant accesses:\n" in report
+    assert "         2  apa.channels[0].status (read)\n" in report
+
+
+def test_replay_on_in_memory_model():
+    replay = get_replay()
+    trace = Trace(
+        entries=[
+            entry(1000, offset=0x1000, value=0xABCD, is_write=True),
+            entry(3000, offset=0x0000, value=7, is_write=True, thread=1),
+            entry(5000, offset=0x1000, value=0xABCD, is_write=False),
+        ]
+    )
+
+    memory = bytearray(replay.size)
+    timing = replay.replay(trace=trace, mapping=memory)
+    assert timing.num_accesses == 3
+    assert timing.recorded_duration_ns == 4000
+    assert timing.recorded_accesses_per_second == 750_000
+    assert timing.max_lag_ns == 0
+    assert struct.unpack_from("<I", memory, 0x1000)[0] == 0xABCD
+    assert struct.unpack_from("<I", memory, 0)[0] == 7
+
+    timing = replay.replay(trace=trace, realtime=True)
+    assert timing.replay_duration_ns >= 4000
+
+    report = replay.get_report(trace=trace, timing=timing)
+    assert "from 2 threads" in report
+    assert "Recorded: 4000 ns, 750000 accesses/s.\n" in report
+
+    timing = replay.replay(trace=Trace(entries=[]))
+    assert timing.num_accesses == 0
+
+
+def test_trace_file(tmp_path):
+    entries = [
+        entry(10, offset=4, value=5, is_write=True),
+        entry(20, offset=8, value=6, is_write=False),
+    ]
+
+    def write_file(magic=b"FPGATRCE", version=1, num_recorded=2, num_entries=2):
+        data = struct.pack("<8sIIQQ", magic, version, 24, num_recorded, num_entries)
+        for trace_entry in entries:
+            data += struct.pack(
+                "<QIIII",
+                trace_entry.timestamp_ns,
+                trace_entry.offset,
+                trace_entry.value,
+                trace_entry.thread,
+                trace_entry.is_write,
+            )
+
+        file = tmp_path / "trace.bin"
+        file.write_bytes(data)
+        return file
+
+    trace = Trace.from_file(write_file(num_recorded=5))
+    assert trace.entries == entries
+    assert trace.num_recorded == 5
+    assert trace.num_overwritten == 3
+    assert "3 older accesses were overwritten in the ring buffer.\n" in get_replay().get_report(
+        trace=trace
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        Trace.from_file(write_file(magic=b"APAHEST!"))
+    assert str(exception_info.value).startswith("Not a register trace file: ")
+
+    with pytest.raises(ValueError) as exception_info:
+        Trace.from_file(write_file(version=2))
+    assert str(exception_info.value).startswith(
+        "Unsupported trace file version 2 with entry size 24: "
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        Trace.from_file(write_file(num_entries=3))
+    assert str(exception_info.value).startswith(
+        "Trace file size does not match the number of entries (3): "
+    )
@@ -0,0 +1,231 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+from pathlib import Path
+from typing import Any
+
+# First party libraries
+from hdl_registers.register_list import RegisterList
+
+# Local folder libraries
+from .cpp_generator_common import CppGeneratorCommon
+
+# Name of the generated header, which is included by the C++ implementation when tracing is enabled.
+TRACE_NAME = "fpga_regs_trace"
+
+# Identifies a trace file written by the generated code.
+TRACE_FILE_MAGIC = b"FPGATRCE"
+
+# Version of the trace file format.
+# Shall be incremented if the file header or the entry format is changed.
+TRACE_FILE_VERSION = 1
+
+# Number of bytes in each trace entry.
+TRACE_ENTRY_SIZE_BYTES = 24
+
+
+class CppTraceGenerator(CppGeneratorCommon):
+    """
+    Generate a C++ header with a trace backend that records the register accesses made by the
+    generated C++ classes.
+    See the :ref:`generator_cpp` article for usage details.
+
+    The trace is only compiled in when the ``FPGA_REGS_TRACE`` macro is defined when compiling the
+    :class:`.CppImplementationGenerator` code.
+    Each bus read and write is then recorded in a fixed-size ring buffer:
+    time stamp, byte offset of the register, value and thread number.
+    The buffer can be saved to a binary file, which is analyzed and replayed
+    with :class:`.TraceReplay`.
+
+    This header does not depend on any register list, and should be generated once and used by all
+    the register lists of a system.
+    """
+
+    __version__ = "1.0.0"
+
+    SHORT_DESCRIPTION = "C++ register access trace"
+
+    DEFAULT_INDENTATION_LEVEL = 4
+
+    def __init__(self, output_folder: Path):
+        """
+        Arguments:
+            output_folder: Result file will be placed in this folder.
+        """
+        super().__init__(register_list=RegisterList(name=TRACE_NAME), output_folder=output_folder)
+
+    @property
+    def output_file(self) -> Path:
+        """
+        Result will be placed in this file.
+        """
+        return self.output_folder / f"{self.name}.h"
+
+    def get_code(self, **kwargs: Any) -> str:
+        """
+        Get a complete C++ header with the trace backend.
+        """
+        magic = ", ".join(f"'{character}'" for character in TRACE_FILE_MAGIC.decode())
+
+        cpp_code = f"""\
+  namespace trace
+  {{
+
+    // Number of entries in the ring buffer.
+    // When the buffer is full, the oldest entries are overwritten.
+    // Must be a power of two.
+#ifndef FPGA_REGS_TRACE_CAPACITY
+    constexpr size_t capacity = 65536;
+#else
+    constexpr size_t capacity = FPGA_REGS_TRACE_CAPACITY;
+#endif
+    static_assert((capacity & (capacity - 1)) == 0, "Trace capacity must be a power of two");
+
+    // One register access.
+    // Saved to file as-is, in the byte order of the host.
+    struct Entry
+    {{
+      // Nanoseconds since 'start' was called.
+      uint64_t timestamp_ns;
+      // Byte offset of the register, relative to the 'base_address' given to 'start'.
+      uint32_t offset;
+      // The value that was read or written.
+      uint32_t value;
+      // Sequential number of the thread that made the access, starting at zero.
+      uint32_t thread;
+      // One for a write, zero for a read.
+      uint32_t is_write;
+    }};
+    static_assert(sizeof(Entry) == {TRACE_ENTRY_SIZE_BYTES}, "Unexpected trace entry size");
+
+    struct State
+    {{
+      std::atomic<bool> enabled{{false}};
+      std::atomic<uint64_t> num_recorded{{0}};
+      std::atomic<uint32_t> num_threads{{0}};
+      const volatile uint8_t *base_address = nullptr;
+      std::chrono::steady_clock::time_point start_time;
+      Entry entries[capacity];
+    }};
+
+    inline State &state()
+    {{
+      static State result;
+      return result;
+    }}
+
+    inline uint32_t thread_number()
+    {{
+      thread_local const uint32_t result = state().num_threads.fetch_add(1);
+      return result;
+    }}
+
+    // Clear the buffer and start recording the accesses to registers that are located at,
+    // or after, 'base_address'.
+    // For a system this is typically the start of the system memory mapping.
+    inline void start(const volatile uint8_t *base_address)
+    {{
+      State &trace = state();
+
+      trace.enabled = false;
+      trace.num_recorded = 0;
+      trace.base_address = base_address;
+      trace.start_time = std::chrono::steady_clock::now();
+      trace.enabled = true;
+    }}
+
+    // Stop recording. The entries remain in the buffer until the next call to 'start'.
+    inline void stop()
+    {{
+      state().enabled = false;
+    }}
+
+    // Number of register accesses since 'start' was called, including the ones that
+    // have been overwritten in the buffer.
+    inline uint64_t num_recorded()
+    {{
+      return state().num_recorded;
+    }}
+
+    // Record one register access.
+    // Called by the generated register classes when 'FPGA_REGS_TRACE' is defined.
+    inline void record(const volatile uint32_t *address, uint32_t value, bool is_write)
+    {{
+      State &trace = state();
+
+      if (!trace.enabled.load(std::memory_order_relaxed))
+      {{
+        return;
+      }}
+
+      const auto now = std::chrono::steady_clock::now();
+      const uint64_t index = trace.num_recorded.fetch_add(1, std::memory_order_relaxed);
+
+      Entry &entry = trace.entries[index & (capacity - 1)];
+      entry.timestamp_ns = static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(now - trace.start_time).count());
+      entry.offset = static_cast<uint32_t>(
+          reinterpret_cast<const volatile uint8_t *>(address) - trace.base_address);
+      entry.value = value;
+      entry.thread = thread_number();
+      entry.is_write = is_write ? 1 : 0;
+    }}
+
+    // Save the recorded entries, oldest first, to a binary file.
+    // Should be called after 'stop', so that no entries are written while saving.
+    // Returns false if the file could not be written.
+    inline bool save(const char *file_name)
+    {{
+      const State &trace = state();
+
+      const uint64_t num_recorded = trace.num_recorded;
+      const uint64_t num_entries = num_recorded < capacity ? num_recorded : capacity;
+      const uint64_t first_index = num_recorded - num_entries;
+
+      std::FILE *file = std::fopen(file_name, "wb");
+      if (file == nullptr)
+      {{
+        return false;
+      }}
+
+      const char magic[8] = {{{magic}}};
+      const uint32_t version = {TRACE_FILE_VERSION};
+      const uint32_t entry_size = sizeof(Entry);
+
+      bool ok = std::fwrite(magic, sizeof(magic), 1, file) == 1;
+      ok = ok && std::fwrite(&version, sizeof(version), 1, file) == 1;
+      ok = ok && std::fwrite(&entry_size, sizeof(entry_size), 1, file) == 1;
+      ok = ok && std::fwrite(&num_recorded, sizeof(num_recorded), 1, file) == 1;
+      ok = ok && std::fwrite(&num_entries, sizeof(num_entries), 1, file) == 1;
+
+      for (uint64_t index = first_index; ok && index < num_recorded; ++index)
+      {{
+        ok = std::fwrite(&trace.entries[index & (capacity - 1)], sizeof(Entry), 1, file) == 1;
+      }}
+
+      return (std::fclose(file) == 0) && ok;
+    }}
+
+  }} /* namespace trace */
+
+"""
+
+        cpp_code_top = f"""\
+{self.header}
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+"""
+        return cpp_code_top + self._with_namespace(cpp_code)
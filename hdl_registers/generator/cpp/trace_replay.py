@@ -0,0 +1,378 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+import struct
+import time
+from collections import Counter
+from pathlib import Path
+from typing import NamedTuple, Optional, Union
+
+# First party libraries
+from hdl_registers.generator.system_code_generator import (
+    REGISTER_SIZE_BYTES,
+    RegisterListInstance,
+)
+from hdl_registers.register import Register
+
+# Local folder libraries
+from .trace import TRACE_ENTRY_SIZE_BYTES, TRACE_FILE_MAGIC, TRACE_FILE_VERSION
+
+# Magic, version, entry size, number of recorded accesses and number of entries in the file.
+_FILE_HEADER = struct.Struct("<8sIIQQ")
+
+# Time stamp, offset, value, thread, is write.
+_ENTRY = struct.Struct("<QIIII")
+
+
+class TraceEntry(NamedTuple):
+    """
+    One register access in a trace.
+    See the ``Entry`` struct of :class:`.CppTraceGenerator` for a description of the fields.
+    """
+
+    timestamp_ns: int
+    offset: int
+    value: int
+    thread: int
+    is_write: bool
+
+
+class Trace:
+    """
+    Register accesses that were recorded by the C++ trace backend from :class:`.CppTraceGenerator`.
+    """
+
+    def __init__(self, entries: list[TraceEntry], num_recorded: Optional[int] = None):
+        """
+        Arguments:
+            entries: The register accesses, oldest first.
+            num_recorded: Number of accesses that were made while recording.
+                Is higher than the number of ``entries`` if the ring buffer has overflowed.
+                Default is the number of ``entries``.
+        """
+        self.entries = entries
+        self.num_recorded = len(entries) if num_recorded is None else num_recorded
+
+    @property
+    def num_overwritten(self) -> int:
+        """
+        Number of accesses that were lost because the ring buffer overflowed.
+        """
+        return self.num_recorded - len(self.entries)
+
+    @classmethod
+    def from_file(cls, file: Path) -> "Trace":
+        """
+        Read a trace file that was saved by the C++ trace backend.
+        """
+        data = file.read_bytes()
+
+        if len(data) < _FILE_HEADER.size:
+            raise ValueError(f"Trace file is too short: {file}")
+
+        magic, version, entry_size, num_recorded, num_entries = _FILE_HEADER.unpack_from(data)
+        if magic != TRACE_FILE_MAGIC:
+            raise ValueError(f"Not a register trace file: {file}")
+
+        if version != TRACE_FILE_VERSION or entry_size != TRACE_ENTRY_SIZE_BYTES:
+            raise ValueError(
+                f"Unsupported trace file version {version} with entry size {entry_size}: {file}"
+            )
+
+        if len(data) != _FILE_HEADER.size + num_entries * entry_size:
+            raise ValueError(
+                f"Trace file size does not match the number of entries ({num_entries}): {file}"
+            )
+
+        entries = [
+            TraceEntry(
+                timestamp_ns=timestamp_ns,
+                offset=offset,
+                value=value,
+                thread=thread,
+                is_write=bool(is_write),
+            )
+            for timestamp_ns, offset, value, thread, is_write in _ENTRY.iter_unpack(
+                data[_FILE_HEADER.size :]
+            )
+        ]
+
+        return cls(entries=entries, num_recorded=num_recorded)
+
+
+class ReplayTiming(NamedTuple):
+    """
+    Result of replaying a trace.
+    """
+
+    num_accesses: int
+    # Time from the first to the last access, when the trace was recorded.
+    recorded_duration_ns: int
+    # Time from the first to the last access, when the trace was replayed.
+    replay_duration_ns: int
+    # The largest delay of an access compared to when it was recorded.
+    # Only relevant when replaying in real time.
+    max_lag_ns: int
+
+    @property
+    def recorded_accesses_per_second(self) -> float:
+        """
+        Access rate when the trace was recorded.
+        """
+        return self._accesses_per_second(self.recorded_duration_ns)
+
+    @property
+    def replay_accesses_per_second(self) -> float:
+        """
+        Access rate when the trace was replayed.
+        """
+        return self._accesses_per_second(self.replay_duration_ns)
+
+    def _accesses_per_second(self, duration_ns: int) -> float:
+        if duration_ns == 0:
+            return 0.0
+
+        return self.num_accesses * 1e9 / duration_ns
+
+
+class RedundantAccess(NamedTuple):
+    """
+    An access that could be removed from the driver without changing the result.
+    """
+
+    entry: TraceEntry
+    register_name: str
+    reason: str
+
+
+class TraceReplay:
+    """
+    Analyze and replay traces that were recorded by the C++ trace backend
+    from :class:`.CppTraceGenerator`.
+    See the :ref:`generator_cpp` article for usage details.
+
+    The trace offsets are resolved to register names using the system address map given
+    as ``register_lists``, where offset zero is the lowest base address.
+    I.e. the same address space as a :class:`.CppSystemMapGenerator` mapping.
+    """
+
+    def __init__(self, register_lists: list[RegisterListInstance]):
+        """
+        Arguments:
+            register_lists: The register list instances that the trace was recorded on.
+                The lowest base address shall be the ``base_address`` that was given to
+                ``trace::start`` when recording.
+        """
+        self.base_address = min(
+            (register_list.base_address for register_list in register_lists), default=0
+        )
+        self.size = (
+            max((register_list.end_address for register_list in register_lists), default=0)
+            - self.base_address
+        )
+
+        self._registers: dict[int, tuple[str, Register]] = {}
+        for register_list in register_lists:
+            self._add_registers(register_list=register_list)
+
+    def _add_registers(self, register_list: RegisterListInstance) -> None:
+        list_offset = register_list.base_address - self.base_address
+
+        for register_object in register_list.register_list.register_objects:
+            if isinstance(register_object, Register):
+                offset = list_offset + register_object.index * REGISTER_SIZE_BYTES
+                self._registers[offset] = (
+                    f"{register_list.name}.{register_object.name}",
+                    register_object,
+                )
+                continue
+
+            for array_index in range(register_object.length):
+                start_index = register_object.get_start_index(array_index=array_index)
+                for register in register_object.registers:
+                    offset = list_offset + (start_index + register.index) * REGISTER_SIZE_BYTES
+                    self._registers[offset] = (
+                        f"{register_list.name}.{register_object.name}[{array_index}]."
+                        f"{register.name}",
+                        register,
+                    )
+
+    def get_register_name(self, offset: int) -> str:
+        """
+        Name of the register at the given byte offset, including the register list instance name
+        and any array index.
+        """
+        if offset in self._registers:
+            return self._registers[offset][0]
+
+        return f"<unknown offset 0x{offset:X}>"
+
+    def get_access_counts(self, trace: Trace) -> Counter[str]:
+        """
+        Number of accesses to each register, as well as the total number of reads and writes.
+        """
+        result: Counter[str] = Counter()
+
+        for entry in trace.entries:
+            direction = "write" if entry.is_write else "read"
+            result[f"{self.get_register_name(entry.offset)} ({direction})"] += 1
+
+        return result
+
+    def find_redundant_accesses(self, trace: Trace) -> list[RedundantAccess]:
+        """
+        Find accesses that do not change or reveal anything, given the accesses before them:
+
+        * A write of the value that the register already has, to a register in mode ``r_w`` or
+          ``w``.
+          Write-pulse registers are not included, since every write has an effect.
+
+        * A read of a register in mode ``r_w`` whose value is already known from a previous
+          read or write.
+          The value of such a register can only be changed by the bus.
+
+        Note that this assumes that the driver is the only bus master that accesses the registers.
+        """
+        result = []
+        known_values: dict[int, int] = {}
+
+        for entry in trace.entries:
+            if entry.offset not in self._registers:
+                continue
+
+            register_name, register = self._registers[entry.offset]
+
+            if entry.is_write:
+                if register.mode in ["r_w", "w"]:
+                    if known_values.get(entry.offset) == entry.value:
+                        result.append(
+                            RedundantAccess(
+                                entry=entry,
+                                register_name=register_name,
+                                reason="Write of unchanged value",
+                            )
+                        )
+
+                    known_values[entry.offset] = entry.value
+
+            elif register.mode == "r_w":
+                if entry.offset in known_values:
+                    result.append(
+                        RedundantAccess(
+                            entry=entry,
+                            register_name=register_name,
+                            reason="Read of already known value",
+                        )
+                    )
+
+                known_values[entry.offset] = entry.value
+
+        return result
+
+    def replay(
+        self,
+        trace: Trace,
+        mapping: Optional[Union[bytearray, memoryview]] = None,
+        realtime: bool = False,
+    ) -> ReplayTiming:
+        """
+        Perform the register accesses of the trace again, in the same order and with the
+        same values.
+
+        Arguments:
+            trace: The accesses to replay.
+            mapping: Memory where offset zero is the lowest base address of the system.
+                Can be a memory mapping of the real registers, e.g. an ``mmap.mmap`` object of
+                ``/dev/mem``, or ``/dev/uio*``.
+                Default is an in-memory register model, i.e. a zero-initialized ``bytearray``
+                that covers all the register lists.
+            realtime: Wait between accesses so that they are made with the same timing as
+                when recorded.
+                Default is to make the accesses as fast as possible.
+
+        Return:
+            The timing of the replay, compared to when the trace was recorded.
+        """
+        if not trace.entries:
+            return ReplayTiming(
+                num_accesses=0, recorded_duration_ns=0, replay_duration_ns=0, max_lag_ns=0
+            )
+
+        memory = memoryview(bytearray(self.size) if mapping is None else mapping).cast("B")
+        registers = memory.cast("I")
+
+        first_timestamp_ns = trace.entries[0].timestamp_ns
+        max_lag_ns = 0
+
+        start_ns = time.perf_counter_ns()
+
+        for entry in trace.entries:
+            if realtime:
+                target_ns = start_ns + entry.timestamp_ns - first_timestamp_ns
+                while (now_ns := time.perf_counter_ns()) < target_ns:
+                    pass
+                max_lag_ns = max(max_lag_ns, now_ns - target_ns)
+
+            if entry.is_write:
+                registers[entry.offset // REGISTER_SIZE_BYTES] = entry.value
+            else:
+                registers[
+                    entry.offset // REGISTER_SIZE_BYTES
+                ]  # pylint: disable=pointless-statement
+
+        end_ns = time.perf_counter_ns()
+
+        return ReplayTiming(
+            num_accesses=len(trace.entries),
+            recorded_duration_ns=trace.entries[-1].timestamp_ns - first_timestamp_ns,
+            replay_duration_ns=end_ns - start_ns,
+            max_lag_ns=max_lag_ns,
+        )
+
+    def get_report(self, trace: Trace, timing: Optional[ReplayTiming] = None) -> str:
+        """
+        Get a human-readable summary of the trace: access counts, redundant accesses and,
+        if given, the replay timing.
+        """
+        num_writes = sum(1 for entry in trace.entries if entry.is_write)
+        threads = {entry.thread for entry in trace.entries}
+
+        result = (
+            f"{len(trace.entries)} accesses ({len(trace.entries) - num_writes} reads, "
+            f"{num_writes} writes) from {len(threads)} threads.\n"
+        )
+        if trace.num_overwritten:
+            result += (
+                f"{trace.num_overwritten} older accesses were overwritten in the ring buffer.\n"
+            )
+
+        result += "\nAccesses per register:\n"
+        for name, count in self.get_access_counts(trace=trace).most_common():
+            result += f"  {count:>8}  {name}\n"
+
+        redundant_accesses = self.find_redundant_accesses(trace=trace)
+        result += f"\n{len(redundant_accesses)} redundant accesses:\n"
+        for redundant_access in redundant_accesses:
+            entry = redundant_access.entry
+            result += (
+                f"  {entry.timestamp_ns:>14} ns  thread {entry.thread}  "
+                f"{redundant_access.register_name} = 0x{entry.value:08X}  "
+                f"({redundant_access.reason})\n"
+            )
+
+        if timing is not None:
+            result += f"""
+Recorded: {timing.recorded_duration_ns} ns, {timing.recorded_accesses_per_second:.0f} accesses/s.
+Replayed: {timing.replay_duration_ns} ns, {timing.replay_accesses_per_second:.0f} accesses/s.
+"""
+            if timing.max_lag_ns:
+                result += f"Maximum lag behind recorded timing: {timing.max_lag_ns} ns.\n"
+
+        return result
@@ -12,6 +12,7 @@ from pathlib import Path
 from typing import TYPE_CHECKING, Any
 
 # First party libraries
+from hdl_registers.constant.array_constant import ArrayConstant
 from hdl_registers.constant.bit_vector_constant import UnsignedVectorConstant
 from hdl_registers.constant.boolean_constant import BooleanConstant
 from hdl_registers.constant.float_constant import FloatConstant
@@ -34,7 +35,7 @@ class HtmlConstantTableGenerator(HtmlGeneratorCommon):
     See the :ref:`generator_html` article for usage details.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "1.1.0"
 
     SHORT_DESCRIPTION = "HTML constant table"
 
@@ -91,6 +92,9 @@ class HtmlConstantTableGenerator(HtmlGeneratorCommon):
             return f'"{constant.value}"'
 
         # For others, just cast to string.
+        if isinstance(constant, ArrayConstant):
+            return f"[{', '.join(str(element) for element in constant.value)}]"
+
         if isinstance(constant, (BooleanConstant, IntegerConstant, FloatConstant)):
             return str(constant.value)
 
@@ -26,7 +26,7 @@ class HtmlPageGenerator(HtmlGeneratorCommon):
     See the :ref:`generator_html` article for usage details.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "1.1.0"
 
     SHORT_DESCRIPTION = "HTML page"
 
@@ -46,16 +46,7 @@ class HtmlPageGenerator(HtmlGeneratorCommon):
 {self.header}
 <!DOCTYPE html>
 <html>
-<head>
-  <title>{title}</title>
-    <!-- Include the style both inline and as a link to a separate CSS file. -->
-    <!-- Some tools, e.g. Jenkins, will not render with an inline stylesheet. -->
-    <!-- For other tools, e.g. page inclusion in sphinx, the style must be in the file. -->
-    <link rel="stylesheet" href="regs_style.css">
-    <style>
-      {self.get_page_style()}
-    </style>
-</head>
+{self._get_head(title=title)}
 <body>
   <h1>{title}</h1>
   <p>This document is a specification for the register interface of the FPGA module \
@@ -64,19 +55,11 @@ class HtmlPageGenerator(HtmlGeneratorCommon):
   <h2>Register modes</h2>
   <p>The following register modes are available.</p>
 {self._get_mode_descriptions()}
+{self._get_static_description()}\
 """
 
         html += "  <h2>Registers</h2>\n"
-        if self.register_list.register_objects:
-            register_table_generator = HtmlRegisterTableGenerator(
-                register_list=self.register_list, output_folder=self.output_folder
-            )
-            html += f"""
-  <p>The following registers make up the register map.</p>
-{register_table_generator.get_code()}
-"""
-        else:
-            html += "  <p>This module does not have any registers.</p>"
+        html += self._get_registers_section()
 
         html += "  <h2>Constants</h2>\n"
         if self.register_list.constants:
@@ -95,6 +78,31 @@ class HtmlPageGenerator(HtmlGeneratorCommon):
 
         return html
 
+    def _get_head(self, title: str) -> str:
+        return f"""\
+<head>
+  <title>{title}</title>
+    <!-- Include the style both inline and as a link to a separate CSS file. -->
+    <!-- Some tools, e.g. Jenkins, will not render with an inline stylesheet. -->
+    <!-- For other tools, e.g. page inclusion in sphinx, the style must be in the file. -->
+    <link rel="stylesheet" href="regs_style.css">
+    <style>
+      {self.get_page_style()}
+    </style>
+</head>"""
+
+    def _get_registers_section(self) -> str:
+        if self.register_list.register_objects:
+            register_table_generator = HtmlRegisterTableGenerator(
+                register_list=self.register_list, output_folder=self.output_folder
+            )
+            return f"""
+  <p>The following registers make up the register map.</p>
+{register_table_generator.get_code()}
+"""
+
+        return "  <p>This module does not have any registers.</p>"
+
     @staticmethod
     def get_page_style(
         table_style: Optional[str] = None, font_style: Optional[str] = None, extra_style: str = ""
@@ -147,6 +155,17 @@ th {
 {extra_style}"""
         return style
 
+    def _get_static_description(self) -> str:
+        for register, _ in self.iterate_registers():
+            if register.static:
+                return """\
+  <p>Registers marked <em>static</em> have a value that does not change after reset, \
+e.g. an ID or version register.
+  Software may read them once and use a cached value after that.</p>
+"""
+
+        return ""
+
     @staticmethod
     def _get_mode_descriptions() -> str:
         html = """
@@ -0,0 +1,229 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+import hashlib
+from pathlib import Path
+from typing import TYPE_CHECKING, Any
+
+# First party libraries
+from hdl_registers.register import Register
+
+# Local folder libraries
+from .page import HtmlPageGenerator
+from .register_table import HtmlRegisterTableGenerator
+
+if TYPE_CHECKING:
+    # First party libraries
+    from hdl_registers.register_list import RegisterList, RegisterObjectT
+
+
+class HtmlPagedGenerator(HtmlPageGenerator):
+    """
+    Generate HTML register documentation that is split into many pages, with an index page that
+    links to them.
+    Intended for very large register lists, where the single page from :class:`.HtmlPageGenerator`
+    would be slow to generate and to display in a browser.
+    See the :ref:`generator_html` article for usage details.
+
+    The index page, which is the :meth:`.output_file` of this generator, is the same as the page
+    from :class:`.HtmlPageGenerator`, but with a table of the register pages instead of the
+    register table.
+    Each register page contains a register table with a limited number of registers.
+    The register pages are written to file in a stream, one register at a time, so that the whole
+    documentation is never held in memory.
+
+    A register array is documented once, with the array index as a variable, regardless of its
+    length.
+    A register array is never split over two pages.
+    """
+
+    __version__ = "1.0.1"
+
+    SHORT_DESCRIPTION = "paged HTML"
+
+    def __init__(
+        self, register_list: "RegisterList", output_folder: Path, registers_per_page: int = 500
+    ):
+        """
+        For argument description, please see the super class.
+
+        Arguments:
+            registers_per_page: Maximum number of registers on each register page.
+                A register array counts as the number of registers in one array element.
+                A register array that is larger than this will get a page of its own.
+        """
+        super().__init__(register_list=register_list, output_folder=output_folder)
+
+        if registers_per_page < 1:
+            raise ValueError(
+                f'Register list "{self.name}": Invalid "registers_per_page" value: '
+                f"{registers_per_page}."
+            )
+
+        self.registers_per_page = registers_per_page
+
+    @property
+    def output_file(self) -> Path:
+        """
+        The index page will be placed in this file.
+        """
+        return self.output_folder / f"{self.name}_regs_index.html"
+
+    def get_page_file(self, page_index: int) -> Path:
+        """
+        The register page with the given index will be placed in this file.
+        """
+        return self.output_folder / f"{self.name}_regs_page_{page_index}.html"
+
+    def get_pages(self) -> list[list["RegisterObjectT"]]:
+        """
+        Get the plain registers and register arrays that shall be documented on each page.
+        """
+        pages: list[list["RegisterObjectT"]] = []
+
+        page: list["RegisterObjectT"] = []
+        num_registers_on_page = 0
+
+        for register_object in self.iterate_register_objects():
+            num_registers = (
+                1 if isinstance(register_object, Register) else len(register_object.registers)
+            )
+
+            if page and num_registers_on_page + num_registers > self.registers_per_page:
+                pages.append(page)
+
+                page = []
+                num_registers_on_page = 0
+
+            page.append(register_object)
+            num_registers_on_page += num_registers
+
+        if page:
+            pages.append(page)
+
+        return pages
+
+    @property
+    def should_create(self) -> bool:
+        """
+        Same as for the super class, but will also be ``True`` if any of the register pages
+        is missing.
+        """
+        if super().should_create:
+            return True
+
+        num_pages = len(self.get_pages())
+        return not all(self.get_page_file(page_index).exists() for page_index in range(num_pages))
+
+    def _calculate_register_list_hash(self) -> str:
+        """
+        Hash of the register list as well as the number of registers per page, since the latter
+        decides how the registers are split over the pages.
+        """
+        return hashlib.sha1(
+            f"{self.register_list.object_hash}{self.registers_per_page}".encode()
+        ).hexdigest()
+
+    def create(self, **kwargs: Any) -> Path:
+        """
+        Create the index page as well as all the register pages.
+        See super class for details.
+        Any register pages left over from a previous run with more pages will be deleted.
+        """
+        output_file = super().create(**kwargs)
+
+        pages = self.get_pages()
+        # Same header for all pages.
+        # Calculated only once since it requires a traversal of the whole register list.
+        header = self.header
+
+        for page_index, page in enumerate(pages):
+            self._write_page(page_index=page_index, page=page, header=header)
+
+        page_files = {self.get_page_file(page_index) for page_index in range(len(pages))}
+        for stale_file in self.output_folder.glob(f"{self.name}_regs_page_*.html"):
+            if stale_file not in page_files:
+                stale_file.unlink()
+
+        return output_file
+
+    def _get_registers_section(self) -> str:
+        pages = self.get_pages()
+        if pages:
+            return f"""
+  <p>The registers are documented on the following pages.</p>
+{self._get_page_table(pages=pages)}
+"""
+
+        return "  <p>This module does not have any registers.</p>"
+
+    def _get_page_table(self, pages: list[list["RegisterObjectT"]]) -> str:
+        html = """\
+<table>
+<thead>
+  <tr>
+    <th>Page</th>
+    <th>First register</th>
+    <th>Last register</th>
+    <th>Registers</th>
+  </tr>
+</thead>
+<tbody>"""
+
+        for page_index, page in enumerate(pages):
+            page_file_name = self.get_page_file(page_index).name
+            num_registers = sum(
+                1 if isinstance(register_object, Register) else len(register_object.registers)
+                for register_object in page
+            )
+
+            html += f"""
+  <tr>
+    <td><a href="{page_file_name}">Page {page_index}</a></td>
+    <td>{page[0].name}</td>
+    <td>{page[-1].name}</td>
+    <td>{num_registers}</td>
+  </tr>"""
+
+        html += """
+</tbody>
+</table>"""
+
+        return html
+
+    def _write_page(self, page_index: int, page: list["RegisterObjectT"], header: str) -> None:
+        register_table_generator = HtmlRegisterTableGenerator(
+            register_list=self.register_list, output_folder=self.output_folder
+        )
+
+        title = f"Documentation of {self.name} registers, page {page_index}"
+        index_file_name = self.output_file.name
+
+        with open(self.get_page_file(page_index), "w", encoding="utf-8") as file_handle:
+            file_handle.write(f"""\
+{header}
+<!DOCTYPE html>
+<html>
+{self._get_head(title=title)}
+<body>
+  <h1>{title}</h1>
+  <p>Back to <a href="{index_file_name}">index</a>.</p>
+{register_table_generator.table_start}""")
+
+            for register_object in page:
+                file_handle.write(
+                    register_table_generator.get_register_object_rows(
+                        register_object=register_object
+                    )
+                )
+
+            file_handle.write(f"""{register_table_generator.table_end}
+</body>
+</html>""")
@@ -24,7 +24,7 @@ if TYPE_CHECKING:
     # First party libraries
     from hdl_registers.field.register_field import RegisterField
     from hdl_registers.register_array import RegisterArray
-    from hdl_registers.register_list import RegisterList
+    from hdl_registers.register_list import RegisterList, RegisterObjectT
 
 
 class HtmlRegisterTableGenerator(HtmlGeneratorCommon):
@@ -33,7 +33,7 @@ class HtmlRegisterTableGenerator(HtmlGeneratorCommon):
     See the :ref:`generator_html` article for usage details.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "1.2.0"
 
     SHORT_DESCRIPTION = "HTML register table"
 
@@ -53,8 +53,21 @@ class HtmlRegisterTableGenerator(HtmlGeneratorCommon):
         if not self.register_list.register_objects:
             return ""
 
-        html = f"""\
-{self.header}
+        html = f"{self.header}\n{self.table_start}"
+
+        for register_object in self.iterate_register_objects():
+            html += self.get_register_object_rows(register_object=register_object)
+
+        html += self.table_end
+
+        return html
+
+    @property
+    def table_start(self) -> str:
+        """
+        HTML code that starts the register table, including the table head.
+        """
+        return """\
 <table>
 <thead>
   <tr>
@@ -68,17 +81,25 @@ class HtmlRegisterTableGenerator(HtmlGeneratorCommon):
 </thead>
 <tbody>"""
 
-        for register_object in self.iterate_register_objects():
-            if isinstance(register_object, Register):
-                html += self._annotate_register(register_object)
-            else:
-                html += self._annotate_register_array(register_object)
-
-        html += """
+    @property
+    def table_end(self) -> str:
+        """
+        HTML code that ends the register table.
+        """
+        return """
 </tbody>
 </table>"""
 
-        return html
+    def get_register_object_rows(self, register_object: "RegisterObjectT") -> str:
+        """
+        Get the table rows for a plain register or a register array.
+        A register array is documented once, with the array index as a variable, regardless of its
+        length.
+        """
+        if isinstance(register_object, Register):
+            return self._annotate_register(register_object)
+
+        return self._annotate_register_array(register_object)
 
     @staticmethod
     def _to_hex_string(value: int, num_nibbles: int = 4) -> str:
@@ -93,16 +114,24 @@ class HtmlRegisterTableGenerator(HtmlGeneratorCommon):
 
     def _annotate_register_array(self, register_object: "RegisterArray") -> str:
         description = self._html_translator.translate(register_object.description)
+
+        padding = ""
+        num_unused = register_object.num_padding_registers + register_object.num_alignment_registers
+        if num_unused:
+            padding = f"""
+      Padded to a stride of {register_object.stride} registers, \
+leaving {num_unused} register addresses unused."""
+
         html = f"""
   <tr>
     <td class="array_header" colspan=5>
       Register array <strong>{register_object.name}</strong>, \
 repeated {register_object.length} times.
-      Iterator <i>i &isin; [0, {register_object.length - 1}].</i>
+      Iterator <i>i &isin; [0, {register_object.length - 1}].</i>{padding}
     </td>
     <td class="array_header">{description}</td>
   </tr>"""
-        array_index_increment = len(register_object.registers)
+        array_index_increment = register_object.stride
         for register in register_object.registers:
             register_index = register_object.base_index + register.index
             html += self._annotate_register(register, register_index, array_index_increment)
@@ -134,13 +163,17 @@ repeated {register_object.length} times.
 
             index = f"{register_array_index} + i &times; {array_index_increment}"
 
+        mode = REGISTER_MODES[register.mode].mode_readable
+        if register.static:
+            mode += " (static)"
+
         description = self._html_translator.translate(register.description)
         html = f"""
   <tr>
     <td><strong>{register.name}</strong></td>
     <td>{index}</td>
     <td>{address_readable}</td>
-    <td>{REGISTER_MODES[register.mode].mode_readable}</td>
+    <td>{mode}</td>
     <td>{self._to_hex_string(register.default_value, num_nibbles=1)}</td>
     <td>{description}</td>
   </tr>"""
@@ -15,6 +15,7 @@ from tsfpga.system_utils import read_file
 from hdl_registers import HDL_REGISTERS_TESTS
 from hdl_registers.generator.html.constant_table import HtmlConstantTableGenerator
 from hdl_registers.generator.html.page import HtmlPageGenerator
+from hdl_registers.generator.html.paged import HtmlPagedGenerator
 from hdl_registers.generator.html.register_table import HtmlRegisterTableGenerator
 from hdl_registers.parser.toml import from_toml
 
@@ -141,6 +142,50 @@ def test_registers(html_test):
     )
 
 
+def test_static_registers(html_test):
+    static_description = "Registers marked <em>static</em> have a value that does not change"
+    assert static_description not in html_test.create_html_page()
+
+    html_test.register_list.get_register_array("dummies").get_register("second").static = True
+    html = html_test.create_html_page()
+
+    html_test.check_register(
+        name="second",
+        index="8 + i &times; 2",
+        address="0x0020 + i &times; 0x0008",
+        mode="Read (static)",
+        default_value="0xC7",
+        description="The second register in the array.",
+        html=html,
+    )
+    assert static_description in html
+
+
+def test_register_array_with_power_of_two_stride(html_test):
+    register_array = html_test.register_list.append_register_array(
+        name="channels", length=4, description="", power_of_two_stride=True
+    )
+    for name in ["gain", "offset", "status"]:
+        register_array.append_register(name=name, mode="r", description="")
+    html = html_test.create_html_page()
+
+    assert (
+        "Iterator <i>i &isin; [0, 3].</i>\n"
+        "      Padded to a stride of 4 registers, leaving 7 register addresses unused.\n"
+    ) in html
+
+    # Base index 21 is aligned up to 24.
+    html_test.check_register(
+        name="status",
+        index="26 + i &times; 4",
+        address="0x0068 + i &times; 0x0010",
+        mode="Read",
+        default_value="0x0",
+        description="",
+        html=html,
+    )
+
+
 def test_register_fields(html_test):
     """
     Test that all bits show up in the HTML with correct attributes.
@@ -226,6 +271,8 @@ def test_registers_and_constants(html_test):
     html_test.check_constant(name="enabled", value="True", html=html)
     html_test.check_constant(name="disabled", value="False", html=html)
     html_test.check_constant(name="rate", value="3.5", html=html)
+    html_test.check_constant(name="coefficients", value="[3, -1, 0, 7]", html=html)
+    html_test.check_constant(name="calibration", value="[0.5, -1.25]", html=html)
     html_test.check_constant(name="paragraph", value='"hello there :)"', html=html)
 
     # Test again with no constants
@@ -269,3 +316,100 @@ def test_constant_table_is_empty_string_if_no_constants_are_available(html_test)
         HtmlConstantTableGenerator(html_test.register_list, html_test.tmp_path).create()
     )
     assert html == "", html
+
+
+def test_paged_html(html_test):
+    generator = HtmlPagedGenerator(
+        html_test.register_list, html_test.tmp_path, registers_per_page=3
+    )
+    assert [
+        [register_object.name for register_object in page] for page in generator.get_pages()
+    ] == [
+        ["config", "command", "irq_status"],
+        ["status", "address", "current_timestamp"],
+        ["tuser", "dummies"],
+        ["dummies2", "dummies3"],
+        ["dummies4"],
+    ]
+
+    index_html = read_file(generator.create())
+    assert generator.output_file.name == "caesar_regs_index.html"
+
+    assert """
+  <tr>
+    <td><a href="caesar_regs_page_2.html">Page 2</a></td>
+    <td>tuser</td>
+    <td>dummies</td>
+    <td>3</td>
+  </tr>
+""" in index_html, index_html
+    assert "caesar_regs_page_5.html" not in index_html, index_html
+    html_test.check_constant(name="data_width", value=24, html=index_html)
+
+    page_html = read_file(generator.get_page_file(0))
+    html_test.check_register(
+        name="config",
+        index=0,
+        address="0x0000",
+        mode="Read, Write",
+        default_value="0x848E",
+        description="A plain <strong>dummy</strong> register.",
+        html=page_html,
+    )
+    assert '<a href="caesar_regs_index.html">index</a>' in page_html, page_html
+    assert "dummies" not in page_html, page_html
+    assert page_html.endswith("</tbody>\n</table>\n</body>\n</html>")
+
+    page_html = read_file(generator.get_page_file(2))
+    html_test.check_register(
+        name="first",
+        index="7 + i &times; 2",
+        address="0x001C + i &times; 0x0008",
+        mode="Read, Write",
+        default_value="0xB1",
+        description="The first register in the array.",
+        html=page_html,
+    )
+
+
+def test_paged_html_should_create_if_page_is_missing_and_delete_stale_pages(html_test):
+    generator = HtmlPagedGenerator(
+        html_test.register_list, html_test.tmp_path, registers_per_page=3
+    )
+    generator.create()
+    assert not generator.should_create
+
+    generator.get_page_file(1).unlink()
+    assert generator.should_create
+
+    generator = HtmlPagedGenerator(
+        html_test.register_list, html_test.tmp_path, registers_per_page=100
+    )
+    generator.create()
+    assert generator.get_page_file(0).exists()
+    assert not generator.get_page_file(1).exists()
+    assert not generator.get_page_file(4).exists()
+
+
+def test_paged_html_should_create_if_registers_per_page_has_changed(html_test):
+    def create_if_needed(registers_per_page):
+        return HtmlPagedGenerator(
+            html_test.register_list, html_test.tmp_path, registers_per_page=registers_per_page
+        ).create_if_needed()[0]
+
+    assert create_if_needed(registers_per_page=3)
+    assert not create_if_needed(registers_per_page=3)
+    assert html_test.tmp_path.joinpath("caesar_regs_page_1.html").exists()
+
+    assert create_if_needed(registers_per_page=100)
+    assert not create_if_needed(registers_per_page=100)
+    assert not html_test.tmp_path.joinpath("caesar_regs_page_1.html").exists()
+
+
+def test_paged_html_with_invalid_registers_per_page_should_raise_exception(html_test):
+    with pytest.raises(ValueError) as exception_info:
+        HtmlPagedGenerator(html_test.register_list, html_test.tmp_path, registers_per_page=0)
+    assert (
+        str(exception_info.value)
+        == 'Register list "caesar": Invalid "registers_per_page" value: 0.'
+    )
@@ -0,0 +1,551 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+from pathlib import Path
+from typing import TYPE_CHECKING, Any, Optional, Union
+
+# First party libraries
+from hdl_registers.field.bit_vector import BitVector
+from hdl_registers.field.enumeration import Enumeration
+from hdl_registers.field.integer import Integer
+from hdl_registers.field.register_field_type import Fixed, Signed
+from hdl_registers.generator.register_code_generator import RegisterCodeGenerator
+
+if TYPE_CHECKING:
+    # First party libraries
+    from hdl_registers.field.register_field import RegisterField
+    from hdl_registers.register import Register
+    from hdl_registers.register_array import RegisterArray
+
+
+class PythonAccessorGenerator(RegisterCodeGenerator):
+    """
+    Generate a Python class for fast register access.
+    See the :ref:`generator_python` article for usage details.
+
+    The generated module contains:
+
+    * A class with getter and setter methods for each register and each field.
+      Register indexes, shifts and masks are resolved at generation time and inlined as
+      literals, so no lookups of registers or fields by name are made at runtime.
+
+    * A method that reads all bus-readable registers in one call.
+
+    * An ``IntEnum`` class for each enumeration field.
+      The getters and setters of the field return and take members of this class.
+
+    * Backend classes that perform the actual register accesses:
+      memory-mapped file (e.g. a UIO device), in-memory ``bytearray``, or user callbacks.
+
+    The generated module is self-contained and does not depend on ``hdl_registers``.
+    """
+
+    __version__ = "1.2.0"
+
+    SHORT_DESCRIPTION = "Python accessor"
+
+    COMMENT_START = "#"
+
+    DEFAULT_INDENTATION_LEVEL = 4
+
+    @property
+    def output_file(self) -> Path:
+        """
+        Result will be placed in this file.
+        """
+        return self.output_folder / f"{self.name}_accessor.py"
+
+    def get_code(self, **kwargs: Any) -> str:
+        """
+        Get a complete Python module with the accessor class.
+        """
+        class_name = f"{self.to_pascal_case(self.name)}Accessor"
+
+        num_registers = (
+            self.register_list.register_objects[-1].index + 1
+            if self.register_list.register_objects
+            else 0
+        )
+
+        readable_register_indexes = []
+        for register, register_array in self.iterate_registers():
+            if not register.is_bus_readable:
+                continue
+
+            if register_array is None:
+                readable_register_indexes.append(register.index)
+            else:
+                for array_index in range(register_array.length):
+                    readable_register_indexes.append(
+                        register_array.get_start_index(array_index=array_index) + register.index
+                    )
+
+        readable_register_indexes.sort()
+        readable_indexes = repr(tuple(readable_register_indexes))
+
+        methods = ""
+        for register, register_array in self.iterate_registers():
+            methods += self._get_register_methods(register=register, register_array=register_array)
+
+        return f'''\
+{self.header}
+# Standard libraries
+import mmap
+import os
+from enum import IntEnum
+from pathlib import Path
+from typing import Callable, Union
+
+# Number of registers in the '{self.name}' register list.
+NUM_REGISTERS = {num_registers}
+
+{self._get_backends()}\
+{self._get_enumerations()}\
+
+class {class_name}:
+
+    """
+    Register accessor for the '{self.name}' register list.
+
+    Performs register accesses via a backend object, which shall have a ``read(index) -> int``
+    and a ``write(index, value)`` member.
+    For example one of the backend classes in this module.
+    """
+
+    __slots__ = ("_read", "_write")
+
+    # Indexes of all bus-readable registers, plain or in array, in ascending order.
+    # This is the order of the register values returned by the 'snapshot' method.
+    readable_register_indexes = {readable_indexes}
+
+    def __init__(self, backend: Backend):
+        """
+        Arguments:
+            backend: Object that performs the register accesses.
+        """
+        # Save the bound methods, to avoid an attribute lookup on the backend for every access.
+        self._read = backend.read
+        self._write = backend.write
+
+    def snapshot(self) -> tuple[int, ...]:
+        """
+        Read all bus-readable registers.
+
+        Return:
+            The register values, in the order of ``readable_register_indexes``.
+        """
+        return tuple(map(self._read, self.readable_register_indexes))
+{methods}'''
+
+    def _get_backends(self) -> str:
+        return '''\
+
+class BytearrayBackend:
+
+    """
+    Keep register values in memory, in a ``bytearray``.
+    Useful for testing, or when working with register values that have been captured.
+    """
+
+    def __init__(self, num_registers: int = NUM_REGISTERS):
+        """
+        Arguments:
+            num_registers: Size of the memory, in number of 32-bit registers.
+        """
+        self.data = bytearray(4 * num_registers)
+
+        # Use the methods of the memory view directly, to avoid function call overhead.
+        view = memoryview(self.data).cast("I")
+        self.read: Callable[[int], int] = view.__getitem__
+        self.write: Callable[[int, int], None] = view.__setitem__
+
+
+class MemoryMappedBackend:
+
+    """
+    Access registers via a memory map of a file.
+    For example a UIO device file ``/dev/uioN``, ``/dev/mem``, or a regular file.
+
+    Every access is a single 32-bit load or store, in the byte order of the host.
+    """
+
+    def __init__(
+        self, file_path: Union[Path, str], offset: int = 0, num_registers: int = NUM_REGISTERS
+    ):
+        """
+        Arguments:
+            file_path: File to map.
+            offset: Byte offset of the register list within the file.
+                Must be a multiple of ``mmap.ALLOCATIONGRANULARITY``.
+                For a UIO device, map number ``N`` is selected with an offset of
+                ``N * mmap.PAGESIZE``.
+            num_registers: Size of the map, in number of 32-bit registers.
+        """
+        file_descriptor = os.open(file_path, os.O_RDWR | getattr(os, "O_SYNC", 0))
+        try:
+            self._mmap = mmap.mmap(file_descriptor, 4 * num_registers, offset=offset)
+        finally:
+            # The memory map holds its own reference to the file.
+            os.close(file_descriptor)
+
+        # Use the methods of the memory view directly, to avoid function call overhead.
+        self._view = memoryview(self._mmap).cast("I")
+        self.read: Callable[[int], int] = self._view.__getitem__
+        self.write: Callable[[int, int], None] = self._view.__setitem__
+
+    def close(self) -> None:
+        """
+        Release the memory map.
+        Any access after this will raise an exception.
+        """
+        self._view.release()
+        self._mmap.close()
+
+
+class CallbackBackend:
+
+    """
+    Forward register accesses to user-supplied functions.
+    For example a JTAG-to-AXI bridge or a network protocol.
+    """
+
+    def __init__(self, read: Callable[[int], int], write: Callable[[int, int], None]):
+        """
+        Arguments:
+            read: Function that takes a register index and returns the register value.
+            write: Function that takes a register index and a register value.
+        """
+        self.read = read
+        self.write = write
+
+
+Backend = Union[BytearrayBackend, MemoryMappedBackend, CallbackBackend]
+
+'''
+
+    def _get_enumerations(self) -> str:
+        result = ""
+
+        for register, register_array in self.iterate_registers():
+            for field in register.fields:
+                if not isinstance(field, Enumeration):
+                    continue
+
+                field_description = self.field_description(
+                    register=register, register_array=register_array, field=field
+                )
+                elements = "".join(
+                    f"    {element.name} = {element.value}\n" for element in field.elements
+                )
+
+                result += f'''
+class {self._enumeration_class_name(register, register_array, field)}(IntEnum):
+
+    """
+    Elements of the {field_description}.
+    """
+
+{elements}
+'''
+
+        return result
+
+    def _enumeration_class_name(
+        self,
+        register: "Register",
+        register_array: Optional["RegisterArray"],
+        field: "RegisterField",
+    ) -> str:
+        # No need to qualify with the register list name, since the module provides the scope.
+        names = [register.name, field.name]
+        if register_array is not None:
+            names.insert(0, register_array.name)
+
+        return self.to_pascal_case("_".join(names))
+
+    def _get_register_methods(
+        self, register: "Register", register_array: Optional["RegisterArray"]
+    ) -> str:
+        register_description = self.register_description(
+            register=register, register_array=register_array
+        )
+        result = f"""
+{self.get_separator_line()}\
+{self.comment(f"Methods for the {register_description}.")}\
+"""
+
+        method_name = "_".join(
+            [register_array.name, register.name] if register_array else [register.name]
+        )
+
+        if register_array:
+            index = (
+                f"{register_array.base_index + register.index} + "
+                f"{register_array.stride} * array_index"
+            )
+            arguments = "self, array_index: int"
+            index_check = f"""\
+        if not 0 <= array_index < {register_array.length}:
+            raise ValueError(f"Register array index out of range: {{array_index}}.")
+"""
+        else:
+            index = str(register.index)
+            arguments = "self"
+            index_check = ""
+
+        if register.is_bus_readable:
+            result += f'''
+    def get_{method_name}({arguments}) -> int:
+        """
+        Read the {register_description}.
+        """
+{index_check}\
+        return self._read({index})
+'''
+
+            for field in register.fields:
+                result += self._get_field_getters(
+                    register=register,
+                    register_array=register_array,
+                    field=field,
+                    method_name=f"{method_name}_{field.name}",
+                    index=index,
+                    arguments=arguments,
+                    index_check=index_check,
+                )
+
+        if register.is_bus_writeable:
+            result += f'''
+    def set_{method_name}({arguments}, register_value: int) -> None:
+        """
+        Write the {register_description}.
+        """
+{index_check}\
+        self._write({index}, register_value)
+'''
+
+            for field in register.fields:
+                result += self._get_field_setters(
+                    register=register,
+                    register_array=register_array,
+                    field=field,
+                    method_name=f"{method_name}_{field.name}",
+                    index=index,
+                    arguments=arguments,
+                    index_check=index_check,
+                )
+
+        return result
+
+    def _get_field_getters(
+        self,
+        register: "Register",
+        register_array: Optional["RegisterArray"],
+        field: "RegisterField",
+        method_name: str,
+        index: str,
+        arguments: str,
+        index_check: str,
+    ) -> str:  # pylint: disable=too-many-arguments
+        field_description = self.field_description(
+            register=register, register_array=register_array, field=field
+        )
+        return_type = self._get_field_value_type(
+            register=register, register_array=register_array, field=field
+        )
+        decode = self._get_field_decode(
+            register=register, register_array=register_array, field=field
+        )
+
+        return f'''
+    def get_{method_name}({arguments}) -> {return_type}:
+        """
+        Read the {field_description}.
+        """
+{index_check}\
+        register_value = self._read({index})
+{decode}
+    @staticmethod
+    def get_{method_name}_from_value(register_value: int) -> {return_type}:
+        """
+        Get the value of the {field_description},
+        given a register value.
+        """
+{decode}'''
+
+    def _get_field_setters(
+        self,
+        register: "Register",
+        register_array: Optional["RegisterArray"],
+        field: "RegisterField",
+        method_name: str,
+        index: str,
+        arguments: str,
+        index_check: str,
+    ) -> str:  # pylint: disable=too-many-arguments
+        field_description = self.field_description(
+            register=register, register_array=register_array, field=field
+        )
+        value_type = self._get_field_value_type(
+            register=register, register_array=register_array, field=field
+        )
+
+        if self.field_setter_should_read_modify_write(register=register):
+            current_value_comment = "Read the register to get the current value of other fields."
+            current_value = f"self._read({index})"
+        else:
+            current_value_comment = "Set all other fields to their default value."
+            current_value = str(register.default_value)
+
+        check = self._get_field_check(field=field)
+        encode = self._get_field_encode(field=field)
+
+        return f'''
+    def set_{method_name}({arguments}, field_value: {value_type}) -> None:
+        """
+        Write the {field_description}.
+        """
+{index_check}\
+{check}\
+        # {current_value_comment}
+        register_value = {current_value}
+{encode}\
+        self._write({index}, register_value)
+
+    @staticmethod
+    def set_{method_name}_from_value(register_value: int, field_value: {value_type}) -> int:
+        """
+        Get the register value with the {field_description} updated.
+        """
+{check}\
+{encode}\
+        return register_value
+'''
+
+    def _get_field_value_type(
+        self,
+        register: "Register",
+        register_array: Optional["RegisterArray"],
+        field: "RegisterField",
+    ) -> str:
+        if isinstance(field, Enumeration):
+            return self._enumeration_class_name(
+                register=register, register_array=register_array, field=field
+            )
+
+        return "float" if self._is_fixed_point(field=field) else "int"
+
+    @staticmethod
+    def _is_fixed_point(field: "RegisterField") -> bool:
+        return isinstance(field, BitVector) and isinstance(field.field_type, Fixed)
+
+    @staticmethod
+    def _is_signed(field: "RegisterField") -> bool:
+        if isinstance(field, Integer):
+            return field.is_signed
+
+        if isinstance(field, BitVector):
+            if isinstance(field.field_type, Signed):
+                return True
+
+            if isinstance(field.field_type, Fixed):
+                return field.field_type.is_signed
+
+        return False
+
+    def _get_field_decode(
+        self,
+        register: "Register",
+        register_array: Optional["RegisterArray"],
+        field: "RegisterField",
+    ) -> str:
+        """
+        Statements that return the field value, given a 'register_value' variable.
+        """
+        shift = f" >> {field.base_index}" if field.base_index else ""
+        mask = f"0b{'1' * field.width}"
+        value = f"(register_value{shift}) & {mask}" if shift else f"register_value & {mask}"
+
+        if isinstance(field, Enumeration):
+            # Raises 'ValueError' if the value is not one of the elements.
+            enumeration_class = self._enumeration_class_name(
+                register=register, register_array=register_array, field=field
+            )
+            return f"        return {enumeration_class}({value})\n"
+
+        if not self._is_signed(field=field) and not self._is_fixed_point(field=field):
+            return f"        return {value}\n"
+
+        result = f"        field_value = {value}\n"
+        if self._is_signed(field=field):
+            sign_bit = f"0b1{'0' * (field.width - 1)}"
+            result += f"""\
+        # Sign extend.
+        field_value -= (field_value & {sign_bit}) << 1
+"""
+
+        if self._is_fixed_point(field=field):
+            scale = 2.0**-field.field_type.fraction_bit_width  # type: ignore[attr-defined]
+            return f"{result}        return field_value * {scale!r}\n"
+
+        return f"{result}        return field_value\n"
+
+    @staticmethod
+    def _get_field_check(field: "RegisterField") -> str:
+        """
+        Statement that checks that a 'field_value' variable is a legal value for the field.
+        """
+        if isinstance(field, Enumeration):
+            element_values = ", ".join(str(element.value) for element in field.elements)
+
+            return f"""\
+        if field_value not in {{{element_values}}}:
+            raise ValueError(f'Value for field "{field.name}" is not an element: {{field_value}}.')
+"""
+
+        min_value: Union[int, float]
+        max_value: Union[int, float]
+        if isinstance(field, Integer):
+            min_value, max_value = field.min_value, field.max_value
+        else:
+            min_value = field.field_type.min_value(bit_width=field.width)
+            max_value = field.field_type.max_value(bit_width=field.width)
+
+        return f"""\
+        if not {min_value!r} <= field_value <= {max_value!r}:
+            raise ValueError(
+                f'Value for field "{field.name}" out of range {min_value!r} to {max_value!r}: \
+{{field_value}}.'
+            )
+"""
+
+    def _get_field_encode(self, field: "RegisterField") -> str:
+        """
+        Statement that updates a 'register_value' variable with a 'field_value'.
+        """
+        mask_at_base = (1 << field.width) - 1
+        mask_shifted_inverse = 0xFFFFFFFF & ~(mask_at_base << field.base_index)
+
+        if self._is_fixed_point(field=field):
+            scale = 2**field.field_type.fraction_bit_width  # type: ignore[attr-defined]
+            field_value = f"round(field_value * {scale})"
+        else:
+            field_value = "field_value"
+
+        if self._is_signed(field=field):
+            # Masking gives the two's complement representation of negative values.
+            field_value = f"({field_value} & 0b{'1' * field.width})"
+
+        shift = f" << {field.base_index}" if field.base_index else ""
+
+        return f"""\
+        register_value = (register_value & {hex(mask_shifted_inverse)}) | \
+{field_value}{shift}
+"""
@@ -8,25 +8,40 @@
 # --------------------------------------------------------------------------------------------------
 
 # Standard libraries
-import pickle
+import math
 from pathlib import Path
-from typing import Any
-
-# Third party libraries
-from tsfpga.system_utils import create_directory
+from typing import TYPE_CHECKING, Any, Iterator, Union
 
 # First party libraries
+from hdl_registers.constant.bit_vector_constant import UnsignedVectorConstant
+from hdl_registers.field.bit import Bit
+from hdl_registers.field.bit_vector import BitVector
+from hdl_registers.field.enumeration import Enumeration
+from hdl_registers.field.integer import Integer
+from hdl_registers.field.register_field_type import Fixed, Unsigned
 from hdl_registers.generator.register_code_generator import RegisterCodeGenerator
-from hdl_registers.register_list import RegisterList
+from hdl_registers.register import Register
+
+if TYPE_CHECKING:
+    # First party libraries
+    from hdl_registers.field.register_field import RegisterField
+    from hdl_registers.programming_sequence import ProgrammingSequence
 
 
 class PythonClassGenerator(RegisterCodeGenerator):
     """
     Generate a Python class with register definitions.
     See the :ref:`generator_python` article for usage details.
+
+    The generated Python file recreates the :class:`.RegisterList` object with calls to the
+    normal, public, register list API.
+    Hence there is no serialization format that has to match between the version of
+    hdl-registers that generated the file and the version that loads it.
+    The artifact is one single file, which can take part in the normal
+    :meth:`.should_create` version/hash check.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "3.0.0"
 
     SHORT_DESCRIPTION = "Python class"
 
@@ -39,45 +54,33 @@ class PythonClassGenerator(RegisterCodeGenerator):
         """
         return self.output_folder / f"{self.name}.py"
 
-    def __init__(self, register_list: RegisterList, output_folder: Path):
-        super().__init__(register_list=register_list, output_folder=output_folder)
-
-        self.pickle_file = self.output_folder / f"{self.name}.pickle"
-
-    def create(self, **kwargs: Any) -> Path:
-        """
-        Create the binary pickle also, apart from the class file.
-
-        Note that this is a little bit hacky, preferably each generator should produce only
-        one file.
-        """
-        # Create directory if it does not exist, but do not delete anything if it does.
-        create_directory(self.output_folder, empty=False)
-
-        with self.pickle_file.open("wb") as file_handle:
-            pickle.dump(self.register_list, file_handle)
-
-        return super().create(**kwargs)
-
     def get_code(self, **kwargs: Any) -> str:
         """
-        Save register list object to binary file (pickle) and create a python class
-        that recreates it.
+        Get Python code that recreates the register list object.
         """
         class_name = self.to_pascal_case(self.name)
 
+        # Gathered while creating the code, so that only the classes that are used are imported.
+        # Module name and the class names that are imported from it.
+        imports = {"hdl_registers.register_list": {"RegisterList"}}
+        create_code = "".join(f"    {line}\n" for line in self._get_create_lines(imports=imports))
+        import_code = "".join(
+            f"from {module} import {', '.join(sorted(imports[module]))}\n"
+            for module in sorted(imports)
+        )
+
+        standard_imports = "from typing import Optional\n"
+        if self.register_list.source_definition_file is not None:
+            standard_imports = f"from pathlib import Path\n{standard_imports}"
+
         return f'''\
 {self.header}
 # Standard libraries
-import pickle
-from pathlib import Path
-from typing import TYPE_CHECKING
-
-if TYPE_CHECKING:
-    # Third party libraries
-    from hdl_registers.register_list import RegisterList
-
-THIS_DIR = Path(__file__).parent
+{standard_imports}
+# Third party libraries
+{import_code}
+# Created on first use, and then re-used for the lifetime of the process.
+_register_list: Optional[RegisterList] = None
 
 
 class {class_name}:
@@ -88,27 +91,192 @@ class {class_name}:
 
     def __new__(cls):
         """
-        Recreate the RegisterList object from binary pickle.
+        Get the RegisterList object.
+        See :func:`get_register_list` for details.
         """
-        with (THIS_DIR / "{self.pickle_file.name}").open("rb") as file_handle:
-            return pickle.load(file_handle)
+        return get_register_list()
 
 
-def get_register_list() -> "RegisterList":
+def get_register_list() -> RegisterList:
     """
     Return a RegisterList object with the registers/constants from the '{self.name}' module.
-    Recreated from a Python pickle file.
+
+    The object is created on the first call, and the same object is then returned on each call
+    for the remainder of the process.
+    It must not be modified by the caller.
+    Use :func:`create_register_list` to get an object that can be modified.
     """
-    return {class_name}()
+    global _register_list  # pylint: disable=global-statement
+
+    if _register_list is None:
+        _register_list = create_register_list()
+
+    return _register_list
+
+
+def create_register_list() -> RegisterList:
+    """
+    Create a new RegisterList object with the registers/constants from the '{self.name}' module.
+    The object belongs to the caller, and may be modified.
+    """
+{create_code}\
 '''
 
-    @property
-    def should_create(self) -> bool:
+    def _get_create_lines(self, imports: dict[str, set[str]]) -> Iterator[str]:
+        source_definition_file = self.register_list.source_definition_file
+        source_definition_file_code = (
+            "None" if source_definition_file is None else f"Path({str(source_definition_file)!r})"
+        )
+        yield (
+            f"register_list = RegisterList(name={self.register_list.name!r}, "
+            f"source_definition_file={source_definition_file_code})"
+        )
+
+        for register_object in self.register_list.register_objects:
+            if isinstance(register_object, Register):
+                yield from self._get_register_lines(
+                    register=register_object, parent="register_list", imports=imports
+                )
+            else:
+                yield (
+                    "register_array = register_list.append_register_array("
+                    f"name={register_object.name!r}, "
+                    f"length={register_object.length}, "
+                    f"description={register_object.description!r}, "
+                    f"power_of_two_stride={register_object.power_of_two_stride})"
+                )
+
+                for register in register_object.registers:
+                    yield from self._get_register_lines(
+                        register=register, parent="register_array", imports=imports
+                    )
+
+        for constant in self.register_list.constants:
+            if isinstance(constant, UnsignedVectorConstant):
+                imports.setdefault("hdl_registers.constant.bit_vector_constant", set()).add(
+                    "UnsignedVector"
+                )
+                value = f"UnsignedVector({constant.prefix + constant.value!r})"
+            else:
+                value = self._to_literal(constant.value)
+
+            yield (
+                f"register_list.add_constant(name={constant.name!r}, value={value}, "
+                f"description={constant.description!r})"
+            )
+
+        for register_pair in self.register_list.register_pairs:
+            yield (
+                f"register_list.add_register_pair(name={register_pair.name!r}, "
+                f"low={register_pair.low!r}, high={register_pair.high!r}, "
+                f"description={register_pair.description!r})"
+            )
+
+        for programming_sequence in self.register_list.programming_sequences:
+            yield from self._get_programming_sequence_lines(
+                programming_sequence=programming_sequence
+            )
+
+        yield "return register_list"
+
+    def _get_register_lines(
+        self, register: Register, parent: str, imports: dict[str, set[str]]
+    ) -> Iterator[str]:
+        append_call = (
+            f"{parent}.append_register(name={register.name!r}, "
+            f"mode={register.mode!r}, description={register.description!r})"
+        )
+        if not (register.fields or register.commits or register.static):
+            yield append_call
+            return
+
+        yield f"register = {append_call}"
+
+        for field in register.fields:
+            yield f"register.{self._get_append_field_call(field=field, imports=imports)}"
+
+        if register.commits:
+            yield f"register.commits = {list(register.commits)!r}"
+
+        if register.static:
+            yield "register.static = True"
+
+    def _get_append_field_call(self, field: "RegisterField", imports: dict[str, set[str]]) -> str:
+        common = f"name={field.name!r}, description={field.description!r}"
+
+        if isinstance(field, Bit):
+            return f"append_bit({common}, default_value={field.default_value!r})"
+
+        if isinstance(field, BitVector):
+            result = (
+                f"append_bit_vector({common}, width={field.width}, "
+                f"default_value={field.default_value!r}"
+            )
+
+            field_type = field.field_type
+            if not isinstance(field_type, Unsigned):
+                type_name = type(field_type).__name__
+                imports.setdefault("hdl_registers.field.register_field_type", set()).add(type_name)
+
+                arguments = (
+                    f"max_bit_index={field_type.max_bit_index}, "
+                    f"min_bit_index={field_type.min_bit_index}"
+                    if isinstance(field_type, Fixed)
+                    else ""
+                )
+                result += f", field_type={type_name}({arguments})"
+
+            return f"{result})"
+
+        if isinstance(field, Enumeration):
+            elements = {element.name: element.description for element in field.elements}
+            return (
+                f"append_enumeration({common}, elements={elements!r}, "
+                f"default_value={field.default_value.name!r})"
+            )
+
+        if isinstance(field, Integer):
+            return (
+                f"append_integer({common}, min_value={field.min_value}, "
+                f"max_value={field.max_value}, default_value={field.default_value})"
+            )
+
+        raise TypeError(f'Got unknown field type: "{field}".')
+
+    def _get_programming_sequence_lines(
+        self, programming_sequence: "ProgrammingSequence"
+    ) -> Iterator[str]:
+        yield (
+            "programming_sequence = register_list.add_programming_sequence("
+            f"name={programming_sequence.name!r}, "
+            f"description={programming_sequence.description!r})"
+        )
+
+        for step in programming_sequence.steps:
+            if step.action == "delay":
+                yield f"programming_sequence.append_delay(microseconds={step.value!r})"
+                continue
+
+            arguments = f"register={step.register!r}, value={self._to_literal(step.value)}"
+            if step.field is not None:
+                arguments += f", field={step.field!r}"
+            if step.register_array is not None:
+                arguments += (
+                    f", register_array={step.register_array!r}, array_index={step.array_index!r}"
+                )
+
+            yield f"programming_sequence.append_{step.action}({arguments})"
+
+    @staticmethod
+    def _to_literal(value: Union[bool, float, int, str, list[int], list[float]]) -> str:
         """
-        Since this generator creates two files, where on is binary, it is impossible to do the
-        version/hash check.
-        Hence, set it to "always create".
-        The mechanism "create if needed" should not be used for this generator anyway, since
-        this generator is not designed to run in real-time like e.g. the VHDL generator.
+        Python code for a constant or programming sequence value.
         """
-        return True
+        if isinstance(value, list):
+            return f"[{', '.join(PythonClassGenerator._to_literal(item) for item in value)}]"
+
+        # The representation of e.g. infinity is not valid Python code.
+        if isinstance(value, float) and not math.isfinite(value):
+            return f'float("{value}")'
+
+        return repr(value)
@@ -0,0 +1,275 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+import random
+import sys
+
+# Third party libraries
+import pytest
+from tsfpga.system_utils import load_python_module
+
+# First party libraries
+from hdl_registers import HDL_REGISTERS_TESTS
+from hdl_registers.field.enumeration import Enumeration
+from hdl_registers.field.integer import Integer
+from hdl_registers.field.register_field_type import Signed, SignedFixedPoint, UnsignedFixedPoint
+from hdl_registers.generator.python.accessor import PythonAccessorGenerator
+from hdl_registers.parser.toml import from_toml
+
+
+@pytest.fixture
+def register_list():
+    register_list = from_toml(name="caesar", toml_file=HDL_REGISTERS_TESTS / "regs_test.toml")
+
+    register = register_list.append_register(name="numbers", mode="r_w", description="")
+    register.append_bit_vector(
+        name="sfixed",
+        description="",
+        width=10,
+        default_value="0" * 10,
+        field_type=SignedFixedPoint(max_bit_index=3, min_bit_index=-6),
+    )
+    register.append_bit_vector(
+        name="ufixed",
+        description="",
+        width=8,
+        default_value="0" * 8,
+        field_type=UnsignedFixedPoint(max_bit_index=5, min_bit_index=-2),
+    )
+    register.append_bit_vector(
+        name="sint", description="", width=7, default_value="0" * 7, field_type=Signed()
+    )
+
+    return register_list
+
+
+def get_accessor(register_list, output_folder):
+    PythonAccessorGenerator(register_list=register_list, output_folder=output_folder).create()
+    module = load_python_module(output_folder / "caesar_accessor.py")
+
+    backend = module.BytearrayBackend()
+    return module, backend, module.CaesarAccessor(backend)
+
+
+def iterate_fields(register_list):
+    for register_object in register_list.register_objects:
+        if hasattr(register_object, "registers"):
+            for register in register_object.registers:
+                for field in register.fields:
+                    method_name = f"{register_object.name}_{register.name}"
+                    yield method_name, register, register_object, field
+        else:
+            for field in register_object.fields:
+                yield register_object.name, register_object, None, field
+
+
+def get_random_field_value(field):
+    if isinstance(field, Enumeration):
+        return random.choice(field.elements).value
+
+    if isinstance(field, Integer):
+        return random.randint(field.min_value, field.max_value)
+
+    min_value = field.field_type.min_value(bit_width=field.width)
+    max_value = field.field_type.max_value(bit_width=field.width)
+    if isinstance(min_value, int):
+        return random.randint(min_value, max_value)
+
+    resolution = 2**-field.field_type.fraction_bit_width
+    return random.randint(round(min_value / resolution), round(max_value / resolution)) * resolution
+
+
+def to_field_value(field, value):
+    if isinstance(field, Enumeration):
+        return value.value
+
+    return value
+
+
+def set_field_value(field, field_value):
+    if isinstance(field, Enumeration):
+        return field.set_value(field.get_element_by_value(field_value))
+
+    return field.set_value(field_value)
+
+
+def test_from_value_methods_match_field_conversion(register_list, tmp_path):
+    module, _, _ = get_accessor(register_list=register_list, output_folder=tmp_path)
+    accessor_class = module.CaesarAccessor
+
+    for method_name, register, _, field in iterate_fields(register_list=register_list):
+        for _ in range(20):
+            register_value = random.randint(0, 2**32 - 1)
+
+            # Replace the field bits with a legal field value, since 'get_value' checks the range.
+            mask = ((1 << field.width) - 1) << field.base_index
+            register_value = (register_value & ~mask) | set_field_value(
+                field=field, field_value=get_random_field_value(field=field)
+            )
+
+            if register.is_bus_readable:
+                get_from_value = getattr(
+                    accessor_class, f"get_{method_name}_{field.name}_from_value"
+                )
+                assert get_from_value(register_value) == to_field_value(
+                    field=field, value=field.get_value(register_value)
+                )
+
+            if register.is_bus_writeable:
+                field_value = get_random_field_value(field=field)
+                set_from_value = getattr(
+                    accessor_class, f"set_{method_name}_{field.name}_from_value"
+                )
+
+                assert set_from_value(register_value, field_value) == (
+                    (register_value & ~mask) | set_field_value(field=field, field_value=field_value)
+                )
+
+
+def test_field_setters_and_getters(register_list, tmp_path):
+    _, backend, accessor = get_accessor(register_list=register_list, output_folder=tmp_path)
+
+    for method_name, register, register_array, field in iterate_fields(register_list=register_list):
+        if not (register.is_bus_readable and register.is_bus_writeable):
+            continue
+
+        arguments = [] if register_array is None else [register_array.length - 1]
+        field_value = get_random_field_value(field=field)
+
+        getattr(accessor, f"set_{method_name}_{field.name}")(*arguments, field_value)
+        assert getattr(accessor, f"get_{method_name}_{field.name}")(*arguments) == field_value
+
+        index = register.index
+        if register_array is not None:
+            index += register_array.get_start_index(array_index=register_array.length - 1)
+
+        register_value = backend.read(index)
+        assert to_field_value(field=field, value=field.get_value(register_value)) == field_value
+
+
+def test_field_setter_keeps_other_fields_in_read_write_register(register_list, tmp_path):
+    _, backend, accessor = get_accessor(register_list=register_list, output_folder=tmp_path)
+    config = register_list.get_register("config")
+
+    accessor.set_config(0xFFFFFFFF)
+    accessor.set_config_plain_bit_a(0)
+    assert backend.read(config.index) == 0xFFFFFFFE
+
+
+def test_field_setter_uses_default_value_in_pulse_register(register_list, tmp_path):
+    _, backend, accessor = get_accessor(register_list=register_list, output_folder=tmp_path)
+    command = register_list.get_register("command")
+
+    backend.write(command.index, 0xFFFFFFFF)
+    accessor.set_command_abort(1)
+    assert backend.read(command.index) == command.default_value | 0b10
+
+
+def test_register_array_index(register_list, tmp_path):
+    _, backend, accessor = get_accessor(register_list=register_list, output_folder=tmp_path)
+    register_array = register_list.get_register_array("dummies")
+    register = register_array.get_register("first")
+
+    for array_index in range(register_array.length):
+        index = register_array.get_start_index(array_index=array_index) + register.index
+
+        accessor.set_dummies_first(array_index, array_index + 100)
+        assert backend.read(index) == array_index + 100
+        assert accessor.get_dummies_first(array_index) == array_index + 100
+
+    with pytest.raises(ValueError) as exception_info:
+        accessor.get_dummies_first(register_array.length)
+    assert str(exception_info.value) == "Register array index out of range: 3."
+
+
+def test_field_value_out_of_range_should_raise_exception(register_list, tmp_path):
+    _, _, accessor = get_accessor(register_list=register_list, output_folder=tmp_path)
+
+    with pytest.raises(ValueError) as exception_info:
+        accessor.set_config_plain_integer(101)
+    assert (
+        str(exception_info.value) == 'Value for field "plain_integer" out of range -50 to 100: 101.'
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        accessor.set_numbers_sint(-65)
+    assert str(exception_info.value) == 'Value for field "sint" out of range -64 to 63: -65.'
+
+
+def test_enumeration(register_list, tmp_path):
+    module, backend, accessor = get_accessor(register_list=register_list, output_folder=tmp_path)
+    enumeration = module.ConfigPlainEnumeration
+
+    accessor.set_config_plain_enumeration(enumeration.fourth)
+    value = accessor.get_config_plain_enumeration()
+    assert value is enumeration.fourth
+    assert enumeration.fourth == 3
+
+    value = accessor.get_config_plain_enumeration_from_value(backend.read(0))
+    assert value is enumeration.fourth
+
+    # The field is three bits wide, but the elements are not all values in that range.
+    element_values = [element.value for element in enumeration]
+    assert 6 not in element_values
+
+    with pytest.raises(ValueError) as exception_info:
+        accessor.set_config_plain_enumeration(6)
+    assert str(exception_info.value) == 'Value for field "plain_enumeration" is not an element: 6.'
+
+    with pytest.raises(ValueError):
+        accessor.get_config_plain_enumeration_from_value(6 << 6)
+
+
+def test_snapshot(register_list, tmp_path):
+    _, backend, accessor = get_accessor(register_list=register_list, output_folder=tmp_path)
+
+    for index in range(len(backend.data) // 4):
+        backend.write(index, index * 7)
+
+    readable_register_indexes = accessor.readable_register_indexes
+    assert accessor.snapshot() == tuple(index * 7 for index in readable_register_indexes)
+
+    config = register_list.get_register("config")
+    address = register_list.get_register("address")
+    assert config.index in readable_register_indexes
+    assert address.index not in readable_register_indexes
+
+
+def test_memory_mapped_backend(register_list, tmp_path):
+    module, _, _ = get_accessor(register_list=register_list, output_folder=tmp_path)
+
+    data_file = tmp_path / "data.bin"
+    data_file.write_bytes(bytes(4 * module.NUM_REGISTERS))
+
+    backend = module.MemoryMappedBackend(file_path=data_file)
+    accessor = module.CaesarAccessor(backend)
+    accessor.set_config(0x12345678)
+    assert accessor.get_config() == 0x12345678
+    backend.close()
+
+    index = register_list.get_register("config").index
+    assert data_file.read_bytes()[4 * index : 4 * index + 4] == (0x12345678).to_bytes(
+        4, byteorder=sys.byteorder
+    )
+
+
+def test_callback_backend(register_list, tmp_path):
+    module, _, _ = get_accessor(register_list=register_list, output_folder=tmp_path)
+
+    accesses = []
+    backend = module.CallbackBackend(
+        read=lambda index: accesses.append(("read", index)) or 5,
+        write=lambda index, value: accesses.append(("write", index, value)),
+    )
+    accessor = module.CaesarAccessor(backend)
+
+    config_index = register_list.get_register("config").index
+    accessor.set_config_plain_bit_b(0)
+    assert accesses == [("read", config_index), ("write", config_index, 5 & ~0b10)]
@@ -8,16 +8,23 @@
 # --------------------------------------------------------------------------------------------------
 
 # Third party libraries
+import pytest
 from tsfpga.system_utils import load_python_module
 
 # First party libraries
 from hdl_registers import HDL_REGISTERS_TESTS
+from hdl_registers.field.register_field_type import Signed, SignedFixedPoint, UnsignedFixedPoint
 from hdl_registers.generator.python.python_class import PythonClassGenerator
 from hdl_registers.parser.toml import from_toml
+from hdl_registers.register_list import RegisterList
 
 
-def test_recreating_register_list_object(tmp_path):
-    register_list = from_toml(name="caesar", toml_file=HDL_REGISTERS_TESTS / "regs_test.toml")
+@pytest.fixture
+def register_list():
+    return from_toml(name="caesar", toml_file=HDL_REGISTERS_TESTS / "regs_test.toml")
+
+
+def test_recreating_register_list_object(tmp_path, register_list):
     PythonClassGenerator(register_list, tmp_path).create()
 
     test_recreated = load_python_module(tmp_path / "caesar.py").Caesar()
@@ -25,3 +32,108 @@ def test_recreating_register_list_object(tmp_path):
 
     test_recreated = load_python_module(tmp_path / "caesar.py").get_register_list()
     assert repr(test_recreated) == repr(register_list)
+
+    test_recreated = load_python_module(tmp_path / "caesar.py").create_register_list()
+    assert repr(test_recreated) == repr(register_list)
+
+
+def test_recreating_register_list_object_with_all_features(tmp_path, register_list):
+    config = register_list.get_register("config")
+    config.append_bit_vector(
+        name="signed_vector", description="", width=3, default_value="101", field_type=Signed()
+    )
+    config.append_bit_vector(
+        name="ufixed",
+        description="",
+        width=4,
+        default_value="1010",
+        field_type=UnsignedFixedPoint(max_bit_index=1, min_bit_index=-2),
+    )
+    config.append_bit_vector(
+        name="sfixed",
+        description="A\nmultiline 'quoted' \"description\".",
+        width=4,
+        default_value="0110",
+        field_type=SignedFixedPoint(max_bit_index=-1, min_bit_index=-4),
+    )
+
+    register_list.get_register("command").commits = ["config", "address"]
+
+    version = register_list.append_register(name="version", mode="r", description="")
+    version.static = True
+
+    register_list.append_register(name="counter_low", mode="r", description="")
+    register_list.append_register(name="counter_high", mode="r", description="")
+    register_list.add_register_pair(
+        name="counter", low="counter_low", high="counter_high", description="Counter"
+    )
+
+    register_list.add_constant(name="infinity", value=float("inf"), description="")
+
+    sequence = register_list.add_programming_sequence(name="init", description="Initialize")
+    sequence.append_write(register="config", value=3)
+    sequence.append_write(register="config", field="plain_enumeration", value="fifth")
+    sequence.append_delay(microseconds=10)
+    sequence.append_wait(
+        register="first",
+        value=1,
+        field="array_bit_vector",
+        register_array="dummies",
+        array_index=1,
+    )
+
+    PythonClassGenerator(register_list, tmp_path).create()
+    module = load_python_module(tmp_path / "caesar.py")
+
+    assert module.create_register_list().object_hash == register_list.object_hash
+
+
+def test_recreating_register_list_object_without_source_definition_file(tmp_path):
+    register_list = RegisterList(name="caesar")
+    register_list.append_register(name="config", mode="r_w", description="")
+
+    PythonClassGenerator(register_list, tmp_path).create()
+    code = (tmp_path / "caesar.py").read_text(encoding="utf-8")
+    assert "Path" not in code
+
+    test_recreated = load_python_module(tmp_path / "caesar.py").create_register_list()
+    assert repr(test_recreated) == repr(register_list)
+
+
+def test_only_one_file_is_created(tmp_path, register_list):
+    PythonClassGenerator(register_list, tmp_path).create()
+
+    assert [path.name for path in tmp_path.iterdir()] == ["caesar.py"]
+
+
+def test_same_register_list_object_is_returned_on_each_call(tmp_path, register_list):
+    PythonClassGenerator(register_list, tmp_path).create()
+    module = load_python_module(tmp_path / "caesar.py")
+
+    first = module.get_register_list()
+    assert module.get_register_list() is first
+    assert module.Caesar() is first
+
+
+def test_new_register_list_object_is_created_on_each_call(tmp_path, register_list):
+    PythonClassGenerator(register_list, tmp_path).create()
+    module = load_python_module(tmp_path / "caesar.py")
+
+    first = module.create_register_list()
+    first.get_register("config").append_bit(name="new", description="", default_value="0")
+
+    second = module.create_register_list()
+    assert second is not first
+    assert second is not module.get_register_list()
+    assert repr(second) == repr(register_list)
+
+
+def test_should_create_only_when_register_list_has_changed(tmp_path, register_list):
+    generator = PythonClassGenerator(register_list, tmp_path)
+    assert generator.should_create
+
+    generator.create()
+    assert not generator.should_create
+
+    register_list.append_register(name="new", mode="r", description="")
+    assert generator.should_create
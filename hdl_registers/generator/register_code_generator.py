@@ -12,7 +12,7 @@ import datetime
 import re
 from abc import ABC, abstractmethod
 from pathlib import Path
-from typing import TYPE_CHECKING, Any, Union
+from typing import TYPE_CHECKING, Any, Optional, Union
 
 # Third party libraries
 from tsfpga.git_utils import get_git_commit, git_commands_are_available
@@ -21,15 +21,29 @@ from tsfpga.system_utils import create_file, read_file
 
 # First party libraries
 from hdl_registers import __version__ as hdl_registers_version
+from hdl_registers.register import Register
 
 # Local folder libraries
-from .register_code_generator_helpers import RegisterCodeGeneratorHelpers
+from .register_code_generator_helpers import QualifiedNameTableT, RegisterCodeGeneratorHelpers
 from .reserved_keywords import RESERVED_KEYWORDS
 
 if TYPE_CHECKING:
     # First party libraries
+    from hdl_registers.register_array import RegisterArray
     from hdl_registers.register_list import RegisterList
 
+# Result of the sanity check, i.e. error messages and qualified name table, keyed by register list
+# hash, reserved keyword set and generator class.
+# Shared between all generator objects of the same class, so that the check is done only once when
+# the same generator is run many times on the same register list.
+# The generator class is part of the key since a generator may override the methods that format
+# the qualified names.
+_SANITY_CHECK_CACHE: dict[
+    tuple[str, frozenset[str], type], tuple[list[str], QualifiedNameTableT]
+] = {}
+# Oldest results will be dropped when the cache grows beyond this size.
+_SANITY_CHECK_CACHE_MAX_SIZE = 64
+
 
 class RegisterCodeGenerator(ABC, RegisterCodeGeneratorHelpers):
 
@@ -132,6 +146,10 @@ class RegisterCodeGenerator(ABC, RegisterCodeGeneratorHelpers):
 
         self.name = register_list.name
 
+        # Hash of the register list, calculated once at the start of 'create'.
+        # Will be 'None' outside of 'create', since the register list might be modified.
+        self._register_list_hash: Optional[str] = None
+
     def create(self, **kwargs: Any) -> Path:
         """
         Generate the result artifact.
@@ -149,9 +167,16 @@ class RegisterCodeGenerator(ABC, RegisterCodeGeneratorHelpers):
 
         print(f"Creating {self.SHORT_DESCRIPTION} file: {output_file}")
 
-        self._sanity_check()
+        # Used by the sanity check as well as in the file header.
+        # Calculated only once since it requires a traversal of the whole register list.
+        self._register_list_hash = self._calculate_register_list_hash()
+        try:
+            self._sanity_check()
 
-        code = self.get_code(**kwargs)
+            code = self.get_code(**kwargs)
+        finally:
+            self._register_list_hash = None
+            self._qualified_name_table = None
 
         # Will create the containing folder unless it already exists.
         create_file(file=output_file, contents=code)
@@ -213,12 +238,19 @@ class RegisterCodeGenerator(ABC, RegisterCodeGeneratorHelpers):
         if (
             hdl_registers_version,
             self.__version__,
-            self.register_list.object_hash,
+            self._calculate_register_list_hash(),
         ) != self._find_versions_and_hash_of_existing_file(file_path=output_file):
             return True
 
         return False
 
+    def _calculate_register_list_hash(self) -> str:
+        """
+        Hash of the register information that the generated artifact is based on.
+        Overload in a subclass that bases its artifact on more than :meth:`.register_list`.
+        """
+        return self.register_list.object_hash
+
     def _find_versions_and_hash_of_existing_file(
         self, file_path: Path
     ) -> tuple[Union[None, str], Union[None, str], Union[None, str]]:
@@ -303,13 +335,14 @@ class RegisterCodeGenerator(ABC, RegisterCodeGeneratorHelpers):
             ),
             f"Code generator {self.__class__.__name__} version {self.__version__}.",
             info,
-            f"Register hash {self.register_list.object_hash}.",
+            f"Register hash {self._register_list_hash or self._calculate_register_list_hash()}.",
         ]
 
     def _sanity_check(self) -> None:
         """
         Do some basic checks that no naming errors are present.
         Will raise exception if there is any error.
+        All errors that are found are listed in the same exception, not only the first one.
 
         In general, the user will know if these errors are present when the generated code is
         compiled/used since it will probably crash.
@@ -319,167 +352,324 @@ class RegisterCodeGenerator(ABC, RegisterCodeGeneratorHelpers):
         We run this check at creation time, always and for every single generator.
         Hence the user will hopefully get warned when they generate e.g. a VHDL package at the start
         of the FPGA build that a register uses a reserved C++ name.
-        This check takes roughly 140 us on a decent computer with a typical register list.
-        Hence it is not a big deal that it might be run more than once for each register list.
+        All checks are done in one traversal of the register list.
+        The result is cached by register list hash and generator class, so when the same generator
+        is run many times on the same register list, the traversal is done only once.
+        The qualified names that are calculated in the traversal are saved in a table that is
+        used by :meth:`.qualified_register_name` and :meth:`.qualified_field_name`.
 
         It is better to have it here in the generator rather than in the parser:
         1. Here it runs only when necessary, not adding time to parsing which is often done in
            real time.
         2. We also catch things that were added with the Python API.
         """
-        self._check_reserved_keywords()
-        self._check_for_name_clashes()
+        register_list_hash = self._register_list_hash or self._calculate_register_list_hash()
+        cache_key = (register_list_hash, RESERVED_KEYWORDS, type(self))
+
+        if cache_key not in _SANITY_CHECK_CACHE:
+            if len(_SANITY_CHECK_CACHE) >= _SANITY_CHECK_CACHE_MAX_SIZE:
+                # Dictionaries are ordered, so this is the oldest result.
+                del _SANITY_CHECK_CACHE[next(iter(_SANITY_CHECK_CACHE))]
 
-    def _check_reserved_keywords(self) -> None:
+            _SANITY_CHECK_CACHE[cache_key] = self._get_sanity_check_errors()
+
+        errors, self._qualified_name_table = _SANITY_CHECK_CACHE[cache_key]
+        if errors:
+            raise ValueError(
+                "\n".join(f'Error in register list "{self.name}": {error}' for error in errors)
+            )
+
+    def _get_sanity_check_errors(self) -> tuple[list[str], QualifiedNameTableT]:
         """
-        Check that no item in the register list matches a reserved keyword in any of the targeted
-        generator languages.
+        Check, in one traversal of the register list, that
+        * no item matches a reserved keyword in any of the targeted generator languages,
+        * there are no duplicate constant, register, register array or field names,
+        * no register array has the same name as a plain register,
+        * there are no name clashes when names of registers and fields are qualified.
+          The register 'apa_hest' will give a conflict with the field 'apa.hest' since both will
+          get e.g. a VHDL simulation method 'read_apa_hest'.
+        * double-buffered registers and their commit registers are valid.
+
         To minimize the risk that a generated artifact does not compile.
+        A duplicated item will not also be reported as a qualified name clash.
+
+        Return:
+            A message for each error that was found, empty list if there are no errors.
+            And the qualified name of each register and field.
         """
+        errors = []
+        qualified_name_table: QualifiedNameTableT = {}
 
-        def check(name: str, description: str) -> None:
+        def check_keyword(name: str, description: str) -> None:
             if name.lower() in RESERVED_KEYWORDS:
-                message = (
-                    f'Error in register list "{self.name}": '
-                    f'{description} name "{name}" is a reserved keyword.'
-                )
-                raise ValueError(message)
+                errors.append(f'{description} name "{name}" is a reserved keyword.')
 
+        constant_names = set()
         for constant in self.register_list.constants:
-            check(name=constant.name, description="Constant")
+            check_keyword(name=constant.name, description="Constant")
+
+            if constant.name in constant_names:
+                errors.append(f'Duplicate constant name "{constant.name}".')
+
+            constant_names.add(constant.name)
+
+        plain_register_names = set()
+        register_array_names = set()
+        qualified_names = set()
 
-        for register, _ in self.iterate_registers():
-            check(name=register.name, description="Register")
+        def check_register(
+            register: Register, register_array: Optional["RegisterArray"], is_duplicate: bool
+        ) -> None:
+            check_keyword(name=register.name, description="Register")
 
+            array_name = None if register_array is None else register_array.name
+            register_description = (
+                f"{array_name}.{register.name}" if register_array else register.name
+            )
+
+            register_name = self._format_qualified_register_name(
+                array_name=array_name, register_name=register.name
+            )
+
+            if not is_duplicate:
+                qualified_name_table[(array_name, register.name)] = register_name
+
+                if register_name in qualified_names:
+                    errors.append(
+                        f'Qualified name of register "{register_description}" '
+                        f'("{register_name}") clashes with another item.'
+                    )
+
+                qualified_names.add(register_name)
+
+            if register.static and register.mode != "r":
+                errors.append(
+                    f'Static register "{register_description}" must have mode "r", '
+                    f'not "{register.mode}".'
+                )
+
+            field_names = set()
             for field in register.fields:
-                check(name=field.name, description="Field")
+                check_keyword(name=field.name, description="Field")
 
-        for register_array in self.iterate_register_arrays():
-            check(name=register_array.name, description="Register array")
+                if field.name in field_names:
+                    errors.append(
+                        f'Duplicate field name "{field.name}" in register "{register_description}".'
+                    )
+                elif not is_duplicate:
+                    field_name = f"{register_name}_{field.name}"
+                    qualified_name_table[(array_name, register.name, field.name)] = field_name
 
-    def _check_for_name_clashes(self) -> None:
-        """
-        Check that there are no name clashes between items in the register list.
-        To minimize the risk that a generated artifact does not compile.
-        """
-        self._check_for_constant_name_clashes()
-        self._check_for_top_level_name_clashes()
-        self._check_for_field_name_clashes()
-        self._check_for_qualified_name_clashes()
+                    if field_name in qualified_names:
+                        errors.append(
+                            f'Qualified name of field "{register_description}.{field.name}" '
+                            f'("{field_name}") clashes with another item.'
+                        )
 
-    def _check_for_constant_name_clashes(self) -> None:
-        """
-        Check that there are no constants with the same name.
-        """
-        constant_names = set()
-        for constant in self.register_list.constants:
-            if constant.name in constant_names:
-                message = (
-                    f'Error in register list "{self.name}": '
-                    f'Duplicate constant name "{constant.name}".'
+                    qualified_names.add(field_name)
+
+                field_names.add(field.name)
+
+        for register_object in self.register_list.register_objects:
+            if isinstance(register_object, Register):
+                is_duplicate = register_object.name in plain_register_names
+                if is_duplicate:
+                    errors.append(f'Duplicate plain register name "{register_object.name}".')
+                elif register_object.name in register_array_names:
+                    errors.append(
+                        f'Register array "{register_object.name}" may not have same name as '
+                        "register."
+                    )
+
+                plain_register_names.add(register_object.name)
+
+                check_register(
+                    register=register_object, register_array=None, is_duplicate=is_duplicate
                 )
-                raise ValueError(message)
 
-            constant_names.add(constant.name)
+            else:
+                is_duplicate = register_object.name in register_array_names
+                if is_duplicate:
+                    errors.append(f'Duplicate register array name "{register_object.name}".')
+                elif register_object.name in plain_register_names:
+                    errors.append(
+                        f'Register array "{register_object.name}" may not have same name as '
+                        "register."
+                    )
 
-    def _check_for_top_level_name_clashes(self) -> None:
-        """
-        Check that there are no
-        * duplicate register names,
-        * duplicate register array names,
-        * register array names that clash with register names.
+                register_array_names.add(register_object.name)
+
+                for register in register_object.registers:
+                    check_register(
+                        register=register,
+                        register_array=register_object,
+                        is_duplicate=is_duplicate,
+                    )
+
+                check_keyword(name=register_object.name, description="Register array")
+
+        errors += self._get_double_buffer_errors()
+        errors += self._get_register_pair_errors(
+            qualified_names=qualified_names, register_array_names=register_array_names
+        )
+        errors += self._get_programming_sequence_errors()
+
+        return errors, qualified_name_table
+
+    def _get_register_pair_errors(
+        self, qualified_names: set[str], register_array_names: set[str]
+    ) -> list[str]:
         """
-        plain_register_names = set()
-        for register in self.iterate_plain_registers():
-            if register.name in plain_register_names:
-                message = (
-                    f'Error in register list "{self.name}": '
-                    f'Duplicate plain register name "{register.name}".'
+        Check that each register pair consists of two plain registers, where the high register is
+        directly after the low register, aligned to 64 bits.
+
+        Arguments:
+            qualified_names: Qualified names of all registers and fields.
+            register_array_names: Names of all register arrays.
+        """
+        errors = []
+
+        registers = {
+            register_object.name: register_object
+            for register_object in self.register_list.register_objects
+            if isinstance(register_object, Register)
+        }
+        pair_names = set()
+
+        for register_pair in self.register_list.register_pairs:
+            if register_pair.name in pair_names:
+                errors.append(f'Duplicate register pair name "{register_pair.name}".')
+            elif (
+                self._format_qualified_register_name(
+                    array_name=None, register_name=register_pair.name
+                )
+                in qualified_names
+                or register_pair.name in register_array_names
+            ):
+                errors.append(
+                    f'Name of register pair "{register_pair.name}" clashes with another item.'
                 )
-                raise ValueError(message)
 
-            plain_register_names.add(register.name)
+            pair_names.add(register_pair.name)
 
-        register_array_names = set()
-        for register_array in self.iterate_register_arrays():
-            if register_array.name in register_array_names:
-                message = (
-                    f'Error in register list "{self.name}": '
-                    f'Duplicate register array name "{register_array.name}".'
+            missing = [
+                name for name in [register_pair.low, register_pair.high] if name not in registers
+            ]
+            for name in missing:
+                errors.append(
+                    f'Register pair "{register_pair.name}" refers to "{name}", which is not a '
+                    "plain register in the register list."
                 )
-                raise ValueError(message)
+            if missing:
+                continue
 
-            if register_array.name in plain_register_names:
-                message = (
-                    f'Error in register list "{self.name}": '
-                    f'Register array "{register_array.name}" may not have same name as register.'
+            low = registers[register_pair.low]
+            high = registers[register_pair.high]
+
+            if high.index != low.index + 1:
+                errors.append(
+                    f'Register pair "{register_pair.name}" must have high register "{high.name}" '
+                    f'directly after low register "{low.name}".'
+                )
+            elif low.index % 2 != 0:
+                # On a 64-bit register bus, only a pair with the low register at an even index
+                # is held by one single bus word, and can be accessed in one bus transaction.
+                errors.append(
+                    f'Register pair "{register_pair.name}" must have low register "{low.name}" '
+                    "at an even index, so that the pair is aligned to 64 bits."
+                )
+
+            is_readable = low.is_bus_readable and high.is_bus_readable
+            is_writeable = low.is_bus_writeable and high.is_bus_writeable
+            if not (is_readable or is_writeable):
+                errors.append(
+                    f'Register pair "{register_pair.name}" must have registers that are both '
+                    "readable or both writeable by the bus."
                 )
-                raise ValueError(message)
 
-            register_array_names.add(register_array.name)
+        return errors
 
-    def _check_for_field_name_clashes(self) -> None:
+    def _get_programming_sequence_errors(self) -> list[str]:
         """
-        Check that no register contains fields with the same name.
+        Check that each programming sequence has a unique name and can be compiled, i.e. that
+        each step refers to an existing register and field, with a valid value.
         """
-        for register, register_array in self.iterate_registers():
-            field_names = set()
+        errors = []
+        sequence_names = set()
 
-            for field in register.fields:
-                if field.name in field_names:
-                    register_description = (
-                        f"{register_array.name}.{register.name}"
-                        if register_array
-                        else register.name
-                    )
-                    message = (
-                        f'Error in register list "{self.name}": '
-                        f'Duplicate field name "{field.name}" in register "{register_description}".'
-                    )
-                    raise ValueError(message)
+        for programming_sequence in self.register_list.programming_sequences:
+            if programming_sequence.name in sequence_names:
+                errors.append(f'Duplicate programming sequence name "{programming_sequence.name}".')
+            sequence_names.add(programming_sequence.name)
 
-                field_names.add(field.name)
+            try:
+                programming_sequence.compile(register_list=self.register_list)
+            except ValueError as exception:
+                errors.append(str(exception))
 
-    def _check_for_qualified_name_clashes(self) -> None:
-        """
-        Check that there are no name clashes when names of registers and fields are qualified.
+        return errors
 
-        The register 'apa_hest' will give a conflict with the field 'apa.hest' since both will get
-        e.g. a VHDL simulation method 'read_apa_hest'.
-        Hence we need to check for these conflicts.
+    def _get_double_buffer_errors(self) -> list[str]:
         """
-        qualified_names = set()
+        Check that commit registers of double-buffered registers are plain registers of a
+        write-pulse mode, and that each double-buffered item is a plain register or register
+        array with only registers of a mode that the bus writes to fabric.
+        """
+        errors = []
 
-        for register, register_array in self.iterate_registers():
-            register_name = self.qualified_register_name(
-                register=register, register_array=register_array
-            )
-            register_description = (
-                f"{register_array.name}.{register.name}" if register_array else register.name
-            )
+        register_objects = {
+            register_object.name: register_object
+            for register_object in self.register_list.register_objects
+        }
+        committed_by: dict[str, str] = {}
 
-            if register_name in qualified_names:
-                message = (
-                    f'Error in register list "{self.name}": '
-                    f'Qualified name of register "{register_description}" '
-                    f'("{register_name}") clashes with another item.'
-                )
-                raise ValueError(message)
+        for register_object in self.register_list.register_objects:
+            if not isinstance(register_object, Register):
+                for register in register_object.registers:
+                    if register.commits:
+                        errors.append(
+                            f'Register "{register_object.name}.{register.name}" in a register '
+                            "array may not commit double-buffered registers."
+                        )
 
-            qualified_names.add(register_name)
+                continue
 
-            for field in register.fields:
-                field_name = self.qualified_field_name(
-                    register=register, register_array=register_array, field=field
+            if not register_object.commits:
+                continue
+
+            if register_object.mode not in ["wpulse", "r_wpulse"]:
+                errors.append(
+                    f'Register "{register_object.name}" commits double-buffered registers, and '
+                    f'must have mode "wpulse" or "r_wpulse", not "{register_object.mode}".'
                 )
 
-                if field_name in qualified_names:
-                    field_description = f"{register_description}.{field.name}"
-                    message = (
-                        f'Error in register list "{self.name}": '
-                        f'Qualified name of field "{field_description}" '
-                        f'("{field_name}") clashes with another item.'
+            for name in register_object.commits:
+                if name in committed_by:
+                    errors.append(
+                        f'Double-buffered "{name}" is committed by both register '
+                        f'"{committed_by[name]}" and register "{register_object.name}".'
                     )
-                    raise ValueError(message)
+                    continue
 
-                qualified_names.add(field_name)
+                committed_by[name] = register_object.name
+
+                if name not in register_objects:
+                    errors.append(
+                        f'Register "{register_object.name}" commits "{name}", which is not a '
+                        "plain register or register array in the register list."
+                    )
+                    continue
+
+                committed = register_objects[name]
+                registers = [committed] if isinstance(committed, Register) else committed.registers
+                for register in registers:
+                    if register.mode not in ["r_w", "w"]:
+                        register_description = (
+                            register.name if register is committed else f"{name}.{register.name}"
+                        )
+                        errors.append(
+                            f'Double-buffered register "{register_description}" must have mode '
+                            f'"r_w" or "w", not "{register.mode}".'
+                        )
+
+        return errors
@@ -8,6 +8,7 @@
 # --------------------------------------------------------------------------------------------------
 
 # Standard libraries
+import functools
 from typing import TYPE_CHECKING, Iterator, Optional, Union
 
 # First party libraries
@@ -18,7 +19,15 @@ if TYPE_CHECKING:
     # First party libraries
     from hdl_registers.constant.constant import Constant
     from hdl_registers.field.register_field import RegisterField
+    from hdl_registers.programming_sequence import ProgrammingSequence, SequenceEntry
     from hdl_registers.register_list import RegisterList
+    from hdl_registers.register_pair import RegisterPair
+
+# Qualified names of registers and fields.
+# Registers are keyed by '(register array name, register name)', and fields by
+# '(register array name, register name, field name)'.
+# The register array name is 'None' for plain registers.
+QualifiedNameTableT = dict[tuple[Optional[str], ...], str]
 
 
 class RegisterCodeGeneratorHelpers:
@@ -33,6 +42,12 @@ class RegisterCodeGeneratorHelpers:
     COMMENT_START: str
     COMMENT_END: str
 
+    # Precomputed qualified names of all registers and fields in the register list.
+    # Set by the sanity check in RegisterCodeGenerator, and shared between all generators of the
+    # same register list.
+    # If it is not set, or does not contain the requested item, names will be formatted on demand.
+    _qualified_name_table: Optional[QualifiedNameTableT] = None
+
     def iterate_constants(self) -> Iterator["Constant"]:
         """
         Iterate of all constants in the register list.
@@ -79,6 +94,41 @@ class RegisterCodeGeneratorHelpers:
             if isinstance(register_object, RegisterArray):
                 yield register_object
 
+    def iterate_register_pairs(self) -> Iterator[tuple["RegisterPair", Register, Register]]:
+        """
+        Iterate over all register pairs in the register list.
+
+        Return:
+            The register pair, its low register and its high register.
+        """
+        registers = {
+            register_object.name: register_object
+            for register_object in self.register_list.register_objects
+            if isinstance(register_object, Register)
+        }
+
+        for register_pair in self.register_list.register_pairs:
+            yield (
+                register_pair,
+                registers[register_pair.low],
+                registers[register_pair.high],
+            )
+
+    def iterate_programming_sequences(
+        self,
+    ) -> Iterator[tuple["ProgrammingSequence", list["SequenceEntry"]]]:
+        """
+        Iterate over all programming sequences in the register list.
+
+        Return:
+            The programming sequence and its compiled entries.
+        """
+        for programming_sequence in self.register_list.programming_sequences:
+            yield (
+                programming_sequence,
+                programming_sequence.compile(register_list=self.register_list),
+            )
+
     def qualified_register_name(
         self, register: "Register", register_array: Optional["RegisterArray"] = None
     ) -> str:
@@ -86,10 +136,22 @@ class RegisterCodeGeneratorHelpers:
         Get the qualified register name, e.g. "<module name>_<register name>".
         To be used where the scope requires it, i.e. outside of records.
         """
-        if register_array is None:
-            return f"{self.name}_{register.name}"
+        array_name = None if register_array is None else register_array.name
+
+        if self._qualified_name_table is not None:
+            qualified_name = self._qualified_name_table.get((array_name, register.name))
+            if qualified_name is not None:
+                return qualified_name
+
+        return self._format_qualified_register_name(
+            array_name=array_name, register_name=register.name
+        )
+
+    def _format_qualified_register_name(self, array_name: Optional[str], register_name: str) -> str:
+        if array_name is None:
+            return f"{self.name}_{register_name}"
 
-        return f"{self.name}_{register_array.name}_{register.name}"
+        return f"{self.name}_{array_name}_{register_name}"
 
     def qualified_register_array_name(self, register_array: "RegisterArray") -> str:
         """
@@ -108,6 +170,17 @@ class RegisterCodeGeneratorHelpers:
         Get the qualified field name, e.g. "<module name>_<register name>_<field_name>".
         To be used where the scope requires it, i.e. outside of records.
         """
+        # The table is built from the default qualified register name, so it can not be used if a
+        # subclass has changed how register names are qualified.
+        if self._qualified_name_table is not None and (
+            type(self).qualified_register_name
+            is RegisterCodeGeneratorHelpers.qualified_register_name
+        ):
+            array_name = None if register_array is None else register_array.name
+            qualified_name = self._qualified_name_table.get((array_name, register.name, field.name))
+            if qualified_name is not None:
+                return qualified_name
+
         register_name = self.qualified_register_name(
             register=register, register_array=register_array
         )
@@ -178,10 +251,15 @@ class RegisterCodeGeneratorHelpers:
         """
         Get a comment describing the field.
         """
-        register_description = self.register_description(
-            register=register, register_array=register_array
+        # Same as using 'register_description', but formatted in one go since this is called
+        # many times for each field.
+        if register_array is None:
+            return f"'{field.name}' field in the '{register.name}' register"
+
+        return (
+            f"'{field.name}' field in the '{register.name}' register "
+            f"within the '{register_array.name}' register array"
         )
-        return f"'{field.name}' field in the {register_description}"
 
     @staticmethod
     def field_setter_should_read_modify_write(register: Register) -> bool:
@@ -204,11 +282,14 @@ class RegisterCodeGeneratorHelpers:
         raise ValueError(f"Got non-writeable register: {register}")
 
     @staticmethod
+    @functools.lru_cache(maxsize=4096)
     def to_pascal_case(snake_string: str) -> str:
         """
         Converts e.g., "my_funny_string" to "MyFunnyString".
 
         Pascal case is like camel case but with the initial character being capitalized.
         I.e. how classes are named in Python, C and C++.
+
+        Result is cached since this is typically called with the same names many times.
         """
         return snake_string.title().replace("_", "")
@@ -0,0 +1,256 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+from typing import TYPE_CHECKING, Optional
+
+# First party libraries
+from hdl_registers.field.bit import Bit
+from hdl_registers.field.bit_vector import BitVector
+from hdl_registers.field.enumeration import Enumeration
+from hdl_registers.field.integer import Integer
+from hdl_registers.field.register_field_type import Fixed, Signed, Unsigned
+from hdl_registers.register import REGISTER_MODES, Register
+
+if TYPE_CHECKING:
+    # First party libraries
+    from hdl_registers.field.register_field import RegisterField
+    from hdl_registers.register_array import RegisterArray
+    from hdl_registers.register_list import RegisterList
+
+# ASCII "HDRM" when the first word is stored little-endian.
+MAGIC = 0x4D524448
+
+# Incremented when the layout changes in a way that a decoder must know about.
+VERSION = 1
+
+# Indexes of the words in the header at the start of the ROM.
+HEADER_MAGIC = 0
+HEADER_VERSION = 1
+HEADER_NUM_WORDS = 2
+# Five words with the 'object_hash' of the register list.
+HEADER_HASH = 3
+HEADER_NUM_REGISTERS = 8
+HEADER_REGISTERS_OFFSET = 9
+HEADER_NUM_FIELDS = 10
+HEADER_FIELDS_OFFSET = 11
+HEADER_NUM_ELEMENTS = 12
+HEADER_ELEMENTS_OFFSET = 13
+HEADER_STRINGS_OFFSET = 14
+HEADER_STRINGS_SIZE = 15
+
+HEADER_LENGTH = 16
+HASH_LENGTH = 5
+
+# Number of words in each entry of the register, field and enumeration element tables.
+REGISTER_ENTRY_LENGTH = 7
+FIELD_ENTRY_LENGTH = 4
+ELEMENT_ENTRY_LENGTH = 1
+
+# Code for each register mode, in the same order as 'REGISTER_MODES'.
+MODE_CODES = {mode: mode_index for mode_index, mode in enumerate(REGISTER_MODES)}
+
+FIELD_TYPE_BIT = 0
+FIELD_TYPE_BIT_VECTOR = 1
+FIELD_TYPE_ENUMERATION = 2
+FIELD_TYPE_INTEGER = 3
+
+# Interpretation of the bits of a bit vector field.
+BIT_VECTOR_UNSIGNED = 0
+BIT_VECTOR_SIGNED = 1
+BIT_VECTOR_UNSIGNED_FIXED_POINT = 2
+BIT_VECTOR_SIGNED_FIXED_POINT = 3
+
+WORD_MASK = 0xFFFFFFFF
+
+
+class RegisterMapRom:
+    """
+    Encode a register list as a compact, self-describing table of 32-bit words.
+    The table can be placed in a ROM in the FPGA, so that software can discover and validate the
+    register map at run time.
+    See the :ref:`generator_register_map_rom` article for a description of the layout.
+
+    Descriptions are not included, in order to keep the ROM small.
+    """
+
+    def __init__(self, register_list: "RegisterList"):
+        """
+        Arguments:
+            register_list: The register list to encode.
+        """
+        self.register_list = register_list
+
+        self._register_words: list[int] = []
+        self._field_words: list[int] = []
+        self._element_words: list[int] = []
+
+        # Offset zero is the empty string, which is used for "no name".
+        self._strings = bytearray(b"\0")
+        self._string_offsets: dict[str, int] = {"": 0}
+
+    @staticmethod
+    def get_hash_words(object_hash: str) -> list[int]:
+        """
+        Split the hexadecimal hash string in words.
+        The first word holds the first eight characters.
+        """
+        return [int(object_hash[index * 8 : index * 8 + 8], 16) for index in range(HASH_LENGTH)]
+
+    def get_words(self) -> list[int]:
+        """
+        Get the encoded register map.
+
+        Return:
+            The words of the ROM, in address order.
+        """
+        self._register_words = []
+        self._field_words = []
+        self._element_words = []
+
+        num_registers = 0
+        for register_object in self.register_list.register_objects:
+            if isinstance(register_object, Register):
+                self._append_register(register=register_object, register_array=None)
+                num_registers += 1
+            else:
+                for register in register_object.registers:
+                    self._append_register(register=register, register_array=register_object)
+                    num_registers += 1
+
+        strings = bytes(self._strings)
+        # Pad the string table to a whole number of words.
+        strings += b"\0" * (-len(strings) % 4)
+        string_words = [
+            int.from_bytes(strings[index : index + 4], byteorder="little")
+            for index in range(0, len(strings), 4)
+        ]
+
+        registers_offset = HEADER_LENGTH
+        fields_offset = registers_offset + len(self._register_words)
+        elements_offset = fields_offset + len(self._field_words)
+        strings_offset = elements_offset + len(self._element_words)
+        num_words = strings_offset + len(string_words)
+
+        header = [0] * HEADER_LENGTH
+        header[HEADER_MAGIC] = MAGIC
+        header[HEADER_VERSION] = VERSION
+        header[HEADER_NUM_WORDS] = num_words
+        header[HEADER_HASH : HEADER_HASH + HASH_LENGTH] = self.get_hash_words(
+            self.register_list.object_hash
+        )
+        header[HEADER_NUM_REGISTERS] = num_registers
+        header[HEADER_REGISTERS_OFFSET] = registers_offset
+        header[HEADER_NUM_FIELDS] = len(self._field_words) // FIELD_ENTRY_LENGTH
+        header[HEADER_FIELDS_OFFSET] = fields_offset
+        header[HEADER_NUM_ELEMENTS] = len(self._element_words) // ELEMENT_ENTRY_LENGTH
+        header[HEADER_ELEMENTS_OFFSET] = elements_offset
+        header[HEADER_STRINGS_OFFSET] = strings_offset
+        header[HEADER_STRINGS_SIZE] = len(strings)
+
+        return (
+            header + self._register_words + self._field_words + self._element_words + string_words
+        )
+
+    def _append_register(
+        self, register: Register, register_array: Optional["RegisterArray"]
+    ) -> None:
+        if register_array is None:
+            index = register.index
+            array_length = 0
+            array_stride = 0
+            array_name = ""
+        else:
+            index = register_array.base_index + register.index
+            array_length = register_array.length
+            array_stride = register_array.stride
+            array_name = register_array.name
+
+        if array_stride > 0xFFFF:
+            raise ValueError(
+                f'Register array "{array_name}" has a stride of {array_stride} registers, '
+                "which does not fit in the register map ROM."
+            )
+
+        self._register_words += [
+            index,
+            MODE_CODES[register.mode] | len(register.fields) << 8 | array_stride << 16,
+            array_length,
+            self._get_string_offset(register.name),
+            self._get_string_offset(array_name),
+            len(self._field_words) // FIELD_ENTRY_LENGTH,
+            register.default_value,
+        ]
+
+        for field in register.fields:
+            self._append_field(field=field)
+
+    def _append_field(self, field: "RegisterField") -> None:
+        data = [0, 0]
+
+        if isinstance(field, Bit):
+            field_type = FIELD_TYPE_BIT
+
+        elif isinstance(field, BitVector):
+            field_type = FIELD_TYPE_BIT_VECTOR
+            data = self._get_bit_vector_data(field=field)
+
+        elif isinstance(field, Enumeration):
+            field_type = FIELD_TYPE_ENUMERATION
+            data = [len(self._element_words) // ELEMENT_ENTRY_LENGTH, len(field.elements)]
+
+            for element in field.elements:
+                self._element_words.append(self._get_string_offset(element.name))
+
+        elif isinstance(field, Integer):
+            field_type = FIELD_TYPE_INTEGER
+            data = [field.min_value & WORD_MASK, field.max_value & WORD_MASK]
+
+        else:
+            raise ValueError(f"Unknown field: {field}")
+
+        self._field_words += [
+            field.base_index | field.width << 8 | field_type << 16,
+            self._get_string_offset(field.name),
+        ] + data
+
+    @staticmethod
+    def _get_bit_vector_data(field: BitVector) -> list[int]:
+        """
+        The interpretation of the bits, and the number of fractional bits.
+        The number of fractional bits is negative if the field is scaled up.
+        """
+        field_type = field.field_type
+
+        if isinstance(field_type, Fixed):
+            interpretation = (
+                BIT_VECTOR_SIGNED_FIXED_POINT
+                if field_type.is_signed
+                else BIT_VECTOR_UNSIGNED_FIXED_POINT
+            )
+            return [interpretation, field_type.fraction_bit_width & WORD_MASK]
+
+        if isinstance(field_type, Signed):
+            return [BIT_VECTOR_SIGNED, 0]
+
+        if isinstance(field_type, Unsigned):
+            return [BIT_VECTOR_UNSIGNED, 0]
+
+        raise ValueError(f"Unknown field type: {field_type}")
+
+    def _get_string_offset(self, string: str) -> int:
+        """
+        Byte offset of the null-terminated string in the string table.
+        Names are often repeated, e.g. field names, so each string is stored only once.
+        """
+        if string not in self._string_offsets:
+            self._string_offsets[string] = len(self._strings)
+            self._strings += string.encode() + b"\0"
+
+        return self._string_offsets[string]
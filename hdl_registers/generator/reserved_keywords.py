@@ -21,7 +21,7 @@ from hdl_registers.generator.vhdl.reserved_keywords import (
 )
 
 # All reserved keywords from all target languages.
-RESERVED_KEYWORDS = (
+RESERVED_KEYWORDS = frozenset(
     C_RESERVED_KEYWORDS
     | CPP_RESERVED_KEYWORDS
     | HTML_RESERVED_KEYWORDS
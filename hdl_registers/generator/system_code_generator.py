@@ -0,0 +1,193 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+import hashlib
+from pathlib import Path
+from typing import Optional
+
+# First party libraries
+from hdl_registers.register_list import RegisterList
+
+# Local folder libraries
+from .register_code_generator import RegisterCodeGenerator
+from .register_code_generator_helpers import QualifiedNameTableT
+from .reserved_keywords import RESERVED_KEYWORDS
+
+# Number of bytes in each register.
+REGISTER_SIZE_BYTES = 4
+
+
+class RegisterListInstance:
+    """
+    A register list that is placed at a base address in a system address map.
+    """
+
+    def __init__(self, register_list: RegisterList, base_address: int, name: Optional[str] = None):
+        """
+        Arguments:
+            register_list: Registers and constants of this instance.
+            base_address: Absolute byte address where the registers of this instance start.
+            name: Name of this instance in the system.
+                Default is the name of the register list.
+                Must be set if the same register list is used for more than one instance
+                in a system.
+        """
+        self.register_list = register_list
+        self.base_address = base_address
+        self.name = register_list.name if name is None else name
+
+    @property
+    def num_registers(self) -> int:
+        """
+        Number of registers in this instance, including every element of every register array.
+        """
+        # It is possible that we have constants but no registers
+        if not self.register_list.register_objects:
+            return 0
+
+        return self.register_list.register_objects[-1].index + 1
+
+    @property
+    def size(self) -> int:
+        """
+        Number of bytes occupied by the registers of this instance.
+        """
+        return self.num_registers * REGISTER_SIZE_BYTES
+
+    @property
+    def end_address(self) -> int:
+        """
+        First absolute byte address after the registers of this instance.
+        """
+        return self.base_address + self.size
+
+    def __repr__(self) -> str:
+        return f"""{self.__class__.__name__}(\
+name={self.name},\
+base_address={self.base_address},\
+register_list={self.register_list.object_hash},\
+)"""
+
+
+class SystemCodeGenerator(RegisterCodeGenerator):
+    """
+    Common functions for generating code for a whole system, i.e. many register lists that are
+    placed at different base addresses in one address space.
+    Should be inherited by code generators that work on a system rather than a
+    single :class:`.RegisterList`.
+
+    The system itself has no registers or constants.
+    The :meth:`.register_list` of this class is an empty list that carries the name of the system.
+    """
+
+    def __init__(self, name: str, register_lists: list[RegisterListInstance], output_folder: Path):
+        """
+        Arguments:
+            name: Name of the system.
+                Will be used for file names and type names in the generated code.
+            register_lists: The register list instances of the system.
+                Will be sorted by base address.
+            output_folder: Result file will be placed in this folder.
+        """
+        super().__init__(register_list=RegisterList(name=name), output_folder=output_folder)
+
+        self.register_lists = sorted(
+            register_lists, key=lambda register_list: register_list.base_address
+        )
+
+    @property
+    def base_address(self) -> int:
+        """
+        Absolute byte address where the system address space starts.
+        I.e. the lowest base address of all the register lists.
+        """
+        if not self.register_lists:
+            return 0
+
+        return self.register_lists[0].base_address
+
+    @property
+    def size(self) -> int:
+        """
+        Number of bytes in the system address space, from :meth:`.base_address` up to and
+        including the last register of all the register lists.
+        """
+        if not self.register_lists:
+            return 0
+
+        end_address = max(register_list.end_address for register_list in self.register_lists)
+        return end_address - self.base_address
+
+    def _calculate_register_list_hash(self) -> str:
+        """
+        Hash of the system name as well as the name, base address and registers of all
+        register lists.
+        """
+        return hashlib.sha1(f"{self.name}{self.register_lists}".encode()).hexdigest()
+
+    def _get_sanity_check_errors(self) -> tuple[list[str], QualifiedNameTableT]:
+        """
+        Check that
+        * no register list instance name matches a reserved keyword,
+        * there are no duplicate instance names, and no instance that has the same name as
+          the system,
+        * all base addresses are aligned to the register size,
+        * the address ranges of the register lists do not overlap.
+
+        Return:
+            A message for each error that was found, empty list if there are no errors.
+            And an empty qualified name table, since the system has no registers of its own.
+        """
+        errors = []
+
+        instance_names: set[str] = set()
+        previous_register_list: Optional[RegisterListInstance] = None
+
+        for register_list in self.register_lists:
+            if register_list.name.lower() in RESERVED_KEYWORDS:
+                errors.append(
+                    f'Register list instance name "{register_list.name}" is a reserved keyword.'
+                )
+
+            if register_list.name in instance_names:
+                errors.append(f'Duplicate register list instance name "{register_list.name}".')
+            elif register_list.name == self.name:
+                errors.append(
+                    f'Register list instance "{register_list.name}" may not have same name as '
+                    "the system."
+                )
+
+            instance_names.add(register_list.name)
+
+            if register_list.base_address % REGISTER_SIZE_BYTES:
+                errors.append(
+                    f'Base address of register list "{register_list.name}" '
+                    f"(0x{register_list.base_address:X}) is not aligned to the register size."
+                )
+
+            if (
+                previous_register_list is not None
+                and register_list.base_address < previous_register_list.end_address
+            ):
+                errors.append(
+                    f'Address range of register list "{register_list.name}" '
+                    f"(0x{register_list.base_address:X}-0x{register_list.end_address:X}) overlaps "
+                    f'with register list "{previous_register_list.name}" '
+                    f"(0x{previous_register_list.base_address:X}-"
+                    f"0x{previous_register_list.end_address:X})."
+                )
+
+            if (
+                previous_register_list is None
+                or register_list.end_address > previous_register_list.end_address
+            ):
+                previous_register_list = register_list
+
+        return errors, {}
@@ -19,15 +19,18 @@ from tsfpga.examples.example_env import get_default_registers
 # First party libraries
 from hdl_registers import HDL_REGISTERS_DOC, HDL_REGISTERS_TESTS
 from hdl_registers.generator.c.header import CHeaderGenerator
+from hdl_registers.generator.c.register_map_rom import CRegisterMapRomGenerator
 from hdl_registers.generator.cpp.header import CppHeaderGenerator
 from hdl_registers.generator.cpp.implementation import CppImplementationGenerator
 from hdl_registers.generator.cpp.interface import CppInterfaceGenerator
 from hdl_registers.generator.html.constant_table import HtmlConstantTableGenerator
 from hdl_registers.generator.html.page import HtmlPageGenerator
 from hdl_registers.generator.html.register_table import HtmlRegisterTableGenerator
+from hdl_registers.generator.python.accessor import PythonAccessorGenerator
 from hdl_registers.generator.python.python_class import PythonClassGenerator
 from hdl_registers.generator.vhdl.axi_lite_wrapper import VhdlAxiLiteWrapperGenerator
 from hdl_registers.generator.vhdl.record_package import VhdlRecordPackageGenerator
+from hdl_registers.generator.vhdl.register_map_rom import VhdlRegisterMapRomGenerator
 from hdl_registers.generator.vhdl.register_package import VhdlRegisterPackageGenerator
 from hdl_registers.generator.vhdl.simulation.read_write_package import (
     VhdlSimulationReadWritePackageGenerator,
@@ -69,6 +72,9 @@ def test_can_generate_vhdl_without_error(tmp_path, register_list):
     VhdlAxiLiteWrapperGenerator(register_list, tmp_path).create()
     assert (tmp_path / f"{register_list.name}_reg_file.vhd").exists()
 
+    VhdlRegisterMapRomGenerator(register_list, tmp_path).create()
+    assert (tmp_path / f"{register_list.name}_register_map_rom.vhd").exists()
+
 
 @pytest.mark.parametrize("register_list", REGISTER_LISTS)
 def test_can_generate_c_without_error(tmp_path, register_list):
@@ -78,6 +84,9 @@ def test_can_generate_c_without_error(tmp_path, register_list):
     CHeaderGenerator(register_list, tmp_path, file_name="apa.h").create()
     assert (tmp_path / "apa.h").exists()
 
+    CRegisterMapRomGenerator(register_list, tmp_path).create()
+    assert (tmp_path / f"{register_list.name}_register_map_rom.h").exists()
+
 
 @pytest.mark.parametrize("register_list", REGISTER_LISTS)
 def test_can_generate_cpp_without_error(tmp_path, register_list):
@@ -107,3 +116,6 @@ def test_can_generate_html_without_error(tmp_path, register_list):
 def test_can_generate_python_without_error(tmp_path, register_list):
     PythonClassGenerator(register_list, tmp_path).create()
     assert (tmp_path / f"{register_list.name}.py").exists()
+
+    PythonAccessorGenerator(register_list, tmp_path).create()
+    assert (tmp_path / f"{register_list.name}_accessor.py").exists()
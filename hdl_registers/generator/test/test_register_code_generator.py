@@ -488,3 +488,290 @@ def test_array_field_with_same_qualified_name_as_plain_register_should_raise_exc
         'Error in register list "test": Qualified name of field "apa.hest.zebra" '
         '("test_apa_hest_zebra") clashes with another item.'
     )
+
+
+def test_all_sanity_check_errors_should_be_reported_in_one_exception(tmp_path):
+    register_list = RegisterList(name="test")
+    register_list.add_constant(name="apa", value=3, description="")
+    register_list.add_constant(name="apa", value=True, description="")
+
+    register = register_list.append_register(name="for", mode="r_w", description="")
+    register.append_bit(name="hest", description="", default_value="0")
+    register.append_bit(name="hest", description="", default_value="0")
+
+    # Duplicate register. Should not also be reported as a qualified name clash.
+    register_list.append_register(name="for", mode="r_w", description="")
+
+    array = register_list.append_register_array(name="zebra", length=2, description="")
+    array.append_register(name="data", mode="r_w", description="")
+    register_list.append_register(name="zebra_data", mode="r_w", description="")
+
+    with pytest.raises(ValueError) as exception_info:
+        CustomGenerator(register_list=register_list, output_folder=tmp_path).create()
+    assert str(exception_info.value) == (
+        'Error in register list "test": Duplicate constant name "apa".\n'
+        'Error in register list "test": Register name "for" is a reserved keyword.\n'
+        'Error in register list "test": Duplicate field name "hest" in register "for".\n'
+        'Error in register list "test": Duplicate plain register name "for".\n'
+        'Error in register list "test": Register name "for" is a reserved keyword.\n'
+        'Error in register list "test": Qualified name of register "zebra_data" '
+        '("test_zebra_data") clashes with another item.'
+    )
+
+
+def test_sanity_check_is_done_only_once_for_same_register_list(tmp_path):
+    register_list = RegisterList(name="test")
+    register = register_list.append_register(name="apa", mode="r_w", description="")
+    register.append_bit(name="hest", description="", default_value="0")
+
+    class QualifiedNameGenerator(CustomGenerator):
+        def get_code(self, before_header="", **kwargs) -> str:
+            assert self._qualified_name_table is not None
+
+            register = self.register_list.get_register("apa")
+            return self.qualified_field_name(register=register, field=register.fields[0])
+
+    with patch(
+        "hdl_registers.generator.register_code_generator.RegisterCodeGenerator."
+        "_get_sanity_check_errors",
+        side_effect=RegisterCodeGenerator._get_sanity_check_errors,
+        autospec=True,
+    ) as get_sanity_check_errors:
+        for _ in range(2):
+            output_file = QualifiedNameGenerator(
+                register_list=register_list, output_folder=tmp_path / "qualified"
+            ).create()
+        assert get_sanity_check_errors.call_count == 1
+
+        # The name from the table shared with the sanity check shall be used.
+        assert output_file.read_text(encoding="utf-8") == "test_apa_hest"
+
+        # Check must be done again when the register list has changed.
+        register_list.append_register(name="zebra", mode="r_w", description="")
+        QualifiedNameGenerator(
+            register_list=register_list, output_folder=tmp_path / "qualified"
+        ).create()
+        assert get_sanity_check_errors.call_count == 2
+
+        # Check must be done again for another generator class.
+        CustomGenerator(register_list=register_list, output_folder=tmp_path).create()
+        assert get_sanity_check_errors.call_count == 3
+
+
+def test_sanity_check_result_is_not_shared_between_generator_classes(tmp_path):
+    register_list = RegisterList(name="test")
+    register = register_list.append_register(name="apa", mode="r_w", description="")
+    register.append_bit(name="hest", description="", default_value="0")
+
+    class QualifiedNameGenerator(CustomGenerator):
+        def get_code(self, before_header="", **kwargs) -> str:
+            register = self.register_list.get_register("apa")
+            return self.qualified_field_name(register=register, field=register.fields[0])
+
+    class UpperCaseQualifiedNameGenerator(QualifiedNameGenerator):
+        def _format_qualified_register_name(self, array_name, register_name):
+            name = super()._format_qualified_register_name(
+                array_name=array_name, register_name=register_name
+            )
+            return name.upper()
+
+    output_file = QualifiedNameGenerator(
+        register_list=register_list, output_folder=tmp_path / "lower"
+    ).create()
+    assert output_file.read_text(encoding="utf-8") == "test_apa_hest"
+
+    output_file = UpperCaseQualifiedNameGenerator(
+        register_list=register_list, output_folder=tmp_path / "upper"
+    ).create()
+    assert output_file.read_text(encoding="utf-8") == "TEST_APA_hest"
+
+
+def test_qualified_field_name_is_based_on_overridden_qualified_register_name(tmp_path):
+    register_list = RegisterList(name="test")
+    register = register_list.append_register(name="apa", mode="r_w", description="")
+    register.append_bit(name="hest", description="", default_value="0")
+
+    class PrefixedQualifiedNameGenerator(CustomGenerator):
+        def qualified_register_name(self, register, register_array=None):
+            return "prefix_" + super().qualified_register_name(
+                register=register, register_array=register_array
+            )
+
+        def get_code(self, before_header="", **kwargs) -> str:
+            register = self.register_list.get_register("apa")
+            return self.qualified_field_name(register=register, field=register.fields[0])
+
+    generator = PrefixedQualifiedNameGenerator(register_list=register_list, output_folder=tmp_path)
+
+    # Both with the name table from the sanity check, and without.
+    assert generator.create().read_text(encoding="utf-8") == "prefix_test_apa_hest"
+    assert generator.get_code() == "prefix_test_apa_hest"
+
+
+def test_errors_from_cached_sanity_check_should_raise_exception(tmp_path):
+    register_list = RegisterList(name="test")
+    register_list.append_register(name="for", mode="r_w", description="")
+
+    for _ in range(2):
+        with pytest.raises(ValueError) as exception_info:
+            CustomGenerator(register_list=register_list, output_folder=tmp_path).create()
+        assert (
+            str(exception_info.value)
+            == 'Error in register list "test": Register name "for" is a reserved keyword.'
+        )
+
+
+def test_invalid_double_buffered_registers_should_raise_exception(tmp_path):
+    register_list = RegisterList(name="test")
+    register_list.append_register(name="apa", mode="r_w", description="")
+    register_list.append_register(name="status", mode="r", description="")
+
+    array = register_list.append_register_array(name="hest", length=2, description="")
+    array.append_register(name="data", mode="w", description="")
+    array.append_register(name="level", mode="r", description="")
+    array.append_register(name="commit", mode="wpulse", description="").commits = ["apa"]
+
+    register_list.append_register(name="commit", mode="r_w", description="").commits = [
+        "apa",
+        "status",
+        "hest",
+    ]
+    register_list.append_register(name="other_commit", mode="wpulse", description="").commits = [
+        "apa",
+        "zebra",
+    ]
+
+    with pytest.raises(ValueError) as exception_info:
+        CustomGenerator(register_list=register_list, output_folder=tmp_path).create()
+    assert str(exception_info.value) == (
+        'Error in register list "test": Register "hest.commit" in a register array may not '
+        "commit double-buffered registers.\n"
+        'Error in register list "test": Register "commit" commits double-buffered registers, and '
+        'must have mode "wpulse" or "r_wpulse", not "r_w".\n'
+        'Error in register list "test": Double-buffered register "status" must have mode "r_w" '
+        'or "w", not "r".\n'
+        'Error in register list "test": Double-buffered register "hest.level" must have mode '
+        '"r_w" or "w", not "r".\n'
+        'Error in register list "test": Double-buffered register "hest.commit" must have mode '
+        '"r_w" or "w", not "wpulse".\n'
+        'Error in register list "test": Double-buffered "apa" is committed by both register '
+        '"commit" and register "other_commit".\n'
+        'Error in register list "test": Register "other_commit" commits "zebra", which is not a '
+        "plain register or register array in the register list."
+    )
+
+
+def test_valid_double_buffered_registers(tmp_path):
+    register_list = RegisterList(name="test")
+    register_list.append_register(name="apa", mode="r_w", description="")
+
+    array = register_list.append_register_array(name="hest", length=2, description="")
+    array.append_register(name="data", mode="w", description="")
+
+    commit = register_list.append_register(name="commit", mode="r_wpulse", description="")
+    commit.commits = ["apa", "hest"]
+
+    CustomGenerator(register_list=register_list, output_folder=tmp_path).create()
+
+    assert register_list.get_commit_registers() == {"apa": commit, "hest": commit}
+
+
+def test_static_register_that_is_not_read_only_should_raise_exception(tmp_path):
+    register_list = RegisterList(name="test")
+    register_list.append_register(name="version", mode="r", description="").static = True
+    register_list.append_register(name="config", mode="r_w", description="").static = True
+
+    array = register_list.append_register_array(name="hest", length=2, description="")
+    array.append_register(name="capability", mode="r", description="").static = True
+    array.append_register(name="data", mode="w", description="").static = True
+
+    with pytest.raises(ValueError) as exception_info:
+        CustomGenerator(register_list=register_list, output_folder=tmp_path).create()
+    assert str(exception_info.value) == (
+        'Error in register list "test": Static register "config" must have mode "r", '
+        'not "r_w".\n'
+        'Error in register list "test": Static register "hest.data" must have mode "r", '
+        'not "w".'
+    )
+
+
+def test_register_pair_errors(tmp_path):
+    register_list = RegisterList(name="test")
+    register_list.append_register(name="a", mode="r", description="")
+    register_list.append_register(name="b", mode="w", description="")
+    register_list.append_register(name="c", mode="r_w", description="")
+    register_list.append_register(name="d", mode="r_w", description="")
+    register_list.append_register_array(name="hest", length=2, description="").append_register(
+        name="data", mode="r_w", description=""
+    )
+
+    register_list.add_register_pair(name="a_b", low="a", high="b", description="")
+    register_list.add_register_pair(name="b_c", low="b", high="c", description="")
+    register_list.add_register_pair(name="a_c", low="a", high="c", description="")
+    register_list.add_register_pair(name="c_d", low="c", high="data", description="")
+    register_list.add_register_pair(name="d", low="c", high="d", description="")
+    register_list.add_register_pair(name="hest", low="c", high="d", description="")
+    register_list.add_register_pair(name="c_d", low="c", high="d", description="")
+
+    with pytest.raises(ValueError) as exception_info:
+        CustomGenerator(register_list=register_list, output_folder=tmp_path).create()
+    assert str(exception_info.value) == (
+        'Error in register list "test": Register pair "a_b" must have registers that are both '
+        "readable or both writeable by the bus.\n"
+        'Error in register list "test": Register pair "b_c" must have low register "b" at an '
+        "even index, so that the pair is aligned to 64 bits.\n"
+        'Error in register list "test": Register pair "a_c" must have high register "c" directly '
+        'after low register "a".\n'
+        'Error in register list "test": Register pair "c_d" refers to "data", which is not a '
+        "plain register in the register list.\n"
+        'Error in register list "test": Name of register pair "d" clashes with another item.\n'
+        'Error in register list "test": Name of register pair "hest" clashes with another item.\n'
+        'Error in register list "test": Duplicate register pair name "c_d".'
+    )
+
+
+def test_valid_register_pair(tmp_path):
+    register_list = RegisterList(name="test")
+    register_list.append_register(name="a", mode="r", description="")
+    register_list.append_register(name="b", mode="r_w", description="")
+    register_list.add_register_pair(name="a_b", low="a", high="b", description="")
+
+    CustomGenerator(register_list=register_list, output_folder=tmp_path).create()
+
+
+def test_programming_sequence_errors(tmp_path):
+    register_list = RegisterList(name="test")
+    register_list.append_register(name="a", mode="r", description="")
+    register_list.append_register(name="b", mode="r_w", description="")
+
+    register_list.add_programming_sequence(name="init", description="").append_write(
+        register="a", value=1
+    )
+    register_list.add_programming_sequence(name="reset", description="").append_write(
+        register="b", value=1
+    )
+    register_list.add_programming_sequence(name="reset", description="").append_wait(
+        register="c", value=1
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        CustomGenerator(register_list=register_list, output_folder=tmp_path).create()
+    assert str(exception_info.value) == (
+        'Error in register list "test": Programming sequence "init" step 0 (write a = 1): '
+        'Can not write register in mode "r".\n'
+        'Error in register list "test": Duplicate programming sequence name "reset".\n'
+        'Error in register list "test": Programming sequence "reset" step 0 (wait c == 1): '
+        'Could not find register "c" within register list "test"'
+    )
+
+
+def test_valid_programming_sequence(tmp_path):
+    register_list = RegisterList(name="test")
+    register_list.append_register(name="a", mode="r", description="")
+    register_list.append_register(name="b", mode="r_w", description="")
+
+    programming_sequence = register_list.add_programming_sequence(name="init", description="")
+    programming_sequence.append_write(register="b", value=1)
+    programming_sequence.append_wait(register="a", value=1)
+
+    CustomGenerator(register_list=register_list, output_folder=tmp_path).create()
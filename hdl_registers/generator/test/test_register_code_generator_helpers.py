@@ -13,6 +13,7 @@ import pytest
 # First party libraries
 from hdl_registers.generator.register_code_generator_helpers import RegisterCodeGeneratorHelpers
 from hdl_registers.register import Register
+from hdl_registers.register_array import RegisterArray
 
 
 def test_field_setter_should_read_modify_write():
@@ -48,3 +49,37 @@ def test_field_setter_should_read_modify_write_raise_exception_if_the_register_i
 def test_to_pascal_case():
     assert RegisterCodeGeneratorHelpers.to_pascal_case("test") == "Test"
     assert RegisterCodeGeneratorHelpers.to_pascal_case("test_two") == "TestTwo"
+
+
+def test_qualified_names_and_descriptions():
+    helpers = RegisterCodeGeneratorHelpers()
+    helpers.name = "apa"
+
+    register = Register(name="hest", index=0, mode="r_w", description="")
+    field = register.append_bit(name="zebra", description="", default_value="0")
+    register_array = RegisterArray(name="dummies", base_index=0, length=2, description="")
+
+    assert helpers.qualified_register_name(register=register) == "apa_hest"
+    assert (
+        helpers.qualified_register_name(register=register, register_array=register_array)
+        == "apa_dummies_hest"
+    )
+    assert helpers.qualified_field_name(register=register, field=field) == "apa_hest_zebra"
+    assert (
+        helpers.qualified_field_name(register=register, field=field, register_array=register_array)
+        == "apa_dummies_hest_zebra"
+    )
+
+    assert helpers.register_description(register=register) == "'hest' register"
+    assert (
+        helpers.register_description(register=register, register_array=register_array)
+        == "'hest' register within the 'dummies' register array"
+    )
+    assert (
+        helpers.field_description(register=register, field=field)
+        == "'zebra' field in the 'hest' register"
+    )
+    assert (
+        helpers.field_description(register=register, field=field, register_array=register_array)
+        == "'zebra' field in the 'hest' register within the 'dummies' register array"
+    )
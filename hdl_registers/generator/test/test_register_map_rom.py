@@ -0,0 +1,205 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+from unittest.mock import PropertyMock, patch
+
+# Third party libraries
+import pytest
+
+# First party libraries
+from hdl_registers.field.register_field_type import SignedFixedPoint
+from hdl_registers.generator.register_map_rom import (
+    BIT_VECTOR_SIGNED_FIXED_POINT,
+    FIELD_TYPE_BIT,
+    FIELD_TYPE_BIT_VECTOR,
+    FIELD_TYPE_ENUMERATION,
+    FIELD_TYPE_INTEGER,
+    HEADER_ELEMENTS_OFFSET,
+    HEADER_FIELDS_OFFSET,
+    HEADER_LENGTH,
+    HEADER_NUM_ELEMENTS,
+    HEADER_NUM_FIELDS,
+    HEADER_NUM_REGISTERS,
+    HEADER_REGISTERS_OFFSET,
+    HEADER_STRINGS_OFFSET,
+    HEADER_STRINGS_SIZE,
+    MAGIC,
+    MODE_CODES,
+    VERSION,
+    RegisterMapRom,
+)
+from hdl_registers.register_list import RegisterList
+
+
+def get_register_list():
+    register_list = RegisterList(name="apa")
+
+    register = register_list.append_register(name="config", mode="r_w", description="")
+    register.append_bit(name="enable", description="", default_value="1")
+    register.append_enumeration(
+        name="direction",
+        description="",
+        elements={"up": "", "down": ""},
+        default_value="down",
+    )
+    register.append_integer(
+        name="offset", description="", min_value=-4, max_value=3, default_value=0
+    )
+
+    register_array = register_list.append_register_array(name="channels", length=3, description="")
+    register = register_array.append_register(name="config", mode="w", description="")
+    register.append_bit_vector(
+        name="gain",
+        description="",
+        width=8,
+        default_value="00000000",
+        field_type=SignedFixedPoint(3, -4),
+    )
+    register_array.append_register(name="status", mode="r", description="")
+
+    return register_list
+
+
+def get_string(words, offset):
+    strings_offset = words[HEADER_STRINGS_OFFSET]
+    strings = b"".join(
+        word.to_bytes(4, byteorder="little")
+        for word in words[strings_offset : strings_offset + words[HEADER_STRINGS_SIZE] // 4]
+    )
+    return strings[offset : strings.index(b"\0", offset)].decode()
+
+
+def get_register_entry(words, register_index):
+    offset = words[HEADER_REGISTERS_OFFSET] + register_index * 7
+    return words[offset : offset + 7]
+
+
+def get_field_entry(words, field_index):
+    offset = words[HEADER_FIELDS_OFFSET] + field_index * 4
+    return words[offset : offset + 4]
+
+
+def test_header():
+    register_list = get_register_list()
+    words = RegisterMapRom(register_list=register_list).get_words()
+
+    assert words[0:3] == [MAGIC, VERSION, len(words)]
+    assert "".join(f"{word:08x}" for word in words[3:8]) == register_list.object_hash
+
+    assert words[HEADER_NUM_REGISTERS] == 3
+    assert words[HEADER_REGISTERS_OFFSET] == HEADER_LENGTH
+    assert words[HEADER_NUM_FIELDS] == 4
+    assert words[HEADER_FIELDS_OFFSET] == HEADER_LENGTH + 3 * 7
+    assert words[HEADER_NUM_ELEMENTS] == 2
+    assert words[HEADER_ELEMENTS_OFFSET] == HEADER_LENGTH + 3 * 7 + 4 * 4
+    assert words[HEADER_STRINGS_OFFSET] == HEADER_LENGTH + 3 * 7 + 4 * 4 + 2
+    assert words[HEADER_STRINGS_SIZE] % 4 == 0
+    assert len(words) == words[HEADER_STRINGS_OFFSET] + words[HEADER_STRINGS_SIZE] // 4
+
+
+def test_registers():
+    words = RegisterMapRom(register_list=get_register_list()).get_words()
+
+    index, mode_fields_stride, array_length, name, array_name, first_field, default_value = (
+        get_register_entry(words=words, register_index=0)
+    )
+    assert index == 0
+    assert mode_fields_stride == MODE_CODES["r_w"] | 3 << 8
+    assert array_length == 0
+    assert get_string(words=words, offset=name) == "config"
+    assert array_name == 0
+    assert first_field == 0
+    assert default_value == 0b0000011
+
+    index, mode_fields_stride, array_length, name, array_name, first_field, default_value = (
+        get_register_entry(words=words, register_index=1)
+    )
+    assert index == 1
+    assert mode_fields_stride == MODE_CODES["w"] | 1 << 8 | 2 << 16
+    assert array_length == 3
+    # Same name as the first register, so the string is shared.
+    assert name == get_register_entry(words=words, register_index=0)[3]
+    assert get_string(words=words, offset=array_name) == "channels"
+    assert first_field == 3
+    assert default_value == 0
+
+    index, mode_fields_stride, _, name, _, _, _ = get_register_entry(words=words, register_index=2)
+    assert index == 2
+    assert mode_fields_stride == MODE_CODES["r"] | 0 << 8 | 2 << 16
+    assert get_string(words=words, offset=name) == "status"
+
+
+def test_fields():
+    words = RegisterMapRom(register_list=get_register_list()).get_words()
+
+    def get_field(field_index):
+        field_info, name, data_0, data_1 = get_field_entry(words=words, field_index=field_index)
+        return (
+            field_info & 0xFF,
+            field_info >> 8 & 0xFF,
+            field_info >> 16,
+            get_string(words=words, offset=name),
+            data_0,
+            data_1,
+        )
+
+    assert get_field(0) == (0, 1, FIELD_TYPE_BIT, "enable", 0, 0)
+    assert get_field(1) == (1, 1, FIELD_TYPE_ENUMERATION, "direction", 0, 2)
+    assert get_field(2) == (2, 3, FIELD_TYPE_INTEGER, "offset", 0xFFFFFFFC, 3)
+    assert get_field(3) == (0, 8, FIELD_TYPE_BIT_VECTOR, "gain", BIT_VECTOR_SIGNED_FIXED_POINT, 4)
+
+    elements_offset = words[HEADER_ELEMENTS_OFFSET]
+    assert get_string(words=words, offset=words[elements_offset]) == "up"
+    assert get_string(words=words, offset=words[elements_offset + 1]) == "down"
+
+
+def test_strings_are_packed_and_terminated():
+    words = RegisterMapRom(register_list=get_register_list()).get_words()
+
+    strings_offset = words[HEADER_STRINGS_OFFSET]
+    first_word = words[strings_offset]
+
+    # Offset zero is the empty string. The first name follows directly after.
+    assert first_word.to_bytes(4, byteorder="little") == b"\0con"
+    assert words[-1] >> 24 == 0
+
+
+def test_descriptions_do_not_change_the_rom_size():
+    register_list = get_register_list()
+    num_words = len(RegisterMapRom(register_list=register_list).get_words())
+
+    register_list.get_register(name="config").description = "A long description. " * 100
+
+    assert len(RegisterMapRom(register_list=register_list).get_words()) == num_words
+
+
+def test_empty_register_list():
+    words = RegisterMapRom(register_list=RegisterList(name="apa")).get_words()
+
+    assert words[HEADER_NUM_REGISTERS] == 0
+    assert words[HEADER_NUM_FIELDS] == 0
+    assert words[HEADER_NUM_ELEMENTS] == 0
+    assert get_string(words=words, offset=0) == ""
+
+
+@patch("hdl_registers.register_array.RegisterArray.stride", new_callable=PropertyMock)
+def test_too_large_array_stride_should_raise_exception(stride):
+    stride.return_value = 0x10000
+
+    register_list = RegisterList(name="apa")
+    register_array = register_list.append_register_array(name="channels", length=2, description="")
+    register_array.append_register(name="config", mode="r_w", description="")
+
+    with pytest.raises(ValueError) as exception_info:
+        RegisterMapRom(register_list=register_list).get_words()
+    assert str(exception_info.value) == (
+        'Register array "channels" has a stride of 65536 registers, '
+        "which does not fit in the register map ROM."
+    )
@@ -0,0 +1,126 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Third party libraries
+import pytest
+
+# First party libraries
+from hdl_registers.generator.system_code_generator import (
+    RegisterListInstance,
+    SystemCodeGenerator,
+)
+from hdl_registers.register_list import RegisterList
+
+
+class CustomSystemGenerator(SystemCodeGenerator):
+    SHORT_DESCRIPTION = "for test"
+    COMMENT_START = "#"
+
+    @property
+    def output_file(self):
+        return self.output_folder / f"{self.name}.x"
+
+    def get_code(self, **kwargs) -> str:
+        return self.header
+
+
+def get_register_list(name, num_registers):
+    register_list = RegisterList(name=name)
+    for register_index in range(num_registers):
+        register_list.append_register(name=f"reg_{register_index}", mode="r_w", description="")
+
+    return register_list
+
+
+def test_register_list_instance():
+    register_list = get_register_list(name="apa", num_registers=3)
+
+    instance = RegisterListInstance(register_list=register_list, base_address=0x100)
+    assert instance.name == "apa"
+    assert instance.num_registers == 3
+    assert instance.size == 12
+    assert instance.end_address == 0x10C
+
+    instance = RegisterListInstance(register_list=register_list, base_address=0, name="hest")
+    assert instance.name == "hest"
+
+    instance = RegisterListInstance(register_list=RegisterList(name="zebra"), base_address=0)
+    assert instance.num_registers == 0
+    assert instance.size == 0
+
+
+def test_base_address_and_size_are_taken_from_register_lists(tmp_path):
+    generator = CustomSystemGenerator(
+        name="soc",
+        register_lists=[
+            RegisterListInstance(get_register_list(name="apa", num_registers=2), 0x2000),
+            RegisterListInstance(get_register_list(name="hest", num_registers=8), 0x1000),
+            RegisterListInstance(get_register_list(name="zebra", num_registers=1), 0x1800),
+        ],
+        output_folder=tmp_path,
+    )
+
+    assert [register_list.name for register_list in generator.register_lists] == [
+        "hest",
+        "zebra",
+        "apa",
+    ]
+    assert generator.base_address == 0x1000
+    assert generator.size == 0x1008
+
+    generator = CustomSystemGenerator(name="soc", register_lists=[], output_folder=tmp_path)
+    assert generator.base_address == 0
+    assert generator.size == 0
+
+
+def test_should_create_when_register_list_or_base_address_changes(tmp_path):
+    register_list = get_register_list(name="apa", num_registers=2)
+    instance = RegisterListInstance(register_list=register_list, base_address=0x1000)
+
+    def get_generator():
+        return CustomSystemGenerator(name="soc", register_lists=[instance], output_folder=tmp_path)
+
+    assert get_generator().create_if_needed()[0]
+    assert not get_generator().create_if_needed()[0]
+
+    instance.base_address = 0x2000
+    assert get_generator().create_if_needed()[0]
+    assert not get_generator().create_if_needed()[0]
+
+    register_list.append_register(name="new", mode="r", description="")
+    assert get_generator().create_if_needed()[0]
+    assert not get_generator().create_if_needed()[0]
+
+
+def test_sanity_check_should_report_all_errors(tmp_path):
+    apa = get_register_list(name="apa", num_registers=4)
+
+    generator = CustomSystemGenerator(
+        name="soc",
+        register_lists=[
+            RegisterListInstance(register_list=apa, base_address=0x0),
+            RegisterListInstance(register_list=apa, base_address=0x8),
+            RegisterListInstance(register_list=apa, base_address=0x102, name="soc"),
+            RegisterListInstance(register_list=apa, base_address=0x200, name="for"),
+        ],
+        output_folder=tmp_path,
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        generator.create()
+    assert str(exception_info.value) == (
+        'Error in register list "soc": Duplicate register list instance name "apa".\n'
+        'Error in register list "soc": Address range of register list "apa" (0x8-0x18) '
+        'overlaps with register list "apa" (0x0-0x10).\n'
+        'Error in register list "soc": Register list instance "soc" may not have same name as '
+        "the system.\n"
+        'Error in register list "soc": Base address of register list "soc" (0x102) is not '
+        "aligned to the register size.\n"
+        'Error in register list "soc": Register list instance name "for" is a reserved keyword.'
+    )
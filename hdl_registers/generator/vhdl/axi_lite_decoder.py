@@ -0,0 +1,451 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+from pathlib import Path
+from typing import Any
+
+# First party libraries
+from hdl_registers.generator.register_code_generator_helpers import QualifiedNameTableT
+from hdl_registers.generator.system_code_generator import (
+    REGISTER_SIZE_BYTES,
+    RegisterListInstance,
+    SystemCodeGenerator,
+)
+
+
+class VhdlAxiLiteDecoderGenerator(SystemCodeGenerator):
+    """
+    Generate a VHDL AXI-Lite decoder that splits one AXI-Lite bus into one bus for each register
+    list in a system.
+    See the :ref:`generator_vhdl` article for usage details.
+
+    Each register list bus is intended to be connected to the register file from
+    :class:`.VhdlAxiLiteWrapperGenerator`.
+    Register lists that have no registers, and hence no register file, are not included.
+
+    The address decoding is derived from the base address and size of each register list, i.e.
+    the ``<name>_reg_range`` of its register package.
+    Each register list is given a decode window, which is its size rounded up to a power of two.
+    Only the address bits that are needed to tell the register lists apart are compared, and for
+    each register list only those bits that are above its decode window.
+    This gives a much smaller and faster decoder than a generic comparison against each full
+    base address.
+    The downside is that accesses outside of the register files might alias to one of them,
+    rather than giving a decode error.
+
+    The decoder handles one read transaction and one write transaction at a time.
+    The decoded index is registered, so that the address comparison is not in the same
+    path as the bus routing.
+    Optionally, via a generic, the read and write responses can also be registered.
+    """
+
+    __version__ = "1.0.0"
+
+    SHORT_DESCRIPTION = "VHDL AXI-Lite decoder"
+
+    COMMENT_START = "--"
+
+    @property
+    def output_file(self) -> Path:
+        """
+        Result will be placed in this file.
+        """
+        return self.output_folder / f"{self.name}_axi_lite_decoder.vhd"
+
+    @property
+    def decoded_register_lists(self) -> list[RegisterListInstance]:
+        """
+        The register lists that have registers, and hence a register file, sorted by
+        base address.
+        """
+        return [register_list for register_list in self.register_lists if register_list.size]
+
+    @staticmethod
+    def get_decode_window_bits(register_list: RegisterListInstance) -> int:
+        """
+        Number of address bits in the decode window of the register list.
+        I.e. the address bits that are used to address registers within the register file.
+        """
+        return max((register_list.size - 1).bit_length(), (REGISTER_SIZE_BYTES - 1).bit_length())
+
+    def get_decode_bits(self) -> dict[str, list[int]]:
+        """
+        Get the address bits that shall be compared in order to select each register list.
+
+        Return:
+            Bit indexes, in descending order, keyed by register list instance name.
+        """
+        register_lists = self.decoded_register_lists
+        window_bits = [
+            self.get_decode_window_bits(register_list=register_list)
+            for register_list in register_lists
+        ]
+
+        # Each pair of register lists must be told apart by at least one compared bit.
+        # A bit can only be used for a pair if it is above the decode window of both.
+        pairs = []
+        for first_idx, first in enumerate(register_lists):
+            for second_idx in range(first_idx + 1, len(register_lists)):
+                second = register_lists[second_idx]
+                lowest_bit = max(window_bits[first_idx], window_bits[second_idx])
+                pairs.append((first.base_address ^ second.base_address) >> lowest_bit << lowest_bit)
+
+        def tells_all_pairs_apart(bits: int) -> bool:
+            return all(pair_difference & bits for pair_difference in pairs)
+
+        # Start from all bits where any pair differs, and then remove each bit that is
+        # not needed.
+        # The sanity check guarantees that the regions are aligned and do not overlap, so there is
+        # always at least one usable bit for each pair.
+        bits = 0
+        for pair_difference in pairs:
+            bits |= pair_difference
+
+        for bit_index in range(bits.bit_length()):
+            bit = 1 << bit_index
+            if bits & bit and tells_all_pairs_apart(bits & ~bit):
+                bits &= ~bit
+
+        result = {}
+        for register_list, register_list_window_bits in zip(register_lists, window_bits):
+            result[register_list.name] = [
+                bit_index
+                for bit_index in reversed(range(bits.bit_length()))
+                if bits >> bit_index & 1 and bit_index >= register_list_window_bits
+            ]
+
+        return result
+
+    def _get_sanity_check_errors(self) -> tuple[list[str], QualifiedNameTableT]:
+        """
+        Same checks as the super class, plus that
+        * there is at least one register list with registers,
+        * the base address of each register list is aligned to its decode window.
+        """
+        errors, qualified_name_table = super()._get_sanity_check_errors()
+
+        if not self.decoded_register_lists:
+            errors.append("There are no register lists with registers in the system.")
+
+        for register_list in self.decoded_register_lists:
+            window_size = 2 ** self.get_decode_window_bits(register_list=register_list)
+
+            if register_list.base_address % window_size:
+                errors.append(
+                    f'Base address of register list "{register_list.name}" '
+                    f"(0x{register_list.base_address:X}) is not aligned to its decode window "
+                    f"size (0x{window_size:X})."
+                )
+
+        return errors, qualified_name_table
+
+    def get_code(self, **kwargs: Any) -> str:
+        """
+        Get VHDL code for an AXI-Lite decoder with one bus for each register list.
+        """
+        entity_name = self.output_file.stem
+
+        register_lists = self.decoded_register_lists
+        decode_error_index = len(register_lists)
+
+        ports = ""
+        index_constants = ""
+        port_assignments = ""
+        for register_list_index, register_list in enumerate(register_lists):
+            ports += f"""\
+    --# {{}}
+    -- Bus to the '{register_list.name}' register file.
+    {register_list.name}_axi_lite_m2s : out axi_lite_m2s_t := axi_lite_m2s_init;
+    {register_list.name}_axi_lite_s2m : in axi_lite_s2m_t := axi_lite_s2m_init"""
+            ports += ";\n" if register_list_index < decode_error_index - 1 else "\n"
+
+            index_constants += (
+                f"  constant {register_list.name}_index : natural := {register_list_index};\n"
+            )
+
+            port_assignments += f"""\
+  {register_list.name}_axi_lite_m2s <= slaves_m2s({register_list.name}_index);
+  slaves_s2m({register_list.name}_index) <= {register_list.name}_axi_lite_s2m;
+"""
+
+        vhdl = f"""\
+-- -----------------------------------------------------------------------------
+-- AXI-Lite decoder for the register files of the '{self.name}' system.
+--
+-- Splits one AXI-Lite bus into one bus for each register file.
+-- Only the address bits that are needed to tell the register files apart are compared.
+-- Accesses outside of the register files might alias to one of them.
+-- One read transaction and one write transaction are handled at a time.
+-- -----------------------------------------------------------------------------
+{self.header}\
+-- -----------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library axi;
+use axi.axi_pkg.all;
+use axi.axi_lite_pkg.all;
+
+
+entity {entity_name} is
+  generic (
+    -- Register the read and write responses, which gives one cycle of extra latency but shorter
+    -- paths from the register files to the bus master.
+    pipeline_response : boolean := false
+  );
+  port (
+    clk : in std_ulogic;
+    --# {{}}
+    -- Bus from the bus master.
+    axi_lite_m2s : in axi_lite_m2s_t;
+    axi_lite_s2m : out axi_lite_s2m_t := axi_lite_s2m_init;
+{ports}\
+  );
+end entity;
+
+architecture a of {entity_name} is
+
+  -- Index of each register file.
+  -- The 'decode_error_index' is used when the address does not belong to any register file.
+{index_constants}\
+  constant decode_error_index : natural := {decode_error_index};
+
+  subtype select_t is natural range 0 to decode_error_index;
+
+  type m2s_vec_t is array (natural range <>) of axi_lite_m2s_t;
+  type s2m_vec_t is array (natural range <>) of axi_lite_s2m_t;
+
+  signal slaves_m2s : m2s_vec_t(0 to decode_error_index - 1) := (others => axi_lite_m2s_init);
+  signal slaves_s2m : s2m_vec_t(0 to decode_error_index - 1) := (others => axi_lite_s2m_init);
+
+  -- Compare only the address bits that are needed to tell the register files apart, and that are
+  -- above the decode window of the register file.
+  function decode(addr : u_unsigned) return select_t is
+  begin
+{self._get_decode_conditions()}\
+    return decode_error_index;
+  end function;
+
+  type state_t is (idle, address, response, response_pipelined);
+  signal read_state, write_state : state_t := idle;
+
+  signal read_select, write_select : select_t := decode_error_index;
+
+  signal write_address_done, write_data_done : std_ulogic := '0';
+
+  -- Response from register file, when 'pipeline_response' is enabled.
+  signal read_response, write_response : axi_lite_s2m_t := axi_lite_s2m_init;
+
+begin
+
+{port_assignments}\
+
+
+  ------------------------------------------------------------------------------
+  route : process(all)
+  begin
+    -- Address and data go to all register files, but valid and ready only to the selected one.
+    for slave_index in slaves_m2s'range loop
+      slaves_m2s(slave_index) <= axi_lite_m2s;
+
+      slaves_m2s(slave_index).read.ar.valid <= '0';
+      slaves_m2s(slave_index).read.r.ready <= '0';
+
+      slaves_m2s(slave_index).write.aw.valid <= '0';
+      slaves_m2s(slave_index).write.w.valid <= '0';
+      slaves_m2s(slave_index).write.b.ready <= '0';
+    end loop;
+
+    axi_lite_s2m <= axi_lite_s2m_init;
+
+    case read_state is
+      when idle =>
+        null;
+
+      when address =>
+        if read_select = decode_error_index then
+          axi_lite_s2m.read.ar.ready <= '1';
+        else
+          slaves_m2s(read_select).read.ar.valid <= axi_lite_m2s.read.ar.valid;
+          axi_lite_s2m.read.ar.ready <= slaves_s2m(read_select).read.ar.ready;
+        end if;
+
+      when response =>
+        if read_select = decode_error_index then
+          axi_lite_s2m.read.r.valid <= '1';
+          axi_lite_s2m.read.r.resp <= axi_resp_decerr;
+        elsif pipeline_response then
+          slaves_m2s(read_select).read.r.ready <= '1';
+        else
+          slaves_m2s(read_select).read.r.ready <= axi_lite_m2s.read.r.ready;
+          axi_lite_s2m.read.r <= slaves_s2m(read_select).read.r;
+        end if;
+
+      when response_pipelined =>
+        axi_lite_s2m.read.r <= read_response.read.r;
+        axi_lite_s2m.read.r.valid <= '1';
+    end case;
+
+    case write_state is
+      when idle =>
+        null;
+
+      when address =>
+        -- The address and data transactions can happen in any order.
+        if write_select = decode_error_index then
+          axi_lite_s2m.write.aw.ready <= not write_address_done;
+          axi_lite_s2m.write.w.ready <= not write_data_done;
+        else
+          slaves_m2s(write_select).write.aw.valid <=
+            axi_lite_m2s.write.aw.valid and not write_address_done;
+          slaves_m2s(write_select).write.w.valid <=
+            axi_lite_m2s.write.w.valid and not write_data_done;
+
+          axi_lite_s2m.write.aw.ready <=
+            slaves_s2m(write_select).write.aw.ready and not write_address_done;
+          axi_lite_s2m.write.w.ready <=
+            slaves_s2m(write_select).write.w.ready and not write_data_done;
+        end if;
+
+      when response =>
+        if write_select = decode_error_index then
+          axi_lite_s2m.write.b.valid <= '1';
+          axi_lite_s2m.write.b.resp <= axi_resp_decerr;
+        elsif pipeline_response then
+          slaves_m2s(write_select).write.b.ready <= '1';
+        else
+          slaves_m2s(write_select).write.b.ready <= axi_lite_m2s.write.b.ready;
+          axi_lite_s2m.write.b <= slaves_s2m(write_select).write.b;
+        end if;
+
+      when response_pipelined =>
+        axi_lite_s2m.write.b <= write_response.write.b;
+        axi_lite_s2m.write.b.valid <= '1';
+    end case;
+  end process;
+
+
+  ------------------------------------------------------------------------------
+  handle_read : process
+  begin
+    wait until rising_edge(clk);
+
+    case read_state is
+      when idle =>
+        if axi_lite_m2s.read.ar.valid then
+          read_select <= decode(axi_lite_m2s.read.ar.addr);
+          read_state <= address;
+        end if;
+
+      when address =>
+        if axi_lite_m2s.read.ar.valid and axi_lite_s2m.read.ar.ready then
+          read_state <= response;
+        end if;
+
+      when response =>
+        if pipeline_response and read_select /= decode_error_index then
+          if slaves_s2m(read_select).read.r.valid then
+            read_response.read.r <= slaves_s2m(read_select).read.r;
+            read_state <= response_pipelined;
+          end if;
+        elsif axi_lite_m2s.read.r.ready and axi_lite_s2m.read.r.valid then
+          read_state <= idle;
+        end if;
+
+      when response_pipelined =>
+        if axi_lite_m2s.read.r.ready then
+          read_state <= idle;
+        end if;
+    end case;
+  end process;
+
+
+  ------------------------------------------------------------------------------
+  handle_write : process
+    variable address_done, data_done : std_ulogic := '0';
+  begin
+    wait until rising_edge(clk);
+
+    case write_state is
+      when idle =>
+        if axi_lite_m2s.write.aw.valid then
+          write_select <= decode(axi_lite_m2s.write.aw.addr);
+          write_address_done <= '0';
+          write_data_done <= '0';
+          write_state <= address;
+        end if;
+
+      when address =>
+        address_done := write_address_done or (
+          axi_lite_m2s.write.aw.valid and axi_lite_s2m.write.aw.ready
+        );
+        data_done := write_data_done or (axi_lite_m2s.write.w.valid and axi_lite_s2m.write.w.ready);
+
+        write_address_done <= address_done;
+        write_data_done <= data_done;
+
+        if address_done and data_done then
+          write_state <= response;
+        end if;
+
+      when response =>
+        if pipeline_response and write_select /= decode_error_index then
+          if slaves_s2m(write_select).write.b.valid then
+            write_response.write.b <= slaves_s2m(write_select).write.b;
+            write_state <= response_pipelined;
+          end if;
+        elsif axi_lite_m2s.write.b.ready and axi_lite_s2m.write.b.valid then
+          write_state <= idle;
+        end if;
+
+      when response_pipelined =>
+        if axi_lite_m2s.write.b.ready then
+          write_state <= idle;
+        end if;
+    end case;
+  end process;
+
+end architecture;
+"""
+
+        return vhdl
+
+    def _get_decode_conditions(self) -> str:
+        decode_bits = self.get_decode_bits()
+
+        vhdl = ""
+        for register_list in self.decoded_register_lists:
+            bits = decode_bits[register_list.name]
+
+            comment = (
+                f"    -- '{register_list.name}' at 0x{register_list.base_address:08X}, "
+                f"decode window 0x{2 ** self.get_decode_window_bits(register_list):X} bytes.\n"
+            )
+            result = f"return {register_list.name}_index;"
+
+            if not bits:
+                vhdl += f"{comment}    {result}\n\n"
+                continue
+
+            condition = " and ".join(
+                f"addr({bit_index}) = '{register_list.base_address >> bit_index & 1}'"
+                for bit_index in bits
+            )
+            vhdl += f"""\
+{comment}\
+    if {condition} then
+      {result}
+    end if;
+
+"""
+
+        return vhdl
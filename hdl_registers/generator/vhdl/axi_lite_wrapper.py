@@ -9,7 +9,10 @@
 
 # Standard libraries
 from pathlib import Path
-from typing import Any
+from typing import TYPE_CHECKING, Any, Callable, Optional
+
+# First party libraries
+from hdl_registers.register import Register
 
 # Local folder libraries
 from .vhdl_generator_common import (
@@ -18,6 +21,13 @@ from .vhdl_generator_common import (
     VhdlGeneratorCommon,
 )
 
+if TYPE_CHECKING:
+    # First party libraries
+    from hdl_registers.register_array import RegisterArray
+
+    # Local folder libraries
+    from .vhdl_generator_common import BusAccessDirection
+
 
 class VhdlAxiLiteWrapperGenerator(VhdlGeneratorCommon):
     """
@@ -49,9 +59,26 @@ axi_lite_reg_file.vhd
 
     Similar concept for the ``reg_was_read`` and ``reg_was_written`` ports.
     They are only present if there are any readable/writeable registers in the register map.
+
+    Double-buffered registers, see :ref:`basic_feature_double_buffered`, are updated in
+    ``regs_down`` only when their commit register is written.
+
+    If register arrays have a power-of-two stride, see :ref:`basic_feature_register_array_stride`,
+    the register file holds only the register indexes that hold a register.
+    The wrapper then maps each register between its position in the register file and its
+    register index.
+
+    The ``data_width`` generic sets the data width of the register bus, 32 or 64.
+    With 32, the generic register file above is used, and each bus transaction accesses one
+    register.
+    With 64, a register file within the wrapper is used instead, where each bus transaction
+    accesses an eight-byte aligned word that holds two registers.
+    The two registers are read, or written, in the same clock cycle.
+    So a register pair, see :ref:`basic_feature_register_pairs`, is accessed atomically.
+    Note that the base address of the register map must then be eight-byte aligned.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "1.4.0"
 
     SHORT_DESCRIPTION = "VHDL AXI-Lite register file"
 
@@ -92,6 +119,11 @@ axi_lite_reg_file.vhd
         # Hence it is safe to always end the 'regs_up'/'regs_down' ports with a semicolon.
         entity = f"""\
 entity {entity_name} is
+  generic (
+    -- Data width of the register bus, 32 or 64.
+    -- With 64, each bus transaction accesses an eight-byte aligned word that holds two registers.
+    data_width : positive := 32
+  );
   port (
     clk : in std_ulogic;
     --# {{}}
@@ -110,25 +142,23 @@ entity {entity_name} is
 end entity;
 """
 
-        up_conversion = """
+        up_conversion = f"""
 
   ------------------------------------------------------------------------------
   -- Combinatorially convert the register record to a list of SLV values that can be handled
   -- by the generic register file implementation.
-  assign_regs_up : process(regs_up)
-  begin
-    regs_up_slv <= to_slv(regs_up);
-  end process;
+  -- Each register is converted in its own concurrent statement, so that a value change in one
+  -- register does not trigger a conversion of all the other registers.
+{self._get_regs_up_conversion()}\
 """
         down_conversion = f"""
 
   ------------------------------------------------------------------------------
   -- Combinatorially convert the list of SLV values from the generic register file into the record
   -- we want to use in our application.
-  assign_regs_down : process(regs_down_slv)
-  begin
-    regs_down <= to_{self.name}_regs_down(regs_down_slv);
-  end process;
+  -- Each register is converted in its own concurrent statement, so that a value change in one
+  -- register does not trigger a conversion of all the other registers.
+{self._get_regs_down_conversion()}\
 """
 
         was_read_conversion = f"""
@@ -136,10 +166,7 @@ end entity;
   ------------------------------------------------------------------------------
   -- Combinatorially convert status mask to a record where only the applicable registers \
 are present.
-  assign_reg_was_read : process(reg_was_read_slv)
-  begin
-    reg_was_read <= to_{self.name}_reg_was_read(reg_was_read_slv);
-  end process;
+{self._get_reg_was_accessed_conversion(direction=BUS_ACCESS_DIRECTIONS["read"])}\
 """
 
         was_written_conversion = f"""
@@ -147,12 +174,18 @@ are present.
   ------------------------------------------------------------------------------
   -- Combinatorially convert status mask to a record where only the applicable registers \
 are present.
-  assign_reg_was_written : process(reg_was_written_slv)
-  begin
-    reg_was_written <= to_{self.name}_reg_was_written(reg_was_written_slv);
-  end process;
+{self._get_reg_was_accessed_conversion(direction=BUS_ACCESS_DIRECTIONS["write"])}\
 """
 
+        ports = ["regs_up", "regs_down", "reg_was_read", "reg_was_written"]
+        if self.has_unused_register_indexes:
+            reg_file_signals = {port: f"reg_file_{port}" for port in ports}
+            default_values = "reg_file_default_values"
+        else:
+            # The register file is connected directly to the signals indexed by register index.
+            reg_file_signals = {port: f"{port}_slv" for port in ports}
+            default_values = f"{self.name}_regs_init"
+
         vhdl = f"""\
 -- -----------------------------------------------------------------------------
 -- AXI-Lite register file for the '{self.name}' module registers.
@@ -171,6 +204,7 @@ use ieee.std_logic_1164.all;
 
 library axi;
 use axi.axi_lite_pkg.all;
+use axi.axi_pkg.all;
 
 library reg_file;
 use reg_file.reg_file_pkg.all;
@@ -187,33 +221,46 @@ architecture a of {entity_name} is
   signal reg_was_read_slv, reg_was_written_slv : {self.name}_reg_was_accessed_t := (
     others => '0'
   );
-
+{self._get_reg_file_declarations()}
 begin
 
+  assert data_width = 32 or data_width = 64
+    report "Invalid data width: " & integer'image(data_width)
+    severity failure;
+
+
   ------------------------------------------------------------------------------
-  -- Instantiate the generic AXI-Lite register file from
-  -- * https://hdl-modules.com/modules/reg_file/reg_file.html#axi-lite-reg-file-vhd
-  -- * https://github.com/hdl-modules/hdl-modules/blob/main/modules/reg_file/src/\
+  data_width_32_gen : if data_width = 32 generate
+
+    ------------------------------------------------------------------------------
+    -- Instantiate the generic AXI-Lite register file from
+    -- * https://hdl-modules.com/modules/reg_file/reg_file.html#axi-lite-reg-file-vhd
+    -- * https://github.com/hdl-modules/hdl-modules/blob/main/modules/reg_file/src/\
 axi_lite_reg_file.vhd
-  axi_lite_reg_file_inst : entity reg_file.axi_lite_reg_file
-    generic map (
-      regs => {self.name}_reg_map,
-      default_values => {self.name}_regs_init
-    )
-    port map(
-      clk => clk,
-      --
-      axi_lite_m2s => axi_lite_m2s,
-      axi_lite_s2m => axi_lite_s2m,
-      --
-      regs_up => regs_up_slv,
-      regs_down => regs_down_slv,
-      --
-      reg_was_read => reg_was_read_slv,
-      reg_was_written => reg_was_written_slv
-    );
+    axi_lite_reg_file_inst : entity reg_file.axi_lite_reg_file
+      generic map (
+        regs => {self.name}_reg_map,
+        default_values => {default_values}
+      )
+      port map(
+        clk => clk,
+        --
+        axi_lite_m2s => axi_lite_m2s,
+        axi_lite_s2m => axi_lite_s2m,
+        --
+        regs_up => {reg_file_signals['regs_up']},
+        regs_down => {reg_file_signals['regs_down']},
+        --
+        reg_was_read => {reg_file_signals['reg_was_read']},
+        reg_was_written => {reg_file_signals['reg_was_written']}
+      );
+{self._get_reg_file_assignments()}\
+
+  end generate;
+{self._get_data_width_64_register_file()}\
 {up_conversion if has_any_up else ""}\
 {down_conversion if has_any_down else ""}\
+{self._get_commit_processes()}\
 {was_read_conversion if was_read_port else ""}\
 {was_written_conversion if was_written_port else ""}\
 
@@ -222,6 +269,246 @@ end architecture;
 
         return vhdl
 
+    def _get_reg_file_declarations(self) -> str:
+        """
+        Signals for the register file ports, if the register file holds only a subset of the
+        register indexes.
+        """
+        if not self.has_unused_register_indexes:
+            return ""
+
+        return f"""
+  -- The register file holds only the register indexes that hold a register.
+  -- The position of a register in the register file is not the same as its register index.
+  subtype reg_file_range is natural range {self.name}_reg_map'range;
+
+  function get_reg_file_default_values return reg_vec_t is
+    variable result : reg_vec_t(reg_file_range) := (others => (others => '0'));
+  begin
+    for list_index in result'range loop
+      result(list_index) := {self.name}_regs_init({self.name}_reg_map(list_index).idx);
+    end loop;
+
+    return result;
+  end function;
+  constant reg_file_default_values : reg_vec_t(reg_file_range) := get_reg_file_default_values;
+
+  signal reg_file_regs_up, reg_file_regs_down : reg_vec_t(reg_file_range) := (
+    reg_file_default_values
+  );
+
+  signal reg_file_reg_was_read, reg_file_reg_was_written : std_ulogic_vector(reg_file_range) := (
+    others => '0'
+  );
+"""
+
+    def _get_reg_file_assignments(self) -> str:
+        """
+        Concurrent statements that move each register between its position in the register file
+        and its register index, if the register file holds only a subset of the register indexes.
+        """
+        if not self.has_unused_register_indexes:
+            return ""
+
+        return f"""
+
+    ------------------------------------------------------------------------------
+    -- Move each register between its position in the register file and its register index.
+    -- Unused register indexes are not driven, and keep their default value.
+    assign_reg_file : for list_index in reg_file_range generate
+      constant reg_index : {self.name}_reg_range := {self.name}_reg_map(list_index).idx;
+    begin
+      reg_file_regs_up(list_index) <= regs_up_slv(reg_index);
+      regs_down_slv(reg_index) <= reg_file_regs_down(list_index);
+      reg_was_read_slv(reg_index) <= reg_file_reg_was_read(list_index);
+      reg_was_written_slv(reg_index) <= reg_file_reg_was_written(list_index);
+    end generate;
+"""
+
+    def _get_data_width_64_register_file(self) -> str:
+        """
+        Register file for a 64-bit register bus, where each bus transaction accesses the two
+        registers in an eight-byte aligned word.
+        Uses the same signals, indexed by register index, as the generic register file.
+        """
+        return f"""
+
+  ------------------------------------------------------------------------------
+  -- Register file for a 64-bit register bus.
+  -- Each bus transaction accesses an eight-byte aligned word that holds two registers: the
+  -- register at the even index in bits 31:0, and the register after it in bits 63:32.
+  -- The two registers are read, or written, in the same clock cycle.
+  --
+  -- A register that is not readable reads as zero.
+  -- A read gets an error response if none of the two registers is readable.
+  -- A register is written if any of its byte strobes is set.
+  -- A write gets an error response, and writes nothing, if any strobed register is not
+  -- writeable.
+  data_width_64_gen : if data_width = 64 generate
+
+    -- Padded with one index if the last register is at an even index, so that the last word
+    -- holds two register indexes.
+    subtype reg_index_t is natural range 0 to 2 * {self.name}_reg_word_range'high + 1;
+
+    type reg_info_t is record
+      is_read : boolean;
+      is_write : boolean;
+      -- Fabric gives the value that is read.
+      is_up : boolean;
+      -- Written value is asserted for one clock cycle only.
+      is_pulse : boolean;
+    end record;
+    type reg_info_vec_t is array (reg_index_t) of reg_info_t;
+
+    function get_reg_info return reg_info_vec_t is
+      -- Register indexes that hold no register are neither readable nor writeable.
+      variable result : reg_info_vec_t := (others => (others => false));
+      variable reg_type : reg_type_t := r;
+    begin
+      for list_index in {self.name}_reg_map'range loop
+        reg_type := {self.name}_reg_map(list_index).reg_type;
+
+        result({self.name}_reg_map(list_index).idx) := (
+          is_read => reg_type = r or reg_type = r_w or reg_type = r_wpulse,
+          is_write => reg_type /= r,
+          is_up => reg_type = r or reg_type = r_wpulse,
+          is_pulse => reg_type = wpulse or reg_type = r_wpulse
+        );
+      end loop;
+
+      return result;
+    end function;
+    constant reg_info : reg_info_vec_t := get_reg_info;
+
+  begin
+
+    ------------------------------------------------------------------------------
+    handle_read : process
+      variable word_index : natural := 0;
+      variable reg_index : reg_index_t := 0;
+      variable is_ok : boolean := false;
+    begin
+      wait until rising_edge(clk);
+
+      reg_was_read_slv <= (others => '0');
+
+      if axi_lite_s2m.read.r.valid then
+        if axi_lite_m2s.read.r.ready then
+          axi_lite_s2m.read.r.valid <= '0';
+        end if;
+
+      elsif axi_lite_s2m.read.ar.ready then
+        -- Address handshake happens in this clock cycle, since 'valid' is held until 'ready'.
+        axi_lite_s2m.read.ar.ready <= '0';
+        axi_lite_s2m.read.r.valid <= '1';
+        axi_lite_s2m.read.r.data <= (others => '0');
+
+        word_index := {self.name}_reg_word_index(axi_lite_m2s.read.ar.addr);
+        is_ok := false;
+
+        if word_index <= {self.name}_reg_word_range'high then
+          for lane in 0 to 1 loop
+            reg_index := 2 * word_index + lane;
+
+            if reg_info(reg_index).is_read then
+              is_ok := true;
+              reg_was_read_slv(reg_index) <= '1';
+
+              if reg_info(reg_index).is_up then
+                axi_lite_s2m.read.r.data(32 * lane + 31 downto 32 * lane) <= (
+                  regs_up_slv(reg_index)
+                );
+              else
+                axi_lite_s2m.read.r.data(32 * lane + 31 downto 32 * lane) <= (
+                  regs_down_slv(reg_index)
+                );
+              end if;
+            end if;
+          end loop;
+        end if;
+
+        if is_ok then
+          axi_lite_s2m.read.r.resp <= axi_resp_okay;
+        else
+          axi_lite_s2m.read.r.resp <= axi_resp_slverr;
+        end if;
+
+      elsif axi_lite_m2s.read.ar.valid then
+        axi_lite_s2m.read.ar.ready <= '1';
+      end if;
+    end process;
+
+
+    ------------------------------------------------------------------------------
+    handle_write : process
+      variable word_index : natural := 0;
+      variable reg_index : reg_index_t := 0;
+      variable is_strobed : boolean_vector(0 to 1) := (others => false);
+      variable is_ok : boolean := false;
+    begin
+      wait until rising_edge(clk);
+
+      reg_was_written_slv <= (others => '0');
+
+      -- Registers of a pulse type hold the written value for one clock cycle only.
+      for pulse_index in regs_down_slv'range loop
+        if reg_info(pulse_index).is_pulse then
+          regs_down_slv(pulse_index) <= {self.name}_regs_init(pulse_index);
+        end if;
+      end loop;
+
+      if axi_lite_s2m.write.b.valid then
+        if axi_lite_m2s.write.b.ready then
+          axi_lite_s2m.write.b.valid <= '0';
+        end if;
+
+      elsif axi_lite_s2m.write.aw.ready then
+        -- Address and data handshakes happen in this clock cycle, since 'valid' is held
+        -- until 'ready'.
+        axi_lite_s2m.write.aw.ready <= '0';
+        axi_lite_s2m.write.w.ready <= '0';
+        axi_lite_s2m.write.b.valid <= '1';
+
+        word_index := {self.name}_reg_word_index(axi_lite_m2s.write.aw.addr);
+        is_ok := word_index <= {self.name}_reg_word_range'high;
+
+        if is_ok then
+          for lane in 0 to 1 loop
+            reg_index := 2 * word_index + lane;
+            is_strobed(lane) := (or axi_lite_m2s.write.w.strb(4 * lane + 3 downto 4 * lane)) = '1';
+
+            if is_strobed(lane) and not reg_info(reg_index).is_write then
+              is_ok := false;
+            end if;
+          end loop;
+        end if;
+
+        if is_ok then
+          for lane in 0 to 1 loop
+            reg_index := 2 * word_index + lane;
+
+            if is_strobed(lane) then
+              regs_down_slv(reg_index) <= (
+                axi_lite_m2s.write.w.data(32 * lane + 31 downto 32 * lane)
+              );
+              reg_was_written_slv(reg_index) <= '1';
+            end if;
+          end loop;
+
+          axi_lite_s2m.write.b.resp <= axi_resp_okay;
+        else
+          axi_lite_s2m.write.b.resp <= axi_resp_slverr;
+        end if;
+
+      elsif axi_lite_m2s.write.aw.valid and axi_lite_m2s.write.w.valid then
+        axi_lite_s2m.write.aw.ready <= '1';
+        axi_lite_s2m.write.w.ready <= '1';
+      end if;
+    end process;
+
+  end generate;
+"""
+
     def _get_was_accessed_ports(self) -> tuple[str, str]:
         has_any_read = self.has_any_bus_accessible_register(direction=BUS_ACCESS_DIRECTIONS["read"])
         has_any_write = self.has_any_bus_accessible_register(
@@ -251,3 +538,204 @@ end architecture;
             was_read += ";\n" if was_written else "\n"
 
         return was_read, was_written
+
+    def _get_regs_up_conversion(self) -> str:
+        """
+        Concurrent statements that convert each 'up' register from the record to SLV.
+        """
+
+        def _get_assignment(
+            register: "Register", register_array: Optional["RegisterArray"], indent: str
+        ) -> str:
+            register_name = self.qualified_register_name(
+                register=register, register_array=register_array
+            )
+
+            if register_array is None:
+                result = f"regs_up_slv({register_name})"
+                record = f"regs_up.{register.name}"
+            else:
+                result = f"regs_up_slv({register_name}(array_index))"
+                record = f"regs_up.{register_array.name}(array_index).{register.name}"
+
+            value = f"to_slv({record})" if register.fields else record
+
+            return f"{indent}{result} <= {value};\n"
+
+        return self._get_concurrent_assignments(
+            label="assign_regs_up",
+            get_assignment=_get_assignment,
+            register_is_included=FABRIC_ACCESS_DIRECTIONS["up"].register_is_accessible,
+        )
+
+    def _get_regs_down_assignment(
+        self, register: "Register", register_array: Optional["RegisterArray"], indent: str
+    ) -> str:
+        """
+        Statement that converts one 'down' register from SLV to the record.
+        """
+        register_name = self.qualified_register_name(
+            register=register, register_array=register_array
+        )
+
+        if register_array is None:
+            result = f"regs_down.{register.name}"
+            data = f"regs_down_slv({register_name})"
+        else:
+            result = f"regs_down.{register_array.name}(array_index).{register.name}"
+            data = f"regs_down_slv({register_name}(array_index))"
+
+        value = f"to_{register_name}({data})" if register.fields else data
+
+        return f"{indent}{result} <= {value};\n"
+
+    def _get_regs_down_conversion(self) -> str:
+        """
+        Concurrent statements that convert each 'down' register from SLV to the record.
+        Double-buffered registers are instead converted in their commit process.
+        """
+        commit_registers = self.register_list.get_commit_registers()
+
+        def _get_assignment(
+            register: "Register", register_array: Optional["RegisterArray"], indent: str
+        ) -> str:
+            name = register.name if register_array is None else register_array.name
+            if name in commit_registers:
+                return ""
+
+            return self._get_regs_down_assignment(
+                register=register, register_array=register_array, indent=indent
+            )
+
+        return self._get_concurrent_assignments(
+            label="assign_regs_down",
+            get_assignment=_get_assignment,
+            register_is_included=FABRIC_ACCESS_DIRECTIONS["down"].register_is_accessible,
+        )
+
+    def _get_commit_processes(self) -> str:
+        """
+        One process for each commit register, that updates all its double-buffered registers
+        in 'regs_down' when the commit register is written.
+        """
+        vhdl = ""
+        register_objects = {
+            register_object.name: register_object
+            for register_object in self.iterate_register_objects()
+        }
+
+        for register_object in register_objects.values():
+            if not isinstance(register_object, Register) or not register_object.commits:
+                continue
+
+            body = ""
+            for name in register_object.commits:
+                committed = register_objects[name]
+
+                if isinstance(committed, Register):
+                    body += self._get_regs_down_assignment(
+                        register=committed, register_array=None, indent="      "
+                    )
+                    continue
+
+                array_name = self.qualified_register_array_name(register_array=committed)
+                body += f"      for array_index in {array_name}_range loop\n"
+                for register in committed.registers:
+                    body += self._get_regs_down_assignment(
+                        register=register, register_array=committed, indent="        "
+                    )
+                body += "      end loop;\n"
+
+            commit_name = self.qualified_register_name(register=register_object)
+            vhdl += f"""
+
+  ------------------------------------------------------------------------------
+  -- Double-buffered registers that are committed by the '{register_object.name}' register.
+  -- Bus writes are stored in the register file, which acts as the shadow bank.
+  -- The values are copied to 'regs_down', all in the same clock cycle, when
+  -- '{register_object.name}' is written.
+  -- Until then, 'regs_down' holds the default values.
+  commit_{register_object.name} : process
+  begin
+    wait until rising_edge(clk);
+
+    if reg_was_written_slv({commit_name}) = '1' then
+{body}\
+    end if;
+  end process;
+"""
+
+        return vhdl
+
+    def _get_reg_was_accessed_conversion(self, direction: "BusAccessDirection") -> str:
+        """
+        Concurrent statements that pick out the status bit of each register accessible in
+        the given direction.
+        """
+
+        def _get_assignment(
+            register: "Register", register_array: Optional["RegisterArray"], indent: str
+        ) -> str:
+            register_name = self.qualified_register_name(
+                register=register, register_array=register_array
+            )
+
+            if register_array is None:
+                result = f"reg_was_{direction.name_past}.{register.name}"
+                data = f"reg_was_{direction.name_past}_slv({register_name})"
+            else:
+                result = (
+                    f"reg_was_{direction.name_past}.{register_array.name}(array_index)"
+                    f".{register.name}"
+                )
+                data = f"reg_was_{direction.name_past}_slv({register_name}(array_index))"
+
+            return f"{indent}{result} <= {data};\n"
+
+        return self._get_concurrent_assignments(
+            label=f"assign_reg_was_{direction.name_past}",
+            get_assignment=_get_assignment,
+            register_is_included=direction.register_is_accessible,
+        )
+
+    def _get_concurrent_assignments(
+        self,
+        label: str,
+        get_assignment: Callable[["Register", Optional["RegisterArray"], str], str],
+        register_is_included: Callable[["Register"], bool],
+    ) -> str:
+        """
+        Get concurrent VHDL statements for all included registers in the register list, in order.
+        Registers in a register array are placed within a 'for generate' over the array range,
+        with the generate parameter 'array_index'.
+
+        Arguments:
+            label: Prefix for the label of the 'for generate' statements.
+            get_assignment: Function that returns the VHDL statement for one register.
+                Arguments are the register, the register array (or ``None`` if plain register)
+                and the indentation to use.
+            register_is_included: Function that returns True if a register shall be included.
+        """
+        vhdl = ""
+
+        for register_object in self.iterate_register_objects():
+            if isinstance(register_object, Register):
+                if register_is_included(register_object):
+                    vhdl += get_assignment(register_object, None, "  ")
+
+                continue
+
+            generate_body = ""
+            for register in register_object.registers:
+                if register_is_included(register):
+                    generate_body += get_assignment(register, register_object, "    ")
+
+            if generate_body:
+                array_name = self.qualified_register_array_name(register_array=register_object)
+                vhdl += f"""\
+  {label}_{register_object.name} : for array_index in {array_name}_range generate
+{generate_body}\
+  end generate;
+"""
+
+        return vhdl
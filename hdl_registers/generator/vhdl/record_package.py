@@ -9,13 +9,14 @@
 
 # Standard libraries
 from pathlib import Path
-from typing import TYPE_CHECKING, Any, Optional
+from typing import TYPE_CHECKING, Any, Callable, Optional
 
 # First party libraries
 from hdl_registers.field.bit import Bit
 from hdl_registers.field.bit_vector import BitVector
 from hdl_registers.field.enumeration import Enumeration
 from hdl_registers.field.integer import Integer
+from hdl_registers.register import Register
 
 # Local folder libraries
 from .vhdl_generator_common import (
@@ -26,7 +27,6 @@ from .vhdl_generator_common import (
 
 if TYPE_CHECKING:
     # First party libraries
-    from hdl_registers.register import Register
     from hdl_registers.register_array import RegisterArray
 
     # Local folder libraries
@@ -53,7 +53,7 @@ class VhdlRecordPackageGenerator(VhdlGeneratorCommon):
     from :class:`.VhdlRegisterPackageGenerator`.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "1.1.0"
 
     SHORT_DESCRIPTION = "VHDL record package"
 
@@ -500,35 +500,35 @@ of {array_name}_was_{direction.name_past}_t;
         Conversion function implementation for converting a record of all the 'up' registers
         to a register SLV list.
 
+        Registers in arrays are converted with a VHDL 'for' loop over the array range, so that
+        the size of the function does not grow with the length of the array.
+
         This function assumes that the register map has registers in the given direction.
         """
-        to_slv = ""
+        direction = FABRIC_ACCESS_DIRECTIONS["up"]
 
-        for register, register_array in self.iterate_fabric_accessible_registers(
-            direction=FABRIC_ACCESS_DIRECTIONS["up"]
-        ):
+        def _get_assignment(
+            register: "Register", register_array: Optional["RegisterArray"], indent: str
+        ) -> str:
             register_name = self.qualified_register_name(
                 register=register, register_array=register_array
             )
 
             if register_array is None:
-                result = f"    result({register_name})"
+                result = f"result({register_name})"
                 record = f"data.{register.name}"
+            else:
+                result = f"result({register_name}(array_index))"
+                record = f"data.{register_array.name}(array_index).{register.name}"
 
-                if register.fields:
-                    to_slv += f"{result} := to_slv({record});\n"
-                else:
-                    to_slv += f"{result} := {record};\n"
+            value = f"to_slv({record})" if register.fields else record
 
-            else:
-                for array_idx in range(register_array.length):
-                    result = f"    result({register_name}({array_idx}))"
-                    record = f"data.{register_array.name}({array_idx}).{register.name}"
+            return f"{indent}{result} := {value};\n"
 
-                    if register.fields:
-                        to_slv += f"{result} := to_slv({record});\n"
-                    else:
-                        to_slv += f"{result} := {record};\n"
+        to_slv = self._iterate_with_array_loops(
+            get_assignment=_get_assignment,
+            register_is_included=direction.register_is_accessible,
+        )
 
         return f"""\
   function to_slv(data : {self.name}_regs_up_t) return {self.name}_regs_t is
@@ -545,35 +545,35 @@ of {array_name}_was_{direction.name_past}_t;
         Conversion function implementation for converting all the 'down' registers
         in a register SLV list to record.
 
+        Registers in arrays are converted with a VHDL 'for' loop over the array range, so that
+        the size of the function does not grow with the length of the array.
+
         This function assumes that the register map has registers in the given direction.
         """
-        to_record = ""
+        direction = FABRIC_ACCESS_DIRECTIONS["down"]
 
-        for register, register_array in self.iterate_fabric_accessible_registers(
-            direction=FABRIC_ACCESS_DIRECTIONS["down"]
-        ):
+        def _get_assignment(
+            register: "Register", register_array: Optional["RegisterArray"], indent: str
+        ) -> str:
             register_name = self.qualified_register_name(
                 register=register, register_array=register_array
             )
 
             if register_array is None:
-                result = f"    result.{register.name}"
+                result = f"result.{register.name}"
                 data = f"data({register_name})"
+            else:
+                result = f"result.{register_array.name}(array_index).{register.name}"
+                data = f"data({register_name}(array_index))"
 
-                if register.fields:
-                    to_record += f"{result} := to_{register_name}({data});\n"
-                else:
-                    to_record += f"{result} := {data};\n"
+            value = f"to_{register_name}({data})" if register.fields else data
 
-            else:
-                for array_idx in range(register_array.length):
-                    result = f"    result.{register_array.name}({array_idx}).{register.name}"
-                    data = f"data({register_name}({array_idx}))"
+            return f"{indent}{result} := {value};\n"
 
-                    if register.fields:
-                        to_record += f"{result} := to_{register_name}({data});\n"
-                    else:
-                        to_record += f"{result} := {data};\n"
+        to_record = self._iterate_with_array_loops(
+            get_assignment=_get_assignment,
+            register_is_included=direction.register_is_accessible,
+        )
 
         return f"""\
   function to_{self.name}_regs_down(data : {self.name}_regs_t) return \
@@ -586,6 +586,46 @@ of {array_name}_was_{direction.name_past}_t;
 
 """
 
+    def _iterate_with_array_loops(
+        self,
+        get_assignment: Callable[["Register", Optional["RegisterArray"], str], str],
+        register_is_included: Callable[["Register"], bool],
+    ) -> str:
+        """
+        Get VHDL statements for all included registers in the register list, in order.
+        Registers in a register array are placed within a VHDL 'for' loop over the array range,
+        with the loop variable 'array_index'.
+
+        Arguments:
+            get_assignment: Function that returns the VHDL statement for one register.
+                Arguments are the register, the register array (or ``None`` if plain register)
+                and the indentation to use.
+            register_is_included: Function that returns True if a register shall be included.
+        """
+        vhdl = ""
+
+        for register_object in self.iterate_register_objects():
+            if isinstance(register_object, Register):
+                if register_is_included(register_object):
+                    vhdl += get_assignment(register_object, None, "    ")
+
+                continue
+
+            loop_body = ""
+            for register in register_object.registers:
+                if register_is_included(register):
+                    loop_body += get_assignment(register, register_object, "      ")
+
+            if loop_body:
+                array_name = self.qualified_register_array_name(register_array=register_object)
+                vhdl += f"""\
+    for array_index in {array_name}_range loop
+{loop_body}\
+    end loop;
+"""
+
+        return vhdl
+
     def _register_was_accessed_conversion_implementations(self) -> str:
         """
         Get conversion functions from SLV 'reg_was_read'/'reg_was_written' to record types.
@@ -613,23 +653,25 @@ of {array_name}_was_{direction.name_past}_t;
   begin
 """
 
-        for register in self.iterate_bus_accessible_plain_registers(direction=direction):
-            register_name = self.qualified_register_name(register=register)
-            vhdl += f"    result.{register.name} := data({register_name});\n"
+        def _get_assignment(
+            register: "Register", register_array: Optional["RegisterArray"], indent: str
+        ) -> str:
+            register_name = self.qualified_register_name(
+                register=register, register_array=register_array
+            )
 
-        for array in self.iterate_register_arrays():
-            for register in self.iterate_bus_accessible_array_registers(
-                register_array=array, direction=direction
-            ):
-                register_name = self.qualified_register_name(
-                    register=register, register_array=array
-                )
+            if register_array is None:
+                return f"{indent}result.{register.name} := data({register_name});\n"
+
+            return (
+                f"{indent}result.{register_array.name}(array_index).{register.name} := "
+                f"data({register_name}(array_index=>array_index));\n"
+            )
 
-                for array_index in range(array.length):
-                    vhdl += (
-                        f"    result.{array.name}({array_index}).{register.name} := "
-                        f"data({register_name}(array_index=>{array_index}));\n"
-                    )
+        vhdl += self._iterate_with_array_loops(
+            get_assignment=_get_assignment,
+            register_is_included=direction.register_is_accessible,
+        )
 
         return f"""\
 {vhdl}
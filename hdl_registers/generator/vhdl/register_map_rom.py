@@ -0,0 +1,206 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+from pathlib import Path
+from typing import Any
+
+# First party libraries
+from hdl_registers.generator.register_map_rom import RegisterMapRom
+
+# Local folder libraries
+from .vhdl_generator_common import VhdlGeneratorCommon
+
+# Number of ROM words on each line of the generated constant.
+WORDS_PER_LINE = 4
+
+
+class VhdlRegisterMapRomGenerator(VhdlGeneratorCommon):
+    """
+    Generate a VHDL entity with a ROM that describes the register map, accessed over AXI-Lite.
+    See the :ref:`generator_register_map_rom` article for usage details.
+
+    The ROM content is the encoded register map from :class:`.RegisterMapRom`.
+    It is intended to be placed at a fixed base address in the register space, so that software
+    can read it at startup to discover and validate the register map.
+    Each read over AXI-Lite returns one word.
+
+    The ROM is padded with zeros to a power-of-two number of words.
+    Only the address bits within the padded ROM are decoded, so reads past the padding return
+    words of the ROM again, i.e. the ROM is aliased over the address space of the slave.
+    Writes are answered with a ``SLVERR`` response.
+    The read data is registered, so the ROM can be mapped to block RAM.
+    """
+
+    __version__ = "1.0.1"
+
+    SHORT_DESCRIPTION = "VHDL register map ROM"
+
+    @property
+    def output_file(self) -> Path:
+        """
+        Result will be placed in this file.
+        """
+        return self.output_folder / f"{self.name}_register_map_rom.vhd"
+
+    def get_code(self, **kwargs: Any) -> str:
+        """
+        Get VHDL code for the register map ROM entity.
+        """
+        entity_name = self.output_file.stem
+
+        words = RegisterMapRom(register_list=self.register_list).get_words()
+        # Number of address bits needed to index a word in the ROM.
+        word_address_width = (len(words) - 1).bit_length()
+
+        vhdl = f"""\
+-- -----------------------------------------------------------------------------
+-- Read-only AXI-Lite slave with the encoded '{self.name}' register map.
+--
+-- Reads return one word of the ROM.
+-- Writes are answered with a SLVERR response.
+-- The ROM is padded with zeros to a power-of-two number of words.
+-- Only the address bits within the padded ROM are decoded, so the ROM is
+-- aliased over the rest of the address space of the slave.
+-- -----------------------------------------------------------------------------
+{self.header}\
+-- -----------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library axi;
+use axi.axi_pkg.all;
+use axi.axi_lite_pkg.all;
+
+
+entity {entity_name} is
+  port (
+    clk : in std_ulogic;
+    --# {{}}
+    axi_lite_m2s : in axi_lite_m2s_t;
+    axi_lite_s2m : out axi_lite_s2m_t := axi_lite_s2m_init
+  );
+end entity;
+
+architecture a of {entity_name} is
+
+  -- The content is {len(words)} words, padded with zeros to a power of two.
+  constant word_address_width : positive := {word_address_width};
+
+  subtype word_t is std_ulogic_vector(32 - 1 downto 0);
+  type rom_t is array (0 to 2 ** word_address_width - 1) of word_t;
+
+  constant rom : rom_t := (
+{self._get_rom_words(words=words)}
+    others => (others => '0')
+  );
+
+  type state_t is (address, response);
+  signal read_state, write_state : state_t := address;
+
+  signal read_data : word_t := (others => '0');
+
+  signal write_address_done, write_data_done : std_ulogic := '0';
+
+begin
+
+  ------------------------------------------------------------------------------
+  assign : process(all)
+  begin
+    axi_lite_s2m <= axi_lite_s2m_init;
+
+    case read_state is
+      when address =>
+        axi_lite_s2m.read.ar.ready <= '1';
+
+      when response =>
+        axi_lite_s2m.read.r.valid <= '1';
+        axi_lite_s2m.read.r.data(read_data'range) <= read_data;
+        axi_lite_s2m.read.r.resp <= axi_resp_okay;
+    end case;
+
+    case write_state is
+      when address =>
+        -- The address and data transactions can happen in any order.
+        axi_lite_s2m.write.aw.ready <= not write_address_done;
+        axi_lite_s2m.write.w.ready <= not write_data_done;
+
+      when response =>
+        axi_lite_s2m.write.b.valid <= '1';
+        axi_lite_s2m.write.b.resp <= axi_resp_slverr;
+    end case;
+  end process;
+
+
+  ------------------------------------------------------------------------------
+  handle_read : process
+    variable word_index : natural range rom'range := 0;
+  begin
+    wait until rising_edge(clk);
+
+    case read_state is
+      when address =>
+        if axi_lite_m2s.read.ar.valid then
+          word_index := to_integer(axi_lite_m2s.read.ar.addr(word_address_width + 1 downto 2));
+          read_data <= rom(word_index);
+          read_state <= response;
+        end if;
+
+      when response =>
+        if axi_lite_m2s.read.r.ready then
+          read_state <= address;
+        end if;
+    end case;
+  end process;
+
+
+  ------------------------------------------------------------------------------
+  handle_write : process
+    variable address_done, data_done : std_ulogic := '0';
+  begin
+    wait until rising_edge(clk);
+
+    case write_state is
+      when address =>
+        address_done := write_address_done or (
+          axi_lite_m2s.write.aw.valid and axi_lite_s2m.write.aw.ready
+        );
+        data_done := write_data_done or (axi_lite_m2s.write.w.valid and axi_lite_s2m.write.w.ready);
+
+        write_address_done <= address_done;
+        write_data_done <= data_done;
+
+        if address_done and data_done then
+          write_state <= response;
+        end if;
+
+      when response =>
+        if axi_lite_m2s.write.b.ready then
+          write_address_done <= '0';
+          write_data_done <= '0';
+          write_state <= address;
+        end if;
+    end case;
+  end process;
+
+end architecture;
+"""
+
+        return vhdl
+
+    @staticmethod
+    def _get_rom_words(words: list[int]) -> str:
+        lines = []
+        for line_index in range(0, len(words), WORDS_PER_LINE):
+            line_words = words[line_index : line_index + WORDS_PER_LINE]
+            lines.append("    " + " ".join(f'x"{word:08X}",' for word in line_words))
+
+        return "\n".join(lines)
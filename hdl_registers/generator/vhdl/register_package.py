@@ -12,6 +12,7 @@ from pathlib import Path
 from typing import TYPE_CHECKING, Any
 
 # First party libraries
+from hdl_registers.constant.array_constant import ArrayConstant
 from hdl_registers.constant.bit_vector_constant import UnsignedVectorConstant
 from hdl_registers.constant.boolean_constant import BooleanConstant
 from hdl_registers.constant.float_constant import FloatConstant
@@ -52,9 +53,11 @@ class VhdlRegisterPackageGenerator(VhdlGeneratorCommon):
 
     Also produces a register map constant, mapping indexes to modes, suitable for use with
     :ref:`reg_file.axi_lite_reg_file` or :class:`.VhdlAxiLiteWrapperGenerator`.
+    As well as the address width of the register map, and a function that gives the index of the
+    64-bit word that an address falls within, for use with a 64-bit register bus.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "1.4.0"
 
     SHORT_DESCRIPTION = "VHDL register package"
 
@@ -91,6 +94,7 @@ package {pkg_name} is
         if self.register_list.register_objects:
             vhdl += f"""\
 {self._register_range()}\
+{self._register_addresses()}\
 {self._array_constants()}\
 {self._register_indexes()}\
 {self._register_map_head()}\
@@ -103,6 +107,7 @@ package {pkg_name} is
             vhdl += f"""
 package body {pkg_name} is
 
+{self._register_word_index_function_implementation()}\
 {self._array_index_function_implementations()}\
 {self._register_map_body()}\
 {self._field_conversion_implementations()}\
@@ -145,6 +150,22 @@ end package body;
                 else:
                     # But not when defining a binary SLV.
                     value = f'"{constant.value_without_separator}"'
+            elif isinstance(constant, ArrayConstant):
+                # A constant array type, that is inferred as a ROM when indexed in a
+                # clocked process.
+                element_type = "real" if constant.element_type is float else "integer"
+                type_declaration = f"{self.name}_constant_{constant.name}_t"
+                vhdl += (
+                    f"  type {type_declaration} is array (0 to {constant.length - 1}) "
+                    f"of {element_type};\n"
+                )
+
+                elements = [str(element) for element in constant.value]
+                if constant.length == 1:
+                    # A one-element aggregate must use named association.
+                    value = f"(0 => {elements[0]})"
+                else:
+                    value = f"({', '.join(elements)})"
             else:
                 raise ValueError(f"Got unexpected constant type. {constant}")
 
@@ -174,6 +195,44 @@ end package body;
   -- The valid range of register indexes.
   subtype {self._register_range_type_name} is natural range 0 to {last_index};
 
+"""
+        return vhdl
+
+    def _register_word_index_function_signature(self) -> str:
+        """
+        Signature for the function that returns the index of the 64-bit word that an
+        address falls within.
+        """
+        return f"""\
+  function {self.name}_reg_word_index(
+    addr : u_unsigned
+  ) return natural"""
+
+    def _register_addresses(self) -> str:
+        """
+        Constants and functions for the byte addresses of the registers.
+        Registers are four bytes apart, regardless of the data width of the register bus.
+        """
+        last_index = self.register_list.register_objects[-1].index
+        # The address bits that are decoded.
+        # At least three, so that both registers in a 64-bit word can be addressed.
+        addr_width = max(3, (4 * (last_index + 1) - 1).bit_length())
+        last_word_index = last_index // 2
+
+        vhdl = f"""\
+  -- ---------------------------------------------------------------------------
+  -- Registers are placed four bytes apart, so the byte address of a register is four times
+  -- its index.
+  -- On a 64-bit register bus, each eight-byte aligned word holds two registers: the register at
+  -- the even index in bits 31:0, and the register after it in bits 63:32.
+  -- Number of address bits that are needed to address all registers.
+  constant {self.name}_reg_addr_width : positive := {addr_width};
+  -- The valid range of 64-bit word indexes.
+  subtype {self.name}_reg_word_range is natural range 0 to {last_word_index};
+  -- Index of the 64-bit word that a byte address, relative to the register map, falls within.
+  -- Address bits above '{self.name}_reg_addr_width' are ignored.
+{self._register_word_index_function_signature()};
+
 """
         return vhdl
 
@@ -188,6 +247,8 @@ end package body;
             vhdl += f"""\
   -- Number of times the '{register_array.name}' register array is repeated.
   constant {array_name}_array_length : natural := {register_array.length};
+  -- Number of register indexes between the start of two '{register_array.name}' repetitions.
+  constant {array_name}_array_stride : natural := {register_array.stride};
   -- Range for indexing '{register_array.name}' register array repetitions.
   subtype {array_name}_range is natural range 0 to {register_array.length - 1};
 
@@ -236,13 +297,27 @@ end package body;
         """
         map_name = f"{self.name}_reg_map"
 
+        if self.has_unused_register_indexes:
+            map_declaration = f"""\
+  -- To be used as the 'regs' generic of 'axi_lite_reg_file.vhd'.
+  -- Holds only the register indexes that hold a register. The indexes that pad register arrays
+  -- to their stride are not mapped, and get an error response from the register file.
+  -- Hence the position in this list is not the same as the register index.
+  -- The wrapper from 'VhdlAxiLiteWrapperGenerator' maps between the two.
+  constant {map_name} : reg_definition_vec_t(0 to {self.num_mapped_registers - 1});
+"""
+        else:
+            map_declaration = f"""\
+  -- To be used as the 'regs' generic of 'axi_lite_reg_file.vhd'.
+  constant {map_name} : reg_definition_vec_t({self._register_range_type_name});
+"""
+
         vhdl = f"""\
   -- Declare 'reg_map' and 'regs_init' constants here but define them in body (deferred constants).
   -- So that functions have been elaborated when they are called.
   -- Needed for ModelSim compilation to pass.
 
-  -- To be used as the 'regs' generic of 'axi_lite_reg_file.vhd'.
-  constant {map_name} : reg_definition_vec_t({self._register_range_type_name});
+{map_declaration}\
 
   -- To be used for the 'regs_up' and 'regs_down' ports of 'axi_lite_reg_file.vhd'.
   subtype {self.name}_regs_t is reg_vec_t({self._register_range_type_name});
@@ -415,6 +490,19 @@ range {field.width + field.base_index - 1} downto {field.base_index};
 
         raise TypeError(f'Got unexpected type for field: "{field}".')
 
+    def _register_word_index_function_implementation(self) -> str:
+        """
+        Implementation for the function that returns the index of the 64-bit word that an
+        address falls within.
+        """
+        return f"""\
+{self._register_word_index_function_signature()} is
+  begin
+    return to_integer(addr({self.name}_reg_addr_width - 1 downto 3));
+  end function;
+
+"""
+
     def _array_index_function_implementations(self) -> str:
         """
         Implementation for the functions that return a register index for the specified index in a
@@ -422,12 +510,11 @@ range {field.width + field.base_index - 1} downto {field.base_index};
         """
         vhdl = ""
         for register_array in self.iterate_register_arrays():
-            num_registers = len(register_array.registers)
             for register in register_array.registers:
                 vhdl += f"""\
 {self._array_register_index_function_signature(register, register_array)} is
   begin
-    return {register_array.base_index} + array_index * {num_registers} + {register.index};
+    return {register_array.base_index} + array_index * {register_array.stride} + {register.index};
   end function;
 
 """
@@ -447,32 +534,42 @@ range {field.width + field.base_index - 1} downto {field.base_index};
         for register_object in self.iterate_register_objects():
             if isinstance(register_object, Register):
                 idx = self.qualified_register_name(register_object)
-                opening = f"{vhdl_array_index} => "
 
                 register_definitions.append(
-                    f"{opening}(idx => {idx}, reg_type => {register_object.mode})"
+                    f"{vhdl_array_index} => (idx => {idx}, reg_type => {register_object.mode})"
+                )
+                default_values.append(
+                    f'{register_object.index} => "{register_object.default_value:032b}"'
                 )
-                default_values.append(f'{opening}"{register_object.default_value:032b}"')
 
                 vhdl_array_index = vhdl_array_index + 1
 
             else:
                 for array_index in range(register_object.length):
+                    start_index = register_object.get_start_index(array_index=array_index)
+
                     for register in register_object.registers:
                         regiser_name = self.qualified_register_name(register, register_object)
                         idx = f"{regiser_name}({array_index})"
-                        opening = f"{vhdl_array_index} => "
 
                         register_definitions.append(
-                            f"{opening}(idx => {idx}, reg_type => {register.mode})"
+                            f"{vhdl_array_index} => (idx => {idx}, reg_type => {register.mode})"
+                        )
+                        default_values.append(
+                            f'{start_index + register.index} => "{register.default_value:032b}"'
                         )
-                        default_values.append(f'{opening}"{register.default_value:032b}"')
 
                         vhdl_array_index = vhdl_array_index + 1
 
+        map_range = range_name
+        if self.has_unused_register_indexes:
+            map_range = f"0 to {vhdl_array_index - 1}"
+            # Register indexes that pad register arrays to, and align them with, their stride.
+            default_values.append("others => (others => '0')")
+
         array_element_separator = ",\n    "
         vhdl = f"""\
-  constant {map_name} : reg_definition_vec_t({range_name}) := (
+  constant {map_name} : reg_definition_vec_t({map_range}) := (
     {array_element_separator.join(register_definitions)}
   );
 
@@ -14,6 +14,7 @@ from typing import TYPE_CHECKING, Any, Optional
 # First party libraries
 from hdl_registers.field.bit_vector import BitVector
 from hdl_registers.field.register_field_type import Signed, Unsigned
+from hdl_registers.programming_sequence import SequenceOpcode
 
 # Local folder libraries
 from .vhdl_simulation_generator_common import VhdlSimulationGeneratorCommon
@@ -21,6 +22,7 @@ from .vhdl_simulation_generator_common import VhdlSimulationGeneratorCommon
 if TYPE_CHECKING:
     # First party libraries
     from hdl_registers.field.register_field import RegisterField
+    from hdl_registers.programming_sequence import ProgrammingSequence, SequenceEntry
     from hdl_registers.register import Register
     from hdl_registers.register_array import RegisterArray
 
@@ -40,6 +42,8 @@ class VhdlSimulationReadWritePackageGenerator(VhdlSimulationGeneratorCommon):
 
     * For each field in each writeable register, a procedure that writes a given field value.
 
+    * For each programming sequence, a procedure that runs the sequence.
+
     Uses VUnit Verification Component calls, via :ref:`reg_file.reg_operations_pkg`
     from hdl_modules.
 
@@ -47,7 +51,7 @@ class VhdlSimulationReadWritePackageGenerator(VhdlSimulationGeneratorCommon):
     :class:`.VhdlRegisterPackageGenerator` and :class:`.VhdlRecordPackageGenerator`.
     """
 
-    __version__ = "1.0.0"
+    __version__ = "1.1.0"
 
     SHORT_DESCRIPTION = "VHDL simulation read/write package"
 
@@ -232,6 +236,12 @@ end package body;
             vhdl += separator
             vhdl += "\n"
 
+        for programming_sequence, _ in self.iterate_programming_sequences():
+            vhdl += separator
+            vhdl += f"{self._programming_sequence_signature(programming_sequence)};\n"
+            vhdl += separator
+            vhdl += "\n"
+
         return vhdl
 
     def _register_read_write_signature(
@@ -324,6 +334,94 @@ end package body;
   )\
 """
 
+    def _programming_sequence_signature(self, programming_sequence: "ProgrammingSequence") -> str:
+        """
+        Get signature for a 'run_sequence' procedure.
+        """
+        description = self.comment_block(text=programming_sequence.description, indent=2)
+
+        return f"""\
+  -- Run the '{programming_sequence.name}' programming sequence.
+{description}\
+  procedure run_{self.name}_{programming_sequence.name}_sequence(
+    signal net : inout network_t;
+    base_address : in addr_t := (others => '0');
+    bus_handle : in bus_master_t := regs_bus_master;
+    timeout : in delay_length := delay_length'high
+  )\
+"""
+
+    def _programming_sequence_implementation(
+        self, programming_sequence: "ProgrammingSequence", entries: list["SequenceEntry"]
+    ) -> str:
+        """
+        Get implementation for a 'run_sequence' procedure.
+        The compiled entries are unrolled to one bus operation each.
+        """
+        vhdl = f"""\
+{self._programming_sequence_signature(programming_sequence=programming_sequence)} is
+    variable reg_value : reg_t := (others => '0');
+  begin
+"""
+
+        for entry_index, entry in enumerate(entries):
+            reg_index = entry.address // 4
+            mask = f'reg_t\'(x"{entry.mask:08X}")'
+            value = f'reg_t\'(x"{entry.value:08X}")'
+
+            vhdl += f"    -- {entry.comment}\n"
+
+            if entry.opcode == SequenceOpcode.DELAY:
+                vhdl += f"    wait for {entry.value} us;\n\n"
+                continue
+
+            if entry.opcode == SequenceOpcode.WAIT:
+                vhdl += f"""\
+    wait_until_read_equals(
+      net=>net,
+      bus_handle=>bus_handle,
+      addr=>std_ulogic_vector(base_address or to_unsigned({entry.address}, addr_t'length)),
+      value=>{value},
+      mask=>{mask},
+      timeout=>timeout,
+      msg=>(
+        "Timeout in programming sequence '{programming_sequence.name}' at step {entry_index} "
+        & "({entry.comment})."
+      )
+    );
+
+"""
+                continue
+
+            if entry.opcode == SequenceOpcode.MODIFY:
+                vhdl += f"""\
+    read_reg(
+      net => net,
+      reg_index => {reg_index},
+      value => reg_value,
+      base_address => base_address,
+      bus_handle => bus_handle
+    );
+"""
+                write_value = f"(reg_value and not {mask}) or {value}"
+            else:
+                write_value = value
+
+            vhdl += f"""\
+    write_reg(
+      net => net,
+      reg_index => {reg_index},
+      value => {write_value},
+      base_address => base_address,
+      bus_handle => bus_handle
+    );
+
+"""
+
+        vhdl += "  end procedure;\n"
+
+        return vhdl
+
     @staticmethod
     def _should_be_able_to_access_field_as_integer(field: "RegisterField") -> bool:
         """
@@ -466,6 +564,14 @@ end package body;
             vhdl += separator
             vhdl += "\n"
 
+        for programming_sequence, entries in self.iterate_programming_sequences():
+            vhdl += separator
+            vhdl += self._programming_sequence_implementation(
+                programming_sequence=programming_sequence, entries=entries
+            )
+            vhdl += separator
+            vhdl += "\n"
+
         return vhdl
 
     def _register_read_implementation(
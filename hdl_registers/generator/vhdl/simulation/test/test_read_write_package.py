@@ -121,3 +121,24 @@ def test_read_write_as_integer(tmp_path):
         assert not check_access_as_integer(direction=direction, name="full_my_bit")
         assert not check_access_as_integer(direction=direction, name="full_my_enumeration")
         assert not check_access_as_integer(direction=direction, name="full_my_integer")
+
+
+def test_programming_sequence(tmp_path):
+    register_list = RegisterList(name="caesar", source_definition_file=None)
+
+    register = register_list.append_register(name="config", mode="r_w", description="")
+    register.append_bit(name="a", description="", default_value="0")
+    register.append_bit(name="b", description="", default_value="0")
+    register_list.append_register(name="status", mode="r", description="")
+
+    programming_sequence = register_list.add_programming_sequence(name="initialize", description="")
+    programming_sequence.append_write(register="config", field="a", value=1)
+    programming_sequence.append_wait(register="status", value=1)
+    programming_sequence.append_delay(microseconds=10)
+
+    vhdl = read_file(VhdlSimulationReadWritePackageGenerator(register_list, tmp_path).create())
+
+    assert vhdl.count("procedure run_caesar_initialize_sequence(") == 2
+    assert 'value => (reg_value and not reg_t\'(x"00000001")) or reg_t\'(x"00000001"),' in vhdl
+    assert 'mask=>reg_t\'(x"FFFFFFFF"),' in vhdl
+    assert "wait for 10 us;" in vhdl
@@ -0,0 +1,153 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+"""
+Some limited unit tests.
+Note that the generated VHDL code is also simulated in a functional test.
+"""
+
+# Third party libraries
+import pytest
+
+# First party libraries
+from hdl_registers.generator.system_code_generator import RegisterListInstance
+from hdl_registers.generator.vhdl.axi_lite_decoder import VhdlAxiLiteDecoderGenerator
+from hdl_registers.register_list import RegisterList
+
+
+def get_register_list(name, num_registers):
+    register_list = RegisterList(name=name)
+    for register_index in range(num_registers):
+        register_list.append_register(name=f"reg_{register_index}", mode="r_w", description="")
+
+    return register_list
+
+
+def get_generator(tmp_path, *base_addresses_and_num_registers):
+    return VhdlAxiLiteDecoderGenerator(
+        name="soc",
+        register_lists=[
+            RegisterListInstance(
+                register_list=get_register_list(name=f"regs_{idx}", num_registers=num_registers),
+                base_address=base_address,
+            )
+            for idx, (base_address, num_registers) in enumerate(base_addresses_and_num_registers)
+        ],
+        output_folder=tmp_path,
+    )
+
+
+def test_decode_window_bits():
+    def get_window_bits(num_registers):
+        return VhdlAxiLiteDecoderGenerator.get_decode_window_bits(
+            RegisterListInstance(get_register_list(name="apa", num_registers=num_registers), 0)
+        )
+
+    assert get_window_bits(1) == 2
+    assert get_window_bits(2) == 3
+    assert get_window_bits(3) == 4
+    assert get_window_bits(4) == 4
+    assert get_window_bits(5) == 5
+
+
+def test_decode_bits_only_where_register_lists_differ(tmp_path):
+    generator = get_generator(
+        tmp_path,
+        (0x4000_0000, 20),
+        (0x4000_1000, 20),
+        (0x4000_2000, 20),
+        (0x4000_3000, 20),
+    )
+    assert generator.get_decode_bits() == {
+        "regs_0": [13, 12],
+        "regs_1": [13, 12],
+        "regs_2": [13, 12],
+        "regs_3": [13, 12],
+    }
+
+
+def test_decode_bits_are_reduced_to_what_is_needed(tmp_path):
+    # Bit 30 or 31 is enough to tell 'regs_2' apart from the others.
+    generator = get_generator(tmp_path, (0x4000_0000, 4), (0x4000_1000, 4), (0x8000_0000, 4))
+    assert generator.get_decode_bits() == {
+        "regs_0": [31, 12],
+        "regs_1": [31, 12],
+        "regs_2": [31, 12],
+    }
+
+
+def test_decode_bits_below_decode_window_are_not_compared(tmp_path):
+    # 'regs_0' has a decode window of 0x4000 bytes, so bit 12 and 13 are part of its registers
+    # addresses.
+    generator = get_generator(tmp_path, (0x0000, 0x1000), (0x4000, 1), (0x5000, 1))
+    assert generator.get_decode_bits() == {"regs_0": [14], "regs_1": [14, 12], "regs_2": [14, 12]}
+
+    vhdl = generator.get_code()
+    assert (
+        """\
+    -- 'regs_0' at 0x00000000, decode window 0x4000 bytes.
+    if addr(14) = '0' then
+      return regs_0_index;
+    end if;
+
+    -- 'regs_1' at 0x00004000, decode window 0x4 bytes.
+    if addr(14) = '1' and addr(12) = '0' then
+      return regs_1_index;
+    end if;
+"""
+        in vhdl
+    )
+
+
+def test_single_register_list_is_always_selected(tmp_path):
+    generator = get_generator(tmp_path, (0x4000_0000, 4))
+    assert generator.get_decode_bits() == {"regs_0": []}
+
+    vhdl = generator.get_code()
+    assert "    return regs_0_index;\n\n    return decode_error_index;\n" in vhdl
+
+
+def test_register_lists_without_registers_are_not_decoded(tmp_path):
+    register_list = RegisterList(name="apa")
+    register_list.add_constant(name="hest", value=True, description="")
+
+    generator = VhdlAxiLiteDecoderGenerator(
+        name="soc",
+        register_lists=[
+            RegisterListInstance(register_list=register_list, base_address=0),
+            RegisterListInstance(get_register_list(name="zebra", num_registers=1), 0x1000),
+        ],
+        output_folder=tmp_path,
+    )
+    vhdl = generator.get_code()
+
+    assert "apa_" not in vhdl
+    assert "    zebra_axi_lite_s2m : in axi_lite_s2m_t := axi_lite_s2m_init\n  );" in vhdl
+
+    generator = VhdlAxiLiteDecoderGenerator(
+        name="soc",
+        register_lists=[RegisterListInstance(register_list=register_list, base_address=0)],
+        output_folder=tmp_path,
+    )
+    with pytest.raises(ValueError) as exception_info:
+        generator.create()
+    assert str(exception_info.value) == (
+        'Error in register list "soc": There are no register lists with registers in the system.'
+    )
+
+
+def test_base_address_not_aligned_to_decode_window_should_raise_exception(tmp_path):
+    generator = get_generator(tmp_path, (0x0, 4), (0x1008, 4))
+
+    with pytest.raises(ValueError) as exception_info:
+        generator.create()
+    assert str(exception_info.value) == (
+        'Error in register list "soc": Base address of register list "regs_1" (0x1008) is not '
+        "aligned to its decode window size (0x10)."
+    )
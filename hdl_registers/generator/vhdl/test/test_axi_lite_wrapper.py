@@ -37,3 +37,146 @@ def test_re_generating_file_without_registers_should_delete_old_file(tmp_path):
 
     register_list.register_objects = []
     assert not (VhdlAxiLiteWrapperGenerator(register_list, tmp_path).create()).exists()
+
+
+def test_each_register_is_converted_in_its_own_statement(tmp_path):
+    register_list = RegisterList(name="test", source_definition_file=None)
+    register_list.append_register(name="apa", mode="r", description="")
+    register_list.append_register(name="hest", mode="r_w", description="")
+
+    register_array = register_list.append_register_array(name="zebra", length=4, description="")
+    register_array.append_register(name="bar", mode="r", description="")
+    register_array.append_register(name="baz", mode="w", description="")
+
+    vhdl = VhdlAxiLiteWrapperGenerator(register_list, tmp_path).get_code()
+
+    # Only the read and write processes of the 64-bit register file.
+    assert vhdl.count(": process\n") == 2
+    assert "  regs_up_slv(test_apa) <= regs_up.apa;\n" in vhdl
+    assert "  regs_down.hest <= regs_down_slv(test_hest);\n" in vhdl
+    assert (
+        """\
+  assign_regs_up_zebra : for array_index in test_zebra_range generate
+    regs_up_slv(test_zebra_bar(array_index)) <= regs_up.zebra(array_index).bar;
+  end generate;
+"""
+        in vhdl
+    )
+    assert (
+        """\
+  assign_regs_down_zebra : for array_index in test_zebra_range generate
+    regs_down.zebra(array_index).baz <= regs_down_slv(test_zebra_baz(array_index));
+  end generate;
+"""
+        in vhdl
+    )
+
+
+def test_double_buffered_registers_are_assigned_in_commit_process(tmp_path):
+    register_list = RegisterList(name="test", source_definition_file=None)
+    register_list.append_register(name="apa", mode="r_w", description="")
+    register_list.append_register(name="hest", mode="r_w", description="")
+
+    register_array = register_list.append_register_array(name="zebra", length=4, description="")
+    register_array.append_register(name="baz", mode="w", description="")
+
+    register_list.append_register(name="commit", mode="wpulse", description="").commits = [
+        "hest",
+        "zebra",
+    ]
+
+    vhdl = VhdlAxiLiteWrapperGenerator(register_list, tmp_path).get_code()
+
+    assert "  regs_down.apa <= regs_down_slv(test_apa);\n" in vhdl
+    assert "  regs_down.commit <= regs_down_slv(test_commit);\n" in vhdl
+    assert "assign_regs_down_zebra" not in vhdl
+    assert (
+        """\
+  commit_commit : process
+  begin
+    wait until rising_edge(clk);
+
+    if reg_was_written_slv(test_commit) = '1' then
+      regs_down.hest <= regs_down_slv(test_hest);
+      for array_index in test_zebra_range loop
+        regs_down.zebra(array_index).baz <= regs_down_slv(test_zebra_baz(array_index));
+      end loop;
+    end if;
+  end process;
+"""
+        in vhdl
+    )
+    assert vhdl.count("regs_down.hest <=") == 1
+
+
+def test_power_of_two_stride_padding_is_not_in_register_file(tmp_path):
+    register_list = RegisterList(name="test", source_definition_file=None)
+    register_list.append_register(name="apa", mode="r_w", description="")
+
+    register_array = register_list.append_register_array(
+        name="zebra", length=2, description="", power_of_two_stride=True
+    )
+    register_array.append_register(name="bar", mode="r", description="")
+    register_array.append_register(name="baz", mode="w", description="")
+    register_array.append_register(name="foo", mode="w", description="")
+
+    vhdl = VhdlAxiLiteWrapperGenerator(register_list, tmp_path).get_code()
+
+    assert "        default_values => reg_file_default_values\n" in vhdl
+    assert "        regs_up => reg_file_regs_up,\n" in vhdl
+    assert "        reg_was_written => reg_file_reg_was_written\n" in vhdl
+    assert (
+        """\
+    assign_reg_file : for list_index in reg_file_range generate
+      constant reg_index : test_reg_range := test_reg_map(list_index).idx;
+    begin
+      reg_file_regs_up(list_index) <= regs_up_slv(reg_index);
+      regs_down_slv(reg_index) <= reg_file_regs_down(list_index);
+      reg_was_read_slv(reg_index) <= reg_file_reg_was_read(list_index);
+      reg_was_written_slv(reg_index) <= reg_file_reg_was_written(list_index);
+    end generate;
+"""
+        in vhdl
+    )
+    # Conversion to and from the record is the same as without padding.
+    assert "regs_down.zebra(array_index).baz <= regs_down_slv(test_zebra_baz(array_index));" in vhdl
+
+
+def test_register_file_ports_are_connected_directly_without_padding(tmp_path):
+    register_list = RegisterList(name="test", source_definition_file=None)
+    register_list.append_register(name="apa", mode="r_w", description="")
+
+    vhdl = VhdlAxiLiteWrapperGenerator(register_list, tmp_path).get_code()
+
+    assert "        default_values => test_regs_init\n" in vhdl
+    assert "        regs_up => regs_up_slv,\n" in vhdl
+    assert "reg_file_range" not in vhdl
+
+
+def test_data_width_generic_selects_register_file(tmp_path):
+    register_list = RegisterList(name="test", source_definition_file=None)
+    register_list.append_register(name="apa", mode="r_w", description="")
+
+    vhdl = VhdlAxiLiteWrapperGenerator(register_list, tmp_path).get_code()
+
+    assert "    data_width : positive := 32\n" in vhdl
+    assert "  data_width_32_gen : if data_width = 32 generate\n" in vhdl
+    assert "    axi_lite_reg_file_inst : entity reg_file.axi_lite_reg_file\n" in vhdl
+    assert "  data_width_64_gen : if data_width = 64 generate\n" in vhdl
+    assert vhdl.count("end generate;\n") == 2
+
+
+def test_data_width_64_register_file_accesses_both_registers_of_word(tmp_path):
+    register_list = RegisterList(name="test", source_definition_file=None)
+    register_list.append_register(name="apa", mode="r_w", description="")
+    register_list.append_register(name="hest", mode="r", description="")
+
+    vhdl = VhdlAxiLiteWrapperGenerator(register_list, tmp_path).get_code()
+
+    assert "        word_index := test_reg_word_index(axi_lite_m2s.read.ar.addr);\n" in vhdl
+    assert "        word_index := test_reg_word_index(axi_lite_m2s.write.aw.addr);\n" in vhdl
+    assert "          for lane in 0 to 1 loop\n" in vhdl
+    assert (
+        "    subtype reg_index_t is natural range 0 to 2 * test_reg_word_range'high + 1;\n" in vhdl
+    )
+    assert "regs_down_slv(pulse_index) <= test_regs_init(pulse_index);" in vhdl
@@ -37,3 +37,21 @@ def test_re_generating_package_without_registers_should_delete_old_file(tmp_path
 
     register_list.register_objects = []
     assert not (VhdlRecordPackageGenerator(register_list, tmp_path).create()).exists()
+
+
+def test_array_conversion_functions_do_not_grow_with_array_length(tmp_path):
+    def get_code(length):
+        register_list = RegisterList(name="test", source_definition_file=None)
+        register_array = register_list.append_register_array(
+            name="apa", length=length, description=""
+        )
+        register_array.append_register(name="hest", mode="r", description="")
+        register_array.append_register(name="zebra", mode="r_w", description="")
+
+        return VhdlRecordPackageGenerator(register_list, tmp_path).get_code()
+
+    short_code = get_code(length=2)
+    long_code = get_code(length=1000)
+
+    assert len(long_code.split("\n")) == len(short_code.split("\n"))
+    assert "for array_index in test_apa_range loop" in long_code
@@ -0,0 +1,64 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+"""
+Some limited unit tests.
+The ROM content is tested in 'test_register_map_rom.py' in the generator folder, and decoded in
+'test_compiled_c_code.py'.
+"""
+
+# First party libraries
+from hdl_registers.generator.register_map_rom import RegisterMapRom
+from hdl_registers.generator.vhdl.register_map_rom import VhdlRegisterMapRomGenerator
+from hdl_registers.register_list import RegisterList
+
+
+def get_register_list(num_registers):
+    register_list = RegisterList(name="test", source_definition_file=None)
+    for register_index in range(num_registers):
+        register_list.append_register(name=f"reg_{register_index}", mode="r_w", description="")
+
+    return register_list
+
+
+def test_rom_content(tmp_path):
+    register_list = get_register_list(num_registers=2)
+    words = RegisterMapRom(register_list=register_list).get_words()
+
+    vhdl = VhdlRegisterMapRomGenerator(register_list, tmp_path).get_code()
+
+    assert "entity test_register_map_rom is" in vhdl
+    assert (
+        f"""\
+  constant rom : rom_t := (
+    x"4D524448", x"00000001", x"{len(words):08X}", x"{words[3]:08X}",
+"""
+        in vhdl
+    )
+    assert f"x\"{words[-1]:08X}\",\n    others => (others => '0')\n  );\n" in vhdl
+
+
+def test_rom_is_padded_to_power_of_two(tmp_path):
+    def get_word_address_width(num_registers):
+        register_list = get_register_list(num_registers=num_registers)
+        num_words = len(RegisterMapRom(register_list=register_list).get_words())
+        vhdl = VhdlRegisterMapRomGenerator(register_list, tmp_path).get_code()
+
+        for line in vhdl.split("\n"):
+            if line.startswith("  constant word_address_width : positive := "):
+                word_address_width = int(line.split(":= ")[1].rstrip(";"))
+                assert 2 ** (word_address_width - 1) < num_words <= 2**word_address_width
+
+                return word_address_width
+
+        raise AssertionError("Could not find word address width")
+
+    assert get_word_address_width(num_registers=0) == 5
+    assert get_word_address_width(num_registers=10) == 7
+    assert get_word_address_width(num_registers=100) == 10
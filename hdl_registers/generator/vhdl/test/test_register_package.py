@@ -168,3 +168,63 @@ def test_vhdl_typedef(tmp_path):
     assert "subtype test_number_sfixed1_t is sfixed(5 downto 0);" in vhdl, vhdl
 
     assert "subtype test_number_integer0_t is integer range 1 to 3;" in vhdl, vhdl
+
+
+def test_vhdl_package_register_map_does_not_hold_power_of_two_stride_padding(tmp_path):
+    register_list = RegisterList(name="test", source_definition_file=None)
+    register_list.append_register(name="apa", mode="r_w", description="")
+
+    register_array = register_list.append_register_array(
+        name="zebra", length=2, description="", power_of_two_stride=True
+    )
+    register_array.append_register(name="bar", mode="r", description="")
+    register_array.append_register(name="baz", mode="w", description="")
+    register_array.append_register(name="foo", mode="w", description="")
+
+    vhdl = read_file(VhdlRegisterPackageGenerator(register_list, tmp_path).create())
+
+    expected = """
+  constant test_reg_map : reg_definition_vec_t(0 to 6) := (
+    0 => (idx => test_apa, reg_type => r_w),
+    1 => (idx => test_zebra_bar(0), reg_type => r),
+    2 => (idx => test_zebra_baz(0), reg_type => w),
+    3 => (idx => test_zebra_foo(0), reg_type => w),
+    4 => (idx => test_zebra_bar(1), reg_type => r),
+    5 => (idx => test_zebra_baz(1), reg_type => w),
+    6 => (idx => test_zebra_foo(1), reg_type => w)
+  );
+"""
+    assert expected in vhdl, vhdl
+
+    # Default values are indexed by register index, which is not contiguous.
+    assert '    4 => "00000000000000000000000000000000",\n' in vhdl, vhdl
+    assert '    10 => "00000000000000000000000000000000",\n' in vhdl, vhdl
+    assert "    others => (others => '0')\n" in vhdl, vhdl
+
+
+def test_vhdl_package_register_addresses(tmp_path):
+    register_list = RegisterList(name="test", source_definition_file=None)
+    register_list.append_register(name="apa", mode="r", description="")
+    vhdl = read_file(VhdlRegisterPackageGenerator(register_list, tmp_path).create())
+
+    # At least three address bits, so that both registers in a 64-bit word can be addressed.
+    assert "  constant test_reg_addr_width : positive := 3;\n" in vhdl, vhdl
+    assert "  subtype test_reg_word_range is natural range 0 to 0;\n" in vhdl, vhdl
+
+    # Indexes 0 to 4, i.e. bytes 0 to 19, in words 0 to 2.
+    for index in range(4):
+        register_list.append_register(name=f"hest{index}", mode="r", description="")
+    vhdl = read_file(VhdlRegisterPackageGenerator(register_list, tmp_path).create())
+
+    assert "  constant test_reg_addr_width : positive := 5;\n" in vhdl, vhdl
+    assert "  subtype test_reg_word_range is natural range 0 to 2;\n" in vhdl, vhdl
+
+    expected = """
+  function test_reg_word_index(
+    addr : u_unsigned
+  ) return natural is
+  begin
+    return to_integer(addr(test_reg_addr_width - 1 downto 3));
+  end function;
+"""
+    assert expected in vhdl, vhdl
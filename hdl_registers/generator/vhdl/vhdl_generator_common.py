@@ -180,6 +180,25 @@ class VhdlGeneratorCommon(RegisterCodeGenerator):
 
         return f"    constant reg_index : {self.name}_reg_range := {reg_index};\n"
 
+    @property
+    def num_mapped_registers(self) -> int:
+        """
+        The number of register indexes that hold a register.
+        """
+        return sum(
+            1 if register_array is None else register_array.length
+            for _, register_array in self.iterate_registers()
+        )
+
+    @property
+    def has_unused_register_indexes(self) -> bool:
+        """
+        True if any register indexes within the register range do not hold a register.
+        I.e. the indexes that pad register arrays with a power-of-two stride.
+        These are left out of the register map.
+        """
+        return self.num_mapped_registers != self.register_list.register_objects[-1].index + 1
+
     def has_any_bus_accessible_register(self, direction: BusAccessDirection) -> bool:
         """
         Return True if the register list contains any register, plain or in array, that is
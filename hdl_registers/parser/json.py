@@ -25,7 +25,10 @@ if TYPE_CHECKING:
 
 
 def from_json(
-    name: str, json_file: Path, default_registers: Optional[list["Register"]] = None
+    name: str,
+    json_file: Path,
+    default_registers: Optional[list["Register"]] = None,
+    lazy: bool = False,
 ) -> "RegisterList":
     """
     Parse a JSON file with register data.
@@ -34,6 +37,8 @@ def from_json(
         name: The name of the register list.
         json_file: The JSON file path.
         default_registers: List of default registers.
+        lazy: Create register objects only when they are accessed.
+            See :meth:`.RegisterParser.parse` for details.
 
     Return:
         The resulting register list.
@@ -43,7 +48,7 @@ def from_json(
     )
     json_data = _load_json_file(file_path=json_file)
 
-    return parser.parse(register_data=json_data)
+    return parser.parse(register_data=json_data, lazy=lazy)
 
 
 def _load_json_file(file_path: Path) -> dict[str, Any]:
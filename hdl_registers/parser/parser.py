@@ -9,16 +9,19 @@
 
 # Standard libraries
 import copy
+import re
 from pathlib import Path
 from typing import TYPE_CHECKING, Any, Optional
 
 # First party libraries
 from hdl_registers.constant.bit_vector_constant import UnsignedVector
+from hdl_registers.register import Register
+from hdl_registers.register_array import RegisterArray
 from hdl_registers.register_list import RegisterList
 
 if TYPE_CHECKING:
     # First party libraries
-    from hdl_registers.register import Register
+    from hdl_registers.register_list import RegisterObjectT
 
 
 class RegisterParser:
@@ -29,6 +32,8 @@ class RegisterParser:
         # Attributes of the register.
         "description",
         "mode",
+        "commits",
+        "static",
         # Fields.
         "bit",
         "bit_vector",
@@ -36,9 +41,30 @@ class RegisterParser:
         "integer",
     }
 
-    recognized_register_array_items = {"array_length", "description", "register"}
+    recognized_register_array_items = {
+        "array_length",
+        "description",
+        "power_of_two_stride",
+        "register",
+    }
     required_register_array_items = ["array_length", "register"]
 
+    recognized_register_pair_items = {"description", "low", "high"}
+    required_register_pair_items = ["low", "high"]
+
+    recognized_programming_sequence_items = {"description", "step"}
+    required_programming_sequence_items = ["step"]
+
+    # Each step shall have exactly one of the action items.
+    sequence_step_actions = ["write", "wait", "delay_us"]
+    recognized_sequence_step_items = {"write", "wait", "delay_us", "value"}
+
+    # Register or field that a programming sequence step accesses.
+    # E.g. "config", "config.enable" or "channels[1].config.enable".
+    _sequence_target_re = re.compile(
+        r"^(?:(?P<array>\w+)\[(?P<index>\d+)\]\.)?(?P<register>\w+)(?:\.(?P<field>\w+))?$"
+    )
+
     recognized_bit_items = {"description", "default_value"}
     required_bit_items: list[str] = []
 
@@ -65,174 +91,556 @@ class RegisterParser:
                 for traceability.
             default_registers: List of default registers.
         """
-        self._register_list = RegisterList(name=name, source_definition_file=source_definition_file)
         self._source_definition_file = source_definition_file
 
-        self._default_register_names = []
+        # The default register objects are frozen, and shared with other register lists.
+        # A default register is copied only when it is updated by the data.
+        # See 'copy_default_register'.
+        self._default_registers: list["Register"] = []
         if default_registers:
-            # Perform deep copy of the mutable register objects.
-            # Ignore a mypy error that seems buggy.
-            # We are assigning list[Register] to list[Register | RegisterArray]
-            # which should be absolutely fine, but mypy warns.
-            self._register_list.register_objects = copy.deepcopy(
-                default_registers  # type: ignore[arg-type]
+            self._register_list = RegisterList.from_default_registers(
+                name=name,
+                source_definition_file=source_definition_file,
+                default_registers=default_registers,
+                share_registers=True,
             )
-            for register in default_registers:
-                self._default_register_names.append(register.name)
-
-    def parse(self, register_data: dict[str, Any]) -> RegisterList:
+            self._default_registers = list(
+                self._register_list.register_objects  # type: ignore[arg-type]
+            )
+        else:
+            self._register_list = RegisterList(
+                name=name, source_definition_file=source_definition_file
+            )
+        self._default_register_by_name = {
+            register.name: register for register in self._default_registers
+        }
+
+        # Recognized and required items for each field type, keyed by the name used in the data.
+        self._field_items = {
+            "bit": (self.recognized_bit_items, self.required_bit_items),
+            "bit_vector": (self.recognized_bit_vector_items, self.required_bit_vector_items),
+            "enumeration": (self.recognized_enumeration_items, self.required_enumeration_items),
+            "integer": (self.recognized_integer_items, self.required_integer_items),
+        }
+
+        # Raw data of the registers and register arrays that shall be parsed.
+        self._register_data: dict[str, Any] = {}
+        self._register_array_data: dict[str, Any] = {}
+
+        # Register list index of each register and register array.
+        # Calculated from the raw data before any objects are created, which is what makes it
+        # possible to create each object separately.
+        self._register_indexes: dict[str, int] = {}
+        self._register_array_base_indexes: dict[str, int] = {}
+
+        # Objects that have been created from the raw data.
+        self._registers: dict[str, "Register"] = {}
+        self._register_arrays: dict[str, RegisterArray] = {}
+
+        # Set in lazy mode, where each register and register array is validated when it is created
+        # instead of all at once before parsing.
+        self._validate_on_access = False
+
+    def parse(self, register_data: dict[str, Any], lazy: bool = False) -> RegisterList:
         """
         Parse the register data.
 
         Arguments:
             register_data: Register data as a dictionary.
+            lazy: If ``True``, the register and register array objects will not be created
+                until they are accessed via the resulting register list.
+                :meth:`.RegisterList.get_register`, :meth:`.RegisterList.get_register_array` and
+                :meth:`.RegisterList.get_register_index` will create only the requested object,
+                while e.g. accessing :attr:`.RegisterList.register_objects` will create all of
+                them.
+                The resulting objects are identical to the ones from a non-lazy parse.
+
+                This is much faster when only a few registers of a large register list are
+                needed.
+                Note however that errors in the register data will not be reported until the
+                erroneous register is accessed.
 
         Return:
             The resulting register list.
+
+        If there are errors in the register data, one exception will be raised that lists all of
+        them, not only the first one.
         """
-        if "constant" in register_data:
-            for name, items in register_data["constant"].items():
-                self._parse_constant(name=name, items=items)
+        constant_data = register_data.get("constant", {})
+        register_pair_data = register_data.get("register_pair", {})
+        programming_sequence_data = register_data.get("programming_sequence", {})
+        self._register_data = register_data.get("register", {})
+        self._register_array_data = register_data.get("register_array", {})
+
+        if lazy:
+            # Only what is needed right away is validated here.
+            # The rest is validated for each register and register array when it is created.
+            errors = []
+            for name, items in constant_data.items():
+                errors += self._validate_constant(name=name, items=items)
+
+            for name, items in register_pair_data.items():
+                errors += self._validate_register_pair(name=name, items=items)
+
+            for name, items in programming_sequence_data.items():
+                errors += self._validate_programming_sequence(name=name, items=items)
+
+            for name, items in self._register_array_data.items():
+                errors += self._validate_register_array_required_items(name=name, items=items)
+
+            self._raise_if_errors(errors=errors)
+            self._validate_on_access = True
+        else:
+            self._raise_if_errors(
+                errors=self._validate(
+                    constant_data=constant_data,
+                    register_pair_data=register_pair_data,
+                    programming_sequence_data=programming_sequence_data,
+                )
+            )
+
+        for name, items in constant_data.items():
+            self._parse_constant(name=name, items=items)
+
+        for name, items in register_pair_data.items():
+            self._register_list.add_register_pair(
+                name=name,
+                low=items["low"],
+                high=items["high"],
+                description=items.get("description", ""),
+            )
 
-        if "register" in register_data:
-            for name, items in register_data["register"].items():
-                self._parse_plain_register(name, items)
+        for name, items in programming_sequence_data.items():
+            self._parse_programming_sequence(name=name, items=items)
 
-        if "register_array" in register_data:
-            for name, items in register_data["register_array"].items():
-                self._parse_register_array(name, items)
+        self._calculate_indexes()
+
+        if lazy:
+            self._register_list.set_lazy_parser(lazy_parser=self)
+        else:
+            self._register_list.register_objects = self.parse_register_objects()
 
         return self._register_list
 
-    def _parse_constant(self, name: str, items: dict[str, Any]) -> None:
+    def parse_register(self, name: str) -> Optional["Register"]:
+        """
+        Get the plain register with the given name, creating it from the raw data if that has not
+        already been done.
+        Used by :class:`.RegisterList` in lazy mode.
+
+        Return:
+            The register. ``None`` if there is no plain register with this name.
+        """
+        if name in self._registers:
+            return self._registers[name]
+
+        if name in self._register_data:
+            items = self._register_data[name]
+            if self._validate_on_access:
+                self._raise_if_errors(errors=self._validate_plain_register(name=name, items=items))
+
+            register = self._parse_plain_register(name=name, items=items)
+        elif name in self._default_register_by_name:
+            register = self._default_register_by_name[name]
+        else:
+            return None
+
+        self._registers[name] = register
+        return register
+
+    def copy_default_register(self, name: str) -> "Register":
+        """
+        Replace a shared default register with a copy that belongs to this register list only.
+        Used when the register is updated by the data, and by :class:`.RegisterList` in lazy mode.
+
+        Return:
+            The copied register.
+        """
+        # A deep copy of a frozen register is a regular register.
+        register = copy.deepcopy(self._default_register_by_name[name])
+
+        # Default registers are placed first, so the index is also the list index.
+        self._default_registers[register.index] = register
+        self._default_register_by_name[name] = register
+        if name in self._registers:
+            self._registers[name] = register
+
+        return register
+
+    def parse_register_array(self, name: str) -> Optional[RegisterArray]:
+        """
+        Get the register array with the given name, creating it from the raw data if that has not
+        already been done.
+        Used by :class:`.RegisterList` in lazy mode.
+
+        Return:
+            The register array. ``None`` if there is no register array with this name.
+        """
+        if name in self._register_arrays:
+            return self._register_arrays[name]
+
+        if name not in self._register_array_data:
+            return None
+
+        items = self._register_array_data[name]
+        if self._validate_on_access:
+            self._raise_if_errors(errors=self._validate_register_array(name=name, items=items))
+
+        register_array = self._parse_register_array(name=name, items=items)
+
+        self._register_arrays[name] = register_array
+        return register_array
+
+    def parse_register_objects(self) -> list["RegisterObjectT"]:
+        """
+        Get all register and register array objects, in index order.
+        Will create the ones that have not already been created from the raw data.
+        """
+        # Default registers that are overloaded in the data are updated in place.
+        for name in self._register_data:
+            self.parse_register(name=name)
+
+        register_objects: list["RegisterObjectT"] = list(self._default_registers)
+
+        for name in self._register_data:
+            if name not in self._default_register_by_name:
+                register_objects.append(self._registers[name])
+
+        for name in self._register_array_data:
+            # Will never be 'None' since the name is taken from the data.
+            register_objects.append(self.parse_register_array(name=name))  # type: ignore[arg-type]
+
+        return register_objects
+
+    def _calculate_indexes(self) -> None:
+        """
+        Calculate the index of each register and register array in the register list.
+        Note that plain registers are placed after the default registers and before
+        register arrays.
+        """
+        index = len(self._default_registers)
+
+        for name in self._register_data:
+            if name not in self._default_register_by_name:
+                self._register_indexes[name] = index
+                index += 1
+
+        for name, items in self._register_array_data.items():
+            self._register_array_base_indexes[name] = index
+
+            power_of_two_stride = items.get("power_of_two_stride", False)
+            stride = RegisterArray.calculate_stride(
+                num_registers=len(items["register"]), power_of_two_stride=power_of_two_stride
+            )
+            if power_of_two_stride and stride > 1:
+                # The array object aligns its base index to the stride.
+                index = -(-index // stride) * stride
+
+            index += items["array_length"] * stride
+
+    @staticmethod
+    def _raise_if_errors(errors: list[str]) -> None:
+        """
+        Raise one exception that lists all the errors, if there are any.
+        """
+        if errors:
+            raise ValueError("\n".join(errors))
+
+    def _validate(
+        self,
+        constant_data: dict[str, Any],
+        register_pair_data: dict[str, Any],
+        programming_sequence_data: dict[str, Any],
+    ) -> list[str]:
+        """
+        Validate all the register data in one pass, before any objects are created.
+
+        Return:
+            A message for each error that was found.
+            Empty list if the data is valid.
+        """
+        errors = []
+
+        for name, items in constant_data.items():
+            errors += self._validate_constant(name=name, items=items)
+
+        for name, items in self._register_data.items():
+            errors += self._validate_plain_register(name=name, items=items)
+
+        for name, items in self._register_array_data.items():
+            errors += self._validate_register_array(name=name, items=items)
+
+        for name, items in register_pair_data.items():
+            errors += self._validate_register_pair(name=name, items=items)
+
+        for name, items in programming_sequence_data.items():
+            errors += self._validate_programming_sequence(name=name, items=items)
+
+        return errors
+
+    def _validate_constant(self, name: str, items: dict[str, Any]) -> list[str]:
+        errors = []
+
         for item_name in self.required_constant_items:
             if item_name not in items:
-                message = (
+                errors.append(
                     f'Constant "{name}" in {self._source_definition_file} does not have '
                     f'the required "{item_name}" property.'
                 )
-                raise ValueError(message)
 
-        for item_name in items.keys():
+        for item_name in items:
             if item_name not in self.recognized_constant_items:
-                message = (
+                errors.append(
                     f'Error while parsing constant "{name}" in {self._source_definition_file}: '
                     f'Unknown key "{item_name}".'
                 )
-                raise ValueError(message)
 
-        value = items["value"]
-        description = items.get("description", "")
         data_type_str = items.get("data_type")
-
-        if data_type_str is not None:
-            if not isinstance(value, str):
-                raise ValueError(
+        if data_type_str is not None and "value" in items:
+            if not isinstance(items["value"], str):
+                errors.append(
                     f'Error while parsing constant "{name}" in '
                     f"{self._source_definition_file}: "
                     'May not set "data_type" for non-string constant.'
                 )
-
-            if data_type_str == "unsigned":
-                value = UnsignedVector(value)
-            else:
-                raise ValueError(
+            elif data_type_str != "unsigned":
+                errors.append(
                     f'Error while parsing constant "{name}" in '
                     f"{self._source_definition_file}: "
                     f'Invalid data type "{data_type_str}".'
                 )
 
-        self._register_list.add_constant(name=name, value=value, description=description)
+        return errors
+
+    def _validate_register_pair(self, name: str, items: dict[str, Any]) -> list[str]:
+        errors = []
+
+        for item_name in self.required_register_pair_items:
+            if item_name not in items:
+                errors.append(
+                    f'Register pair "{name}" in {self._source_definition_file} does not have '
+                    f'the required "{item_name}" property.'
+                )
+
+        for item_name in items:
+            if item_name not in self.recognized_register_pair_items:
+                errors.append(
+                    f'Error while parsing register pair "{name}" in '
+                    f'{self._source_definition_file}: Unknown key "{item_name}".'
+                )
+
+        return errors
+
+    def _validate_programming_sequence(self, name: str, items: dict[str, Any]) -> list[str]:
+        errors = []
+        error_prefix = (
+            f'Error while parsing programming sequence "{name}" in {self._source_definition_file}:'
+        )
+
+        for item_name in self.required_programming_sequence_items:
+            if item_name not in items:
+                errors.append(
+                    f'Programming sequence "{name}" in {self._source_definition_file} does not '
+                    f'have the required "{item_name}" property.'
+                )
+
+        for item_name in items:
+            if item_name not in self.recognized_programming_sequence_items:
+                errors.append(f'{error_prefix} Unknown key "{item_name}".')
+
+        for step_index, step in enumerate(items.get("step", [])):
+            step_prefix = f"{error_prefix} Step {step_index}"
+
+            if not isinstance(step, dict):
+                errors.append(f"{step_prefix} is not a table.")
+                continue
+
+            for item_name in step:
+                if item_name not in self.recognized_sequence_step_items:
+                    errors.append(f'{step_prefix} has unknown key "{item_name}".')
 
-    def _parse_plain_register(self, name: str, items: dict[str, Any]) -> None:
-        for item_name in items.keys():
+            actions = [action for action in self.sequence_step_actions if action in step]
+            if len(actions) != 1:
+                errors.append(
+                    f'{step_prefix} must have exactly one of "write", "wait" or "delay_us".'
+                )
+                continue
+
+            if actions[0] == "delay_us":
+                continue
+
+            if "value" not in step:
+                errors.append(f'{step_prefix} does not have the required "value" property.')
+
+            if not self._sequence_target_re.match(str(step[actions[0]])):
+                errors.append(
+                    f'{step_prefix} has invalid register "{step[actions[0]]}". '
+                    'Expected e.g. "register", "register.field" or "array[0].register.field".'
+                )
+
+        return errors
+
+    def _validate_plain_register(self, name: str, items: dict[str, Any]) -> list[str]:
+        errors = []
+
+        for item_name in items:
             if item_name not in self.recognized_register_items:
-                message = (
+                errors.append(
                     f'Error while parsing register "{name}" in {self._source_definition_file}: '
                     f'Unknown key "{item_name}".'
                 )
-                raise ValueError(message)
 
-        description = items.get("description", "")
+        if not isinstance(items.get("static", False), bool):
+            errors.append(
+                f'Error while parsing register "{name}" in {self._source_definition_file}: '
+                'Property "static" must be a boolean.'
+            )
 
-        if name in self._default_register_names:
+        if name in self._default_register_by_name:
             # Default registers can be "updated" in the sense that the user can use a custom
             # description and add whatever fields they want in the current module.
             # They may not, however, change the mode.
             if "mode" in items:
-                message = (
+                errors.append(
                     f'Overloading register "{name}" in {self._source_definition_file}, '
                     'one can not change "mode" from default'
                 )
-                raise ValueError(message)
-
-            register = self._register_list.get_register(name)
-            register.description = description
 
-        else:
+        elif "mode" not in items:
             # If it is a new register however the mode has to be specified.
-            if "mode" not in items:
-                raise ValueError(
-                    f'Register "{name}" in {self._source_definition_file} does not have '
-                    'the required "mode" property.'
-                )
-            mode = items["mode"]
-            register = self._register_list.append_register(
-                name=name, mode=mode, description=description
+            errors.append(
+                f'Register "{name}" in {self._source_definition_file} does not have '
+                'the required "mode" property.'
             )
 
-        if "bit" in items:
-            self._parse_bits(register=register, field_configurations=items["bit"])
+        errors += self._validate_fields(register_name=name, register_items=items)
 
-        if "bit_vector" in items:
-            self._parse_bit_vectors(register=register, field_configurations=items["bit_vector"])
+        return errors
 
-        if "enumeration" in items:
-            self._parse_enumerations(register=register, field_configurations=items["enumeration"])
-
-        if "integer" in items:
-            self._parse_integers(register=register, field_configurations=items["integer"])
+    def _validate_register_array_required_items(
+        self, name: str, items: dict[str, Any]
+    ) -> list[str]:
+        errors = []
 
-    def _parse_register_array(self, name: str, items: dict[str, Any]) -> None:
-        for required_attribute in self.required_register_array_items:
-            if required_attribute not in items:
-                message = (
+        for item_name in self.required_register_array_items:
+            if item_name not in items:
+                errors.append(
                     f'Register array "{name}" in {self._source_definition_file} does not have '
-                    f'the required "{required_attribute}" property.'
+                    f'the required "{item_name}" property.'
                 )
-                raise ValueError(message)
+
+        return errors
+
+    def _validate_register_array(self, name: str, items: dict[str, Any]) -> list[str]:
+        errors = self._validate_register_array_required_items(name=name, items=items)
 
         for item_name in items:
             if item_name not in self.recognized_register_array_items:
-                message = (
+                errors.append(
                     f'Error while parsing register array "{name}" in '
                     f'{self._source_definition_file}: Unknown key "{item_name}".'
                 )
-                raise ValueError(message)
 
-        length = items["array_length"]
-        description = items.get("description", "")
-        register_array = self._register_list.append_register_array(
-            name=name, length=length, description=description
-        )
+        if not isinstance(items.get("power_of_two_stride", False), bool):
+            errors.append(
+                f'Error while parsing register array "{name}" in '
+                f'{self._source_definition_file}: Property "power_of_two_stride" must be a boolean.'
+            )
 
-        for register_name, register_items in items["register"].items():
+        for register_name, register_items in items.get("register", {}).items():
             # The only required field
             if "mode" not in register_items:
-                message = (
+                errors.append(
                     f'Register "{register_name}" within array "{name}" in '
                     f'{self._source_definition_file} does not have the required "mode" property.'
                 )
-                raise ValueError(message)
 
-            for register_item_name in register_items.keys():
-                if register_item_name not in self.recognized_register_items:
-                    message = (
+            for item_name in register_items:
+                if item_name not in self.recognized_register_items:
+                    errors.append(
                         f'Error while parsing register "{register_name}" in array "{name}" in '
-                        f'{self._source_definition_file}: Unknown key "{register_item_name}".'
+                        f'{self._source_definition_file}: Unknown key "{item_name}".'
                     )
-                    raise ValueError(message)
 
+            if not isinstance(register_items.get("static", False), bool):
+                errors.append(
+                    f'Error while parsing register "{register_name}" in array "{name}" in '
+                    f'{self._source_definition_file}: Property "static" must be a boolean.'
+                )
+
+            errors += self._validate_fields(
+                register_name=register_name, register_items=register_items
+            )
+
+        return errors
+
+    def _validate_fields(self, register_name: str, register_items: dict[str, Any]) -> list[str]:
+        errors = []
+
+        for field_type, (recognized_items, required_items) in self._field_items.items():
+            for field_name, field_items in register_items.get(field_type, {}).items():
+                for item_name in required_items:
+                    if item_name not in field_items:
+                        errors.append(
+                            f'Field "{field_name}" in register "{register_name}" in '
+                            f"{self._source_definition_file} does not have the "
+                            f'required "{item_name}" property.'
+                        )
+
+                for item_name in field_items:
+                    if item_name not in recognized_items:
+                        errors.append(
+                            f'Error while parsing field "{field_name}" in register '
+                            f'"{register_name}" in {self._source_definition_file}: '
+                            f'Unknown key "{item_name}".'
+                        )
+
+        return errors
+
+    def _parse_constant(self, name: str, items: dict[str, Any]) -> None:
+        value = items["value"]
+        description = items.get("description", "")
+
+        if items.get("data_type") == "unsigned":
+            value = UnsignedVector(value)
+
+        self._register_list.add_constant(name=name, value=value, description=description)
+
+    def _parse_plain_register(self, name: str, items: dict[str, Any]) -> "Register":
+        description = items.get("description", "")
+
+        if name in self._default_register_by_name:
+            register = self.copy_default_register(name=name)
+            register.description = description
+
+        else:
+            mode = items["mode"]
+            register = Register(
+                name=name, index=self._register_indexes[name], mode=mode, description=description
+            )
+
+        if "commits" in items:
+            register.commits = list(items["commits"])
+
+        if "static" in items:
+            register.static = items["static"]
+
+        self._parse_fields(register=register, items=items)
+
+        return register
+
+    def _parse_register_array(self, name: str, items: dict[str, Any]) -> RegisterArray:
+        length = items["array_length"]
+        description = items.get("description", "")
+        register_array = RegisterArray(
+            name=name,
+            base_index=self._register_array_base_indexes[name],
+            length=length,
+            description=description,
+            power_of_two_stride=items.get("power_of_two_stride", False),
+        )
+
+        for register_name, register_items in items["register"].items():
             mode = register_items["mode"]
             description = register_items.get("description", "")
 
@@ -240,63 +648,59 @@ class RegisterParser:
                 name=register_name, mode=mode, description=description
             )
 
-            if "bit" in register_items:
-                self._parse_bits(register=register, field_configurations=register_items["bit"])
+            if "commits" in register_items:
+                register.commits = list(register_items["commits"])
 
-            if "bit_vector" in register_items:
-                self._parse_bit_vectors(
-                    register=register, field_configurations=register_items["bit_vector"]
-                )
+            if "static" in register_items:
+                register.static = register_items["static"]
 
-            if "enumeration" in register_items:
-                self._parse_enumerations(
-                    register=register, field_configurations=register_items["enumeration"]
-                )
+            self._parse_fields(register=register, items=register_items)
 
-            if "integer" in register_items:
-                self._parse_integers(
-                    register=register, field_configurations=register_items["integer"]
-                )
+        return register_array
 
-    def _check_field_items(
-        self,
-        register_name: str,
-        field_name: str,
-        field_items: dict[str, Any],
-        recognized_items: set[str],
-        required_items: list[str],
-    ) -> None:
-        """
-        Will raise exception if anything is wrong.
-        """
-        for item_name in required_items:
-            if item_name not in field_items:
-                message = (
-                    f'Field "{field_name}" in register "{register_name}" in '
-                    f"{self._source_definition_file} does not have the "
-                    f'required "{item_name}" property.'
-                )
-                raise ValueError(message)
+    def _parse_programming_sequence(self, name: str, items: dict[str, Any]) -> None:
+        programming_sequence = self._register_list.add_programming_sequence(
+            name=name, description=items.get("description", "")
+        )
 
-        for item_name in field_items.keys():
-            if item_name not in recognized_items:
-                message = (
-                    f'Error while parsing field "{field_name}" in register '
-                    f'"{register_name}" in {self._source_definition_file}: '
-                    f'Unknown key "{item_name}".'
-                )
-                raise ValueError(message)
+        for step in items["step"]:
+            if "delay_us" in step:
+                programming_sequence.append_delay(microseconds=step["delay_us"])
+                continue
 
-    def _parse_bits(self, register: "Register", field_configurations: dict[str, Any]) -> None:
-        for field_name, field_items in field_configurations.items():
-            self._check_field_items(
-                register_name=register.name,
-                field_name=field_name,
-                field_items=field_items,
-                recognized_items=self.recognized_bit_items,
-                required_items=self.required_bit_items,
+            action = "write" if "write" in step else "wait"
+            match = self._sequence_target_re.match(step[action])
+            assert match is not None, "Should have been caught by validation."
+
+            array_index = match.group("index")
+            append = (
+                programming_sequence.append_write
+                if action == "write"
+                else programming_sequence.append_wait
+            )
+            append(
+                register=match.group("register"),
+                value=step["value"],
+                field=match.group("field"),
+                register_array=match.group("array"),
+                array_index=None if array_index is None else int(array_index),
             )
 
+    def _parse_fields(self, register: "Register", items: dict[str, Any]) -> None:
+        if "bit" in items:
+            self._parse_bits(register=register, field_configurations=items["bit"])
+
+        if "bit_vector" in items:
+            self._parse_bit_vectors(register=register, field_configurations=items["bit_vector"])
+
+        if "enumeration" in items:
+            self._parse_enumerations(register=register, field_configurations=items["enumeration"])
+
+        if "integer" in items:
+            self._parse_integers(register=register, field_configurations=items["integer"])
+
+    def _parse_bits(self, register: "Register", field_configurations: dict[str, Any]) -> None:
+        for field_name, field_items in field_configurations.items():
             description = field_items.get("description", "")
             default_value = field_items.get("default_value", "0")
 
@@ -308,14 +712,6 @@ class RegisterParser:
         self, register: "Register", field_configurations: dict[str, Any]
     ) -> None:
         for field_name, field_items in field_configurations.items():
-            self._check_field_items(
-                register_name=register.name,
-                field_name=field_name,
-                field_items=field_items,
-                recognized_items=self.recognized_bit_vector_items,
-                required_items=self.required_bit_vector_items,
-            )
-
             width = field_items["width"]
 
             description = field_items.get("description", "")
@@ -329,22 +725,14 @@ class RegisterParser:
         self, register: "Register", field_configurations: dict[str, Any]
     ) -> None:
         for field_name, field_items in field_configurations.items():
-            self._check_field_items(
-                register_name=register.name,
-                field_name=field_name,
-                field_items=field_items,
-                recognized_items=self.recognized_enumeration_items,
-                # Check that we have at least one element.
-                # This is checked also in the Enumeration class, which is needed if the user
-                # is working directly with the Python API.
-                # That is where we usually sanity check, to avoid duplication.
-                # However, this particular check is needed here also since the logic for default
-                # value below does not work if there are no elements.
-                required_items=self.required_enumeration_items,
-            )
-
             description = field_items.get("description", "")
-            elements = field_items.get("element")
+            # Presence of at least one element is checked in the validation.
+            # This is checked also in the Enumeration class, which is needed if the user
+            # is working directly with the Python API.
+            # That is where we usually sanity check, to avoid duplication.
+            # However, this particular check is needed in the parser also since the logic for
+            # default value below does not work if there are no elements.
+            elements = field_items["element"]
 
             # The default "default value" is the first declared enumeration element.
             # Note that this works because dictionaries in Python are guaranteed ordered since
@@ -360,14 +748,6 @@ class RegisterParser:
 
     def _parse_integers(self, register: "Register", field_configurations: dict[str, Any]) -> None:
         for field_name, field_items in field_configurations.items():
-            self._check_field_items(
-                register_name=register.name,
-                field_name=field_name,
-                field_items=field_items,
-                recognized_items=self.recognized_integer_items,
-                required_items=self.required_integer_items,
-            )
-
             max_value = field_items["max_value"]
 
             description = field_items.get("description", "")
@@ -7,15 +7,20 @@
 # https://github.com/hdl-registers/hdl-registers
 # --------------------------------------------------------------------------------------------------
 
+# Standard libraries
+import copy
+import pickle
+
 # Third party libraries
 import pytest
 from tsfpga.system_utils import create_file
 
 # First party libraries
+from hdl_registers import HDL_REGISTERS_TESTS
 from hdl_registers.constant.bit_vector_constant import UnsignedVectorConstant
 from hdl_registers.constant.string_constant import StringConstant
 from hdl_registers.parser.toml import from_toml
-from hdl_registers.register import Register
+from hdl_registers.register import FrozenRegister, Register
 
 
 def test_overriding_default_register(tmp_path):
@@ -36,6 +41,298 @@ description = "apa"
     assert register_list.get_register("config").description == "apa"
 
 
+def test_commits_of_double_buffered_registers(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register.gain]
+
+mode = "r_w"
+
+[register.filter]
+
+mode = "wpulse"
+commits = ["gain"]
+""",
+    )
+    register_list = from_toml(name="", toml_file=toml_path)
+
+    assert register_list.get_register("filter").commits == ["gain"]
+    assert register_list.get_register("gain").commits == []
+    assert register_list.get_commit_registers() == {"gain": register_list.get_register("filter")}
+
+
+def test_static_registers(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register.version]
+
+mode = "r"
+static = true
+
+[register.status]
+
+mode = "r"
+
+[register_array.channels]
+
+array_length = 2
+
+[register_array.channels.register.capability]
+
+mode = "r"
+static = true
+""",
+    )
+    register_list = from_toml(name="", toml_file=toml_path)
+
+    assert register_list.get_register("version").static
+    assert not register_list.get_register("status").static
+    assert register_list.get_register_array("channels").get_register("capability").static
+
+
+def test_static_property_that_is_not_a_boolean_should_raise_exception(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register.version]
+
+mode = "r"
+static = "yes"
+
+[register_array.channels]
+
+array_length = 2
+
+[register_array.channels.register.capability]
+
+mode = "r"
+static = 1
+""",
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        from_toml(name="", toml_file=toml_path)
+    assert str(exception_info.value) == (
+        f'Error while parsing register "version" in {toml_path}: '
+        'Property "static" must be a boolean.\n'
+        f'Error while parsing register "capability" in array "channels" in {toml_path}: '
+        'Property "static" must be a boolean.'
+    )
+
+
+def test_register_array_with_power_of_two_stride(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register.config]
+
+mode = "r_w"
+
+[register_array.channels]
+
+array_length = 4
+power_of_two_stride = true
+
+[register_array.channels.register.gain]
+
+mode = "r_w"
+
+[register_array.channels.register.offset]
+
+mode = "r_w"
+
+[register_array.channels.register.status]
+
+mode = "r"
+
+[register_array.dummies]
+
+array_length = 2
+
+[register_array.dummies.register.dummy]
+
+mode = "r_w"
+""",
+    )
+    register_list = from_toml(name="", toml_file=toml_path)
+
+    channels = register_list.get_register_array("channels")
+    assert channels.power_of_two_stride
+    assert channels.stride == 4
+    # Aligned to the stride, after the 'config' register.
+    assert channels.base_index == 4
+    assert register_list.get_register_array("dummies").base_index == 20
+
+    # The lazy parser calculates the indexes without creating the objects.
+    lazy_register_list = from_toml(name="", toml_file=toml_path, lazy=True)
+    assert lazy_register_list.get_register_array("channels").base_index == 4
+    assert lazy_register_list.get_register_array("dummies").base_index == 20
+
+
+def test_power_of_two_stride_property_that_is_not_a_boolean_should_raise_exception(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register_array.channels]
+
+array_length = 2
+power_of_two_stride = "yes"
+
+[register_array.channels.register.gain]
+
+mode = "r_w"
+""",
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        from_toml(name="", toml_file=toml_path)
+    assert str(exception_info.value) == (
+        f'Error while parsing register array "channels" in {toml_path}: '
+        'Property "power_of_two_stride" must be a boolean.'
+    )
+
+
+def test_programming_sequences(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register.config]
+
+mode = "r_w"
+
+bit.enable.default_value = "0"
+
+[register_array.channels]
+
+array_length = 2
+
+[register_array.channels.register.status]
+
+mode = "r"
+
+bit.ready.default_value = "0"
+
+[programming_sequence.initialize]
+
+description = "apa"
+step = [
+  { write = "config.enable", value = 1 },
+  { wait = "channels[1].status.ready", value = 1 },
+  { delay_us = 10 },
+  { write = "config", value = 0 },
+]
+""",
+    )
+    register_list = from_toml(name="", toml_file=toml_path)
+
+    assert len(register_list.programming_sequences) == 1
+    programming_sequence = register_list.programming_sequences[0]
+    assert programming_sequence.name == "initialize"
+    assert programming_sequence.description == "apa"
+    assert [str(step) for step in programming_sequence.steps] == [
+        "write config.enable = 1",
+        "wait channels[1].status.ready == 1",
+        "delay 10 us",
+        "write config = 0",
+    ]
+
+    step = programming_sequence.steps[1]
+    assert step.register_array == "channels"
+    assert step.array_index == 1
+    assert step.register == "status"
+    assert step.field == "ready"
+
+
+def test_programming_sequence_with_invalid_step_should_raise_exception(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register.config]
+
+mode = "r_w"
+
+[programming_sequence.initialize]
+
+apa = 3
+step = [
+  { write = "config" },
+  { write = "config", wait = "config", value = 1 },
+  { write = "config[0]", value = 1 },
+  { delay_us = 10, hest = 1 },
+  3,
+]
+
+[programming_sequence.bamse]
+
+description = "no steps"
+""",
+    )
+
+    prefix = f'Error while parsing programming sequence "initialize" in {toml_path}:'
+    with pytest.raises(ValueError) as exception_info:
+        from_toml(name="", toml_file=toml_path)
+    assert str(exception_info.value) == (
+        f'{prefix} Unknown key "apa".\n'
+        f'{prefix} Step 0 does not have the required "value" property.\n'
+        f'{prefix} Step 1 must have exactly one of "write", "wait" or "delay_us".\n'
+        f'{prefix} Step 2 has invalid register "config[0]". '
+        'Expected e.g. "register", "register.field" or "array[0].register.field".\n'
+        f'{prefix} Step 3 has unknown key "hest".\n'
+        f"{prefix} Step 4 is not a table.\n"
+        f'Programming sequence "bamse" in {toml_path} does not have the required "step" property.'
+    )
+
+
+def test_register_pairs(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register.timestamp_low]
+
+mode = "r"
+
+[register.timestamp_high]
+
+mode = "r"
+
+[register_pair.timestamp]
+
+low = "timestamp_low"
+high = "timestamp_high"
+description = "apa"
+""",
+    )
+    register_list = from_toml(name="", toml_file=toml_path)
+
+    assert len(register_list.register_pairs) == 1
+    register_pair = register_list.register_pairs[0]
+    assert register_pair.name == "timestamp"
+    assert register_pair.low == "timestamp_low"
+    assert register_pair.high == "timestamp_high"
+    assert register_pair.description == "apa"
+
+
+def test_register_pair_with_missing_or_unknown_property_should_raise_exception(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register_pair.timestamp]
+
+low = "timestamp_low"
+dummy = 3
+""",
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        from_toml(name="", toml_file=toml_path)
+    assert str(exception_info.value) == (
+        f'Register pair "timestamp" in {toml_path} does not have the required "high" property.\n'
+        f'Error while parsing register pair "timestamp" in {toml_path}: Unknown key "dummy".'
+    )
+
+
 def test_changing_mode_of_default_register_should_raise_exception(tmp_path):
     toml_path = create_file(
         file=tmp_path / "regs.toml",
@@ -458,6 +755,52 @@ data_type = "signed"
     )
 
 
+def test_all_errors_should_be_reported_in_one_exception(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[constant.data_width]
+
+description = "the width"
+
+[register.apa]
+
+mode = "r_w"
+dummy = 3
+bit.a.apa = "hest"
+integer.b.min_value = 0
+
+[register.hest]
+
+description = "no mode"
+
+[register_array.zebra]
+
+array_length = 2
+dummy = 4
+
+[register_array.zebra.register.data]
+
+bit_vector.c.description = "no width"
+""",
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        from_toml(name="", toml_file=toml_path)
+    assert str(exception_info.value) == (
+        f'Constant "data_width" in {toml_path} does not have the required "value" property.\n'
+        f'Error while parsing register "apa" in {toml_path}: Unknown key "dummy".\n'
+        f'Error while parsing field "a" in register "apa" in {toml_path}: Unknown key "apa".\n'
+        f'Field "b" in register "apa" in {toml_path} does not have the required "max_value" '
+        "property.\n"
+        f'Register "hest" in {toml_path} does not have the required "mode" property.\n'
+        f'Error while parsing register array "zebra" in {toml_path}: Unknown key "dummy".\n'
+        f'Register "data" within array "zebra" in {toml_path} does not have the required "mode" '
+        "property.\n"
+        f'Field "c" in register "data" in {toml_path} does not have the required "width" property.'
+    )
+
+
 def test_order_of_registers_and_fields(tmp_path):  # pylint: disable=too-many-statements
     toml_data = """
 ################################################################################
@@ -644,3 +987,220 @@ default_value="0000000000000011"
     assert registers[2].registers[1].fields[0].description == "Some data"
     assert registers[2].registers[1].fields[0].width == 16
     assert registers[2].registers[1].fields[0].default_value == "0000000000000011"
+
+
+def get_default_registers():
+    register = Register(name="default_config", index=0, mode="r_w", description="")
+    register.append_bit(name="enable", description="", default_value="0")
+
+    return [register, Register(name="default_status", index=1, mode="r", description="")]
+
+
+@pytest.mark.parametrize("lazy", [False, True])
+def test_default_registers_are_copied_only_when_updated(tmp_path, lazy):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register.default_config]
+
+description = "apa"
+bit.start.default_value = "1"
+
+[register.data]
+
+mode = "w"
+""",
+    )
+    default_registers = get_default_registers()
+    default_config, default_status = default_registers
+
+    register_list = from_toml(
+        name="", toml_file=toml_path, default_registers=default_registers, lazy=lazy
+    )
+    other_register_list = from_toml(
+        name="", toml_file=toml_path, default_registers=default_registers, lazy=lazy
+    )
+
+    # Updated by the data, so copied.
+    assert register_list.register_objects[0] is not default_config
+    assert register_list.register_objects[0].description == "apa"
+    assert [field.name for field in register_list.register_objects[0].fields] == [
+        "enable",
+        "start",
+    ]
+    assert default_config.description == ""
+    assert len(default_config.fields) == 1
+
+    # Not updated by the data, so shared, as a frozen copy.
+    shared_status = register_list.register_objects[1]
+    assert isinstance(shared_status, FrozenRegister)
+    assert other_register_list.register_objects[1] is shared_status
+
+    # Copied when accessed, since it might be modified.
+    register_list.get_register("default_status").description = "hest"
+    assert register_list.register_objects[1] is not shared_status
+    assert register_list.get_register("default_status").description == "hest"
+    assert other_register_list.register_objects[1] is shared_status
+    assert shared_status.description == ""
+    assert default_status.description == ""
+
+
+def test_lazy_parse_gives_same_result_as_full_parse():
+    toml_file = HDL_REGISTERS_TESTS / "regs_test.toml"
+
+    register_list = from_toml(
+        name="test", toml_file=toml_file, default_registers=get_default_registers()
+    )
+    lazy_register_list = from_toml(
+        name="test", toml_file=toml_file, default_registers=get_default_registers(), lazy=True
+    )
+
+    # Access a few objects before the full build, which should not affect the result.
+    assert lazy_register_list.get_register("address") is not None
+    assert lazy_register_list.get_register_array("dummies2") is not None
+    assert lazy_register_list.get_register_index(
+        register_name="dummy", register_array_name="dummies2", register_array_index=1
+    ) == register_list.get_register_index(
+        register_name="dummy", register_array_name="dummies2", register_array_index=1
+    )
+
+    assert repr(lazy_register_list) == repr(register_list)
+    assert lazy_register_list.object_hash == register_list.object_hash
+
+
+def test_lazy_parse_creates_only_the_requested_register(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register.data]
+
+mode = "w"
+
+[register.status]
+
+mode = "r"
+bit.a.apa = "hest"
+
+[register_array.configs]
+
+array_length = 3
+
+[register_array.configs.register.first]
+
+mode = "r_w"
+
+[register_array.configs.register.second]
+
+mode = "r_w"
+
+[register_array.others]
+
+array_length = 2
+
+[register_array.others.register.first]
+
+mode = "r_w"
+bit.b.apa = "zebra"
+
+[register.config]
+
+description = "apa"
+""",
+    )
+    register_list = from_toml(
+        name="",
+        toml_file=toml_path,
+        default_registers=[Register(name="config", index=0, mode="r_w", description="")],
+        lazy=True,
+    )
+
+    config = register_list.get_register("config")
+    assert config.index == 0
+    assert config.description == "apa"
+
+    # The erroneous register and register array are not created, hence no error.
+    data = register_list.get_register("data")
+    assert data.index == 1
+    assert register_list.get_register_index(register_name="data") == 1
+
+    # Index of the register array is calculated without creating the preceding 'status' register.
+    assert (
+        register_list.get_register_index(
+            register_name="first", register_array_name="configs", register_array_index=2
+        )
+        == 7
+    )
+
+    # Same object should be returned when accessed again.
+    assert register_list.get_register("data") is data
+
+    with pytest.raises(ValueError) as exception_info:
+        register_list.get_register("status")
+    assert str(exception_info.value) == (
+        f'Error while parsing field "a" in register "status" in {toml_path}: Unknown key "apa".'
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        register_list.get_register_array("others")
+    assert str(exception_info.value) == (
+        f'Error while parsing field "b" in register "first" in {toml_path}: Unknown key "apa".'
+    )
+
+    with pytest.raises(ValueError) as exception_info:
+        register_list.get_register("apa")
+    assert str(exception_info.value) == 'Could not find register "apa" within register list ""'
+
+
+def test_lazy_parse_reports_all_errors_of_the_requested_register(tmp_path):
+    toml_path = create_file(
+        file=tmp_path / "regs.toml",
+        contents="""
+[register.apa]
+
+mode = "r_w"
+dummy = 3
+bit.a.apa = "hest"
+
+[register.hest]
+
+description = "no mode"
+""",
+    )
+    register_list = from_toml(name="", toml_file=toml_path, lazy=True)
+
+    with pytest.raises(ValueError) as exception_info:
+        register_list.get_register("apa")
+    assert str(exception_info.value) == (
+        f'Error while parsing register "apa" in {toml_path}: Unknown key "dummy".\n'
+        f'Error while parsing field "a" in register "apa" in {toml_path}: Unknown key "apa".'
+    )
+
+
+def test_lazy_parse_full_build_uses_already_created_objects(tmp_path):
+    register_list = from_toml(
+        name="test", toml_file=HDL_REGISTERS_TESTS / "regs_test.toml", lazy=True
+    )
+
+    register = register_list.get_register("status")
+    register_array = register_list.get_register_array("dummies")
+
+    assert register in register_list.register_objects
+    assert register_array in register_list.register_objects
+
+    # Should be possible to append once all registers have been created.
+    register_list.append_register(name="new", mode="r", description="")
+    assert register_list.register_objects[-1].name == "new"
+
+
+def test_lazy_parse_register_list_can_be_pickled():
+    toml_file = HDL_REGISTERS_TESTS / "regs_test.toml"
+
+    register_list = from_toml(name="test", toml_file=toml_file)
+    lazy_register_list = from_toml(name="test", toml_file=toml_file, lazy=True)
+
+    restored = pickle.loads(pickle.dumps(lazy_register_list))
+    assert repr(restored) == repr(register_list)
+
+    assert repr(copy.deepcopy(from_toml(name="test", toml_file=toml_file, lazy=True))) == repr(
+        register_list
+    )
@@ -24,7 +24,10 @@ if TYPE_CHECKING:
 
 
 def from_toml(
-    name: str, toml_file: Path, default_registers: Optional[list["Register"]] = None
+    name: str,
+    toml_file: Path,
+    default_registers: Optional[list["Register"]] = None,
+    lazy: bool = False,
 ) -> "RegisterList":
     """
     Parse a TOML file with register data.
@@ -33,6 +36,8 @@ def from_toml(
         name: The name of the register list.
         toml_file: The TOML file path.
         default_registers: List of default registers.
+        lazy: Create register objects only when they are accessed.
+            See :meth:`.RegisterParser.parse` for details.
 
     Return:
         The resulting register list.
@@ -42,7 +47,7 @@ def from_toml(
     )
     toml_data = _load_toml_file(file_path=toml_file)
 
-    return parser.parse(register_data=toml_data)
+    return parser.parse(register_data=toml_data, lazy=lazy)
 
 
 def _load_toml_file(file_path: Path) -> dict[str, Any]:
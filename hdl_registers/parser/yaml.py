@@ -24,7 +24,10 @@ if TYPE_CHECKING:
 
 
 def from_yaml(
-    name: str, yaml_file: Path, default_registers: Optional[list["Register"]] = None
+    name: str,
+    yaml_file: Path,
+    default_registers: Optional[list["Register"]] = None,
+    lazy: bool = False,
 ) -> "RegisterList":
     """
     Parse a YAML file with register data.
@@ -33,6 +36,8 @@ def from_yaml(
         name: The name of the register list.
         yaml_file: The YAML file path.
         default_registers: List of default registers.
+        lazy: Create register objects only when they are accessed.
+            See :meth:`.RegisterParser.parse` for details.
 
     Return:
         The resulting register list.
@@ -42,7 +47,7 @@ def from_yaml(
     )
     yaml_data = _load_yaml_file(file_path=yaml_file)
 
-    return parser.parse(register_data=yaml_data)
+    return parser.parse(register_data=yaml_data, lazy=lazy)
 
 
 def _load_yaml_file(file_path: Path) -> dict[str, Any]:
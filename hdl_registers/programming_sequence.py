@@ -0,0 +1,342 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Standard libraries
+from enum import IntEnum
+from typing import TYPE_CHECKING, NamedTuple, Optional, Union
+
+# Local folder libraries
+from .field.enumeration import Enumeration
+
+if TYPE_CHECKING:
+    # Local folder libraries
+    from .register import Register
+    from .register_list import RegisterList
+
+REGISTER_VALUE_MASK = 0xFFFFFFFF
+
+
+class SequenceOpcode(IntEnum):
+    """
+    Operation of one entry in a compiled programming sequence.
+    """
+
+    # Write 'value' to the register.
+    WRITE = 0
+    # Read the register, replace the bits in 'mask' with 'value', and write the result.
+    MODIFY = 1
+    # Read the register until the bits in 'mask' equal 'value'.
+    WAIT = 2
+    # Wait for 'value' microseconds.
+    DELAY = 3
+
+
+class SequenceEntry(NamedTuple):
+    """
+    One entry in a compiled programming sequence.
+    """
+
+    opcode: SequenceOpcode
+    # Byte address of the register, relative to the base address of the register list.
+    # Zero for a delay.
+    address: int
+    mask: int
+    value: int
+    # Description of the step that the entry was compiled from.
+    comment: str
+
+
+class SequenceStep:
+
+    """
+    One step of a programming sequence.
+    """
+
+    def __init__(
+        self,
+        action: str,
+        value: Union[int, float, str],
+        register: Optional[str] = None,
+        field: Optional[str] = None,
+        register_array: Optional[str] = None,
+        array_index: Optional[int] = None,
+    ):
+        """
+        Arguments:
+            action: One of ``"write"``, ``"wait"`` or ``"delay"``.
+            value: The register or field value to write or to wait for.
+                For an enumeration field, the name of the element.
+                For a delay, the number of microseconds.
+            register: The name of the register.
+                Not used for a delay.
+            field: The name of the field within the register.
+                If not given, the whole register is written or compared.
+            register_array: The name of the register array, if the register is within one.
+            array_index: The array iteration index, if the register is within a register array.
+        """
+        self.action = action
+        self.value = value
+        self.register = register
+        self.field = field
+        self.register_array = register_array
+        self.array_index = array_index
+
+    @property
+    def target(self) -> str:
+        """
+        Human-readable name of the register or field that the step accesses.
+        E.g. ``channels[1].config.enable``.
+        """
+        result = ""
+        if self.register_array is not None:
+            result += f"{self.register_array}[{self.array_index}]."
+
+        result += str(self.register)
+        if self.field is not None:
+            result += f".{self.field}"
+
+        return result
+
+    def __str__(self) -> str:
+        if self.action == "delay":
+            return f"delay {self.value} us"
+
+        operator = "=" if self.action == "write" else "=="
+        return f"{self.action} {self.target} {operator} {self.value}"
+
+    def __repr__(self) -> str:
+        return f"""{self.__class__.__name__}(\
+action={self.action},\
+value={self.value},\
+register={self.register},\
+field={self.field},\
+register_array={self.register_array},\
+array_index={self.array_index},\
+)"""
+
+
+class ProgrammingSequence:
+
+    """
+    Represent a named sequence of register writes, polls and delays.
+    E.g. the initialization of a device.
+
+    The sequence is compiled to a table of address/mask/value entries, see :meth:`.compile`,
+    that can be executed by a small interpreter or a DMA engine.
+    """
+
+    def __init__(self, name: str, description: str):
+        """
+        Arguments:
+            name: The name of this programming sequence.
+            description: Textual programming sequence description.
+        """
+        self.name = name
+        self.description = description
+
+        self.steps: list[SequenceStep] = []
+
+    def append_write(
+        self,
+        register: str,
+        value: Union[int, float, str],
+        field: Optional[str] = None,
+        register_array: Optional[str] = None,
+        array_index: Optional[int] = None,
+    ) -> SequenceStep:
+        """
+        Append a step that writes a register, or a field within a register.
+        See :class:`.SequenceStep` for documentation of the arguments.
+
+        A field is written the same way as with the generated field setters.
+        I.e. a read-modify-write if the register mode and fields call for it, otherwise a write
+        with all other fields at their default value.
+        """
+        return self._append(
+            SequenceStep(
+                action="write",
+                value=value,
+                register=register,
+                field=field,
+                register_array=register_array,
+                array_index=array_index,
+            )
+        )
+
+    def append_wait(
+        self,
+        register: str,
+        value: Union[int, float, str],
+        field: Optional[str] = None,
+        register_array: Optional[str] = None,
+        array_index: Optional[int] = None,
+    ) -> SequenceStep:
+        """
+        Append a step that reads a register until it, or a field within it, equals the
+        given value.
+        See :class:`.SequenceStep` for documentation of the arguments.
+        """
+        return self._append(
+            SequenceStep(
+                action="wait",
+                value=value,
+                register=register,
+                field=field,
+                register_array=register_array,
+                array_index=array_index,
+            )
+        )
+
+    def append_delay(self, microseconds: int) -> SequenceStep:
+        """
+        Append a step that waits for the given time.
+        """
+        return self._append(SequenceStep(action="delay", value=microseconds))
+
+    def _append(self, step: SequenceStep) -> SequenceStep:
+        self.steps.append(step)
+        return step
+
+    def compile(self, register_list: "RegisterList") -> list[SequenceEntry]:
+        """
+        Compile the steps to a table of entries.
+
+        A field write to a register in mode ``r_w``, whose value is already known from an
+        earlier write in the sequence, is compiled to a plain write instead of a
+        read-modify-write.
+        Note that this assumes that nothing else writes the register while the sequence runs.
+
+        Arguments:
+            register_list: The register list that the register names refer to.
+
+        Return:
+            One entry for each step.
+            Will raise exception if a step is not valid for the register list.
+        """
+        result = []
+        # Register values that are known from earlier writes in the sequence, keyed by address.
+        known_values: dict[int, int] = {}
+
+        for step_index, step in enumerate(self.steps):
+            try:
+                entry = self._compile_step(
+                    step=step, register_list=register_list, known_values=known_values
+                )
+            except ValueError as exception:
+                raise ValueError(
+                    f'Programming sequence "{self.name}" step {step_index} ({step}): {exception}'
+                ) from exception
+
+            result.append(entry)
+
+        return result
+
+    @staticmethod
+    def _compile_step(
+        step: SequenceStep, register_list: "RegisterList", known_values: dict[int, int]
+    ) -> SequenceEntry:
+        if step.action == "delay":
+            if not isinstance(step.value, int) or step.value < 0:
+                raise ValueError("Delay must be a non-negative integer number of microseconds.")
+
+            return SequenceEntry(
+                opcode=SequenceOpcode.DELAY, address=0, mask=0, value=step.value, comment=str(step)
+            )
+
+        if step.action not in ["write", "wait"]:
+            raise ValueError(f'Unknown action "{step.action}".')
+
+        register, address = ProgrammingSequence._get_register(
+            step=step, register_list=register_list
+        )
+
+        if step.field is None:
+            mask = REGISTER_VALUE_MASK
+            if not isinstance(step.value, int) or not 0 <= step.value <= REGISTER_VALUE_MASK:
+                raise ValueError("Register value must be a 32-bit unsigned integer.")
+            value = step.value
+        else:
+            field = register.get_field(step.field)
+            mask = field.max_binary_value << field.base_index
+            if isinstance(field, Enumeration):
+                value = field.set_value(field.get_element_by_name(str(step.value)))
+            else:
+                value = field.set_value(step.value)  # type: ignore[arg-type]
+
+        if step.action == "wait":
+            if not register.is_bus_readable:
+                raise ValueError(f'Can not wait for register in mode "{register.mode}".')
+
+            return SequenceEntry(
+                opcode=SequenceOpcode.WAIT,
+                address=address,
+                mask=mask,
+                value=value,
+                comment=str(step),
+            )
+
+        if not register.is_bus_writeable:
+            raise ValueError(f'Can not write register in mode "{register.mode}".')
+
+        if mask != REGISTER_VALUE_MASK:
+            if address in known_values:
+                value = known_values[address] & ~mask | value
+            # Same as the generated field setters.
+            elif register.mode == "r_w" and len(register.fields) > 1:
+                return SequenceEntry(
+                    opcode=SequenceOpcode.MODIFY,
+                    address=address,
+                    mask=mask,
+                    value=value,
+                    comment=str(step),
+                )
+            else:
+                value = register.default_value & ~mask | value
+
+        if register.mode == "r_w":
+            known_values[address] = value
+
+        return SequenceEntry(
+            opcode=SequenceOpcode.WRITE,
+            address=address,
+            mask=REGISTER_VALUE_MASK,
+            value=value,
+            comment=str(step),
+        )
+
+    @staticmethod
+    def _get_register(step: SequenceStep, register_list: "RegisterList") -> tuple["Register", int]:
+        """
+        Get the register that the step accesses, and its byte address.
+        """
+        if step.register is None:
+            raise ValueError("No register given.")
+
+        if step.register_array is None:
+            if step.array_index is not None:
+                raise ValueError("Array index given for a register that is not in an array.")
+
+            register = register_list.get_register(step.register)
+            return register, register.address
+
+        if step.array_index is None:
+            raise ValueError("No array index given for a register in an array.")
+
+        register_array = register_list.get_register_array(step.register_array)
+        register = register_array.get_register(step.register)
+        index = register_array.get_start_index(array_index=step.array_index) + register.index
+
+        return register, 4 * index
+
+    def __repr__(self) -> str:
+        return f"""{self.__class__.__name__}(\
+name={self.name},\
+description={self.description},\
+steps={','.join([repr(step) for step in self.steps])},\
+)"""
@@ -8,7 +8,9 @@
 # --------------------------------------------------------------------------------------------------
 
 # Standard libraries
-from typing import TYPE_CHECKING
+import copy
+import sys
+from typing import TYPE_CHECKING, Any, NoReturn
 
 # Local folder libraries
 from .field.bit import Bit
@@ -19,6 +21,9 @@ from .field.register_field import DEFAULT_FIELD_TYPE
 from .field.register_field_type import FieldType
 
 if TYPE_CHECKING:
+    # Third party libraries
+    import numpy
+
     # Local folder libraries
     from .field.register_field import RegisterField
 
@@ -67,6 +72,10 @@ class Register:
     Used to represent a register and its fields.
     """
 
+    # There can be a great many register objects in a large register list.
+    # Slots use less memory than a per-instance dictionary.
+    __slots__ = ("name", "index", "mode", "description", "fields", "bit_index", "commits", "static")
+
     def __init__(self, name: str, index: int, mode: str, description: str):
         """
         Arguments:
@@ -86,13 +95,26 @@ class Register:
         if mode not in REGISTER_MODES:
             raise ValueError(f'Invalid mode "{mode}" for register "{name}"')
 
-        self.name = name
+        # Names and descriptions are interned, since the same strings are typically repeated
+        # many times in a large register list.
+        self.name = sys.intern(name)
         self.index = index
         self.mode = mode
-        self.description = description
+        self.description = sys.intern(description)
         self.fields: list["RegisterField"] = []
         self.bit_index = 0
 
+        # Names of the plain registers and register arrays that are double-buffered, and
+        # committed to fabric by a write to this register.
+        # Only applicable for plain registers of mode "wpulse" or "r_wpulse".
+        self.commits: list[str] = []
+
+        # The value of the register does not change after reset, e.g. an ID, version or
+        # capability register.
+        # Software can read it once and cache the value.
+        # Only applicable for registers of mode "r".
+        self.static = False
+
     def append_bit(self, name: str, description: str, default_value: str) -> Bit:
         """
         Append a bit field to this register.
@@ -218,6 +240,41 @@ class Register:
 
         raise ValueError(f'Could not find field "{name}" within register "{self.name}"')
 
+    def get_field_values(self, register_values: Any) -> "numpy.ndarray":
+        """
+        Decode an array of register values into the values of each field in this register.
+        Uses :meth:`.RegisterField.get_values` for each field, meaning that all conversion is done
+        with vectorized NumPy operations.
+        Use this when decoding large amounts of data, e.g. register captures.
+
+        Requires the ``numpy`` Python package, which is not a dependency of ``hdl_registers``
+        otherwise.
+
+        Arguments:
+            register_values: Values of this register.
+                A NumPy array or anything that can be converted to one, e.g. a list.
+
+        Return:
+            NumPy structured array, of the same shape as the input, with one member per field.
+            The name of each member is the name of the field, and the ``dtype`` of each member is
+            the one given by :meth:`.RegisterField.get_values`.
+            E.g. ``result["my_field"]`` gives all the values of the field ``my_field``.
+        """
+        # Third party libraries
+        import numpy  # pylint: disable=import-outside-toplevel
+
+        register_values = numpy.asarray(register_values, dtype=numpy.uint32)
+        field_values = [field.get_values(register_values=register_values) for field in self.fields]
+
+        result = numpy.empty(
+            shape=register_values.shape,
+            dtype=[(field.name, values.dtype) for field, values in zip(self.fields, field_values)],
+        )
+        for field, values in zip(self.fields, field_values):
+            result[field.name] = values
+
+        return result
+
     @property
     def address(self) -> int:
         """
@@ -248,4 +305,74 @@ index={self.index},\
 mode={self.mode},\
 description={self.description},\
 fields={','.join([repr(field) for field in self.fields])},\
+commits={','.join(self.commits)},\
+static={self.static},\
 )"""
+
+
+class FrozenRegister(Register):
+    """
+    A register that can not be modified.
+    Used for default registers that are shared between many register lists,
+    see :meth:`.RegisterList.from_default_registers`.
+
+    A deep copy of a frozen register is a regular :class:`.Register`, that can be modified.
+    """
+
+    __slots__ = ()
+
+    @classmethod
+    def from_register(cls, register: Register) -> "FrozenRegister":
+        """
+        Create a frozen deep copy of a register.
+
+        Arguments:
+            register: The register to copy.
+        Return:
+            The frozen register.
+        """
+        frozen_register = cls.__new__(cls)
+
+        frozen_register.__setstate__(
+            (None, {name: copy.deepcopy(getattr(register, name)) for name in Register.__slots__})
+        )
+        object.__setattr__(frozen_register, "fields", tuple(frozen_register.fields))
+        object.__setattr__(frozen_register, "commits", tuple(frozen_register.commits))
+
+        return frozen_register
+
+    def __setstate__(self, state: tuple[None, dict[str, Any]]) -> None:
+        """
+        Set the slot values when unpickling or copying, bypassing :meth:`.__setattr__`.
+        """
+        _, slots = state
+        for name, value in slots.items():
+            object.__setattr__(self, name, value)
+
+    def __deepcopy__(self, memo: dict[int, Any]) -> Register:
+        register = Register.__new__(Register)
+
+        for name in Register.__slots__:
+            setattr(register, name, copy.deepcopy(getattr(self, name), memo))
+        register.fields = list(register.fields)
+        register.commits = list(register.commits)
+
+        return register
+
+    def __setattr__(self, name: str, value: Any) -> None:
+        self._raise_frozen()
+
+    def _append_field(self, field: "RegisterField") -> None:
+        self._raise_frozen()
+
+    def _raise_frozen(self) -> NoReturn:
+        raise AttributeError(
+            f'Register "{self.name}" is a default register that is shared with other register '
+            "lists, and can not be modified. "
+            "Use 'RegisterList.get_register' to get a copy that can be modified."
+        )
+
+    def __repr__(self) -> str:
+        # Same as for a regular register, so that the hash of a register list does not depend on
+        # whether the default registers are shared.
+        return f"{Register.__name__}{super().__repr__()[len(self.__class__.__name__) :]}"
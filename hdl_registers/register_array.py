@@ -7,6 +7,9 @@
 # https://github.com/hdl-registers/hdl-registers
 # --------------------------------------------------------------------------------------------------
 
+# Standard libraries
+import sys
+
 # Local folder libraries
 from .register import Register
 
@@ -18,19 +21,41 @@ class RegisterArray:
     number of times in a register list.
     """
 
-    def __init__(self, name: str, base_index: int, length: int, description: str):
+    __slots__ = (
+        "name",
+        "_first_free_index",
+        "length",
+        "description",
+        "power_of_two_stride",
+        "registers",
+    )
+
+    def __init__(
+        self,
+        name: str,
+        base_index: int,
+        length: int,
+        description: str,
+        power_of_two_stride: bool = False,
+    ):
         """
         Arguments:
             name: The name of this register array.
-            base_index: The zero-based index of the first register of this array in the
-                register list.
+            base_index: The zero-based index of the first free register index in the
+                register list, where this array shall start.
+                With a power-of-two stride, the array starts at the next multiple of the stride
+                instead.
             length: The number of times the register sequence shall be repeated.
             description: Textual register array description.
+            power_of_two_stride: Pad each repetition of the register sequence, so that the
+                distance between repetitions is a power of two number of registers.
+                See :ref:`basic_feature_register_array_stride`.
         """
-        self.name = name
-        self.base_index = base_index
+        self.name = sys.intern(name)
+        self._first_free_index = base_index
         self.length = length
-        self.description = description
+        self.description = sys.intern(description)
+        self.power_of_two_stride = power_of_two_stride
 
         self.registers: list[Register] = []
 
@@ -67,6 +92,67 @@ class RegisterArray:
 
         raise ValueError(f'Could not find register "{name}" within register array "{self.name}"')
 
+    @staticmethod
+    def calculate_stride(num_registers: int, power_of_two_stride: bool) -> int:
+        """
+        The number of register indexes between the start of two consecutive repetitions of
+        a register sequence.
+
+        Arguments:
+            num_registers: The number of registers in the sequence.
+            power_of_two_stride: Whether the sequence shall be padded to a power of two.
+        """
+        if power_of_two_stride and num_registers > 1:
+            return 1 << (num_registers - 1).bit_length()
+
+        return num_registers
+
+    @property
+    def stride(self) -> int:
+        """
+        The number of register indexes between the start of two consecutive repetitions of
+        this array.
+        Equal to the number of registers in the array, unless the array has a
+        power-of-two stride.
+        """
+        return self.calculate_stride(
+            num_registers=len(self.registers), power_of_two_stride=self.power_of_two_stride
+        )
+
+    @property
+    def base_index(self) -> int:
+        """
+        The zero-based index of the first register of this array in the register list.
+        With a power-of-two stride, this is aligned to the stride, so that the array index is a
+        bit slice of the register index.
+        """
+        stride = self.stride
+        if self.power_of_two_stride and stride > 1:
+            return -(-self._first_free_index // stride) * stride
+
+        return self._first_free_index
+
+    @base_index.setter
+    def base_index(self, value: int) -> None:
+        self._first_free_index = value
+
+    @property
+    def num_alignment_registers(self) -> int:
+        """
+        The number of unused register indexes before this array, that align its base index to
+        the stride.
+        """
+        return self.base_index - self._first_free_index
+
+    @property
+    def num_padding_registers(self) -> int:
+        """
+        The number of register indexes, in total over all repetitions, that are occupied by this
+        array but do not hold any register.
+        I.e. the address space cost of a power-of-two stride.
+        """
+        return self.length * (self.stride - len(self.registers))
+
     @property
     def index(self) -> int:
         """
@@ -75,7 +161,7 @@ class RegisterArray:
         Return:
             The highest index occupied by this array.
         """
-        return self.base_index + self.length * len(self.registers) - 1
+        return self.base_index + self.length * self.stride - 1
 
     def get_start_index(self, array_index: int) -> int:
         """
@@ -91,7 +177,7 @@ class RegisterArray:
                 f"of length {self.length}."
             )
 
-        return self.base_index + array_index * len(self.registers)
+        return self.base_index + array_index * self.stride
 
     def __repr__(self) -> str:
         return f"""{self.__class__.__name__}(\
@@ -99,5 +185,6 @@ name={self.name},\
 base_index={self.base_index},\
 length={self.length},\
 description={self.description},\
+power_of_two_stride={self.power_of_two_stride},\
 registers={','.join([repr(register) for register in self.registers])},\
 )"""
@@ -11,20 +11,34 @@
 import copy
 import hashlib
 from pathlib import Path
-from typing import TYPE_CHECKING, Optional, Union
+from typing import TYPE_CHECKING, Any, Iterator, Optional, Union
 
 # Local folder libraries
+from .constant.array_constant import ArrayConstant
 from .constant.bit_vector_constant import UnsignedVector, UnsignedVectorConstant
 from .constant.boolean_constant import BooleanConstant
 from .constant.float_constant import FloatConstant
 from .constant.integer_constant import IntegerConstant
 from .constant.string_constant import StringConstant
-from .register import Register
+from .programming_sequence import ProgrammingSequence
+from .register import FrozenRegister, Register
 from .register_array import RegisterArray
+from .register_pair import RegisterPair
 
 if TYPE_CHECKING:
     # Local folder libraries
     from .constant.constant import Constant
+    from .parser.parser import RegisterParser
+
+RegisterObjectT = Union[Register, RegisterArray]
+
+# Frozen copies of default registers, that are shared between all register lists that are created
+# from default registers with the same content.
+# Keyed by the hash of the default registers, so that a change to the default registers gives
+# new copies.
+_SHARED_DEFAULT_REGISTERS: dict[str, list[FrozenRegister]] = {}
+# Oldest copies will be dropped when the cache grows beyond this size.
+_SHARED_DEFAULT_REGISTERS_MAX_SIZE = 16
 
 
 class RegisterList:
@@ -45,12 +59,22 @@ class RegisterList:
         self.name = name
         self.source_definition_file = source_definition_file
 
-        self.register_objects: list[Union[Register, RegisterArray]] = []
+        self._register_objects: list[RegisterObjectT] = []
         self.constants: list["Constant"] = []
+        self.register_pairs: list[RegisterPair] = []
+        self.programming_sequences: list[ProgrammingSequence] = []
+
+        # Set when the register list has been parsed in lazy mode.
+        # The register objects are then created on demand.
+        self._lazy_parser: Optional["RegisterParser"] = None
 
     @classmethod
     def from_default_registers(
-        cls, name: str, source_definition_file: Path, default_registers: list[Register]
+        cls,
+        name: str,
+        source_definition_file: Path,
+        default_registers: list[Register],
+        share_registers: bool = False,
     ) -> "RegisterList":
         """
         Factory method. Create a ``RegisterList`` object from a plain list of registers.
@@ -63,6 +87,15 @@ class RegisterList:
                 Can be set to ``None`` if this information does not make sense in the current
                 use case.
             default_registers: These registers will be inserted in the register list.
+            share_registers: If ``False``, the register objects are copied to this
+                register list.
+
+                If ``True``, the register list holds frozen copies of the registers, that are
+                shared with all other register lists created from default registers with the
+                same content.
+                A shared register can not be modified, see :class:`.FrozenRegister`.
+                It is replaced with a copy that belongs to this register list when it is
+                accessed via :meth:`.get_register`.
         """
         # Before proceeding, perform a basic sanity check.
         # If the indexes are not correct, that will cause problems with the default registers
@@ -76,10 +109,70 @@ class RegisterList:
                 raise ValueError(message)
 
         register_list = cls(name=name, source_definition_file=source_definition_file)
-        register_list.register_objects = copy.deepcopy(default_registers)  # type: ignore[arg-type]
+
+        if share_registers:
+            register_list.register_objects = list(
+                cls._get_shared_default_registers(default_registers=default_registers)
+            )
+        else:
+            register_list.register_objects = copy.deepcopy(
+                default_registers  # type: ignore[arg-type]
+            )
 
         return register_list
 
+    @staticmethod
+    def _get_shared_default_registers(default_registers: list[Register]) -> list[FrozenRegister]:
+        key = hashlib.sha1(repr(default_registers).encode()).hexdigest()
+
+        if key not in _SHARED_DEFAULT_REGISTERS:
+            if len(_SHARED_DEFAULT_REGISTERS) >= _SHARED_DEFAULT_REGISTERS_MAX_SIZE:
+                # Dictionaries are ordered, so this is the oldest entry.
+                del _SHARED_DEFAULT_REGISTERS[next(iter(_SHARED_DEFAULT_REGISTERS))]
+
+            _SHARED_DEFAULT_REGISTERS[key] = [
+                FrozenRegister.from_register(register) for register in default_registers
+            ]
+
+        return _SHARED_DEFAULT_REGISTERS[key]
+
+    @property
+    def register_objects(self) -> list[RegisterObjectT]:
+        """
+        The registers and register arrays of this register list, in index order.
+
+        Note that if the register list was parsed in lazy mode, accessing this property will
+        create all register objects that have not already been created.
+
+        Note that the list might hold default registers that are shared with other register lists,
+        and can not be modified, see :meth:`.from_default_registers`.
+        Use :meth:`.get_register` to get a register that shall be modified.
+        """
+        if self._lazy_parser is not None:
+            # Clear before parsing, so that the parser can use this object as a regular
+            # register list.
+            lazy_parser = self._lazy_parser
+            self._lazy_parser = None
+
+            self._register_objects = lazy_parser.parse_register_objects()
+
+        return self._register_objects
+
+    @register_objects.setter
+    def register_objects(self, value: list[RegisterObjectT]) -> None:
+        self._lazy_parser = None
+        self._register_objects = value
+
+    def set_lazy_parser(self, lazy_parser: "RegisterParser") -> None:
+        """
+        Create the register objects on demand, using the given parser.
+        Used by :meth:`.RegisterParser.parse` in lazy mode, not intended to be called by the user.
+
+        Arguments:
+            lazy_parser: Parser that holds the raw register data.
+        """
+        self._lazy_parser = lazy_parser
+
     def append_register(self, name: str, mode: str, description: str) -> Register:
         """
         Append a register to this list.
@@ -105,7 +198,9 @@ class RegisterList:
 
         return register
 
-    def append_register_array(self, name: str, length: int, description: str) -> RegisterArray:
+    def append_register_array(
+        self, name: str, length: int, description: str, power_of_two_stride: bool = False
+    ) -> RegisterArray:
         """
         Append a register array to this list.
 
@@ -113,6 +208,9 @@ class RegisterList:
             name: The name of the register array.
             length: The number of times the register sequence shall be repeated.
             description: Textual description of the register array.
+            power_of_two_stride: Pad each repetition of the register sequence to a power of two
+                number of registers.
+                See :ref:`basic_feature_register_array_stride`.
         Return:
             The register array object that was created.
         """
@@ -121,7 +219,11 @@ class RegisterList:
         else:
             base_index = 0
         register_array = RegisterArray(
-            name=name, base_index=base_index, length=length, description=description
+            name=name,
+            base_index=base_index,
+            length=length,
+            description=description,
+            power_of_two_stride=power_of_two_stride,
         )
 
         self.register_objects.append(register_array)
@@ -132,14 +234,35 @@ class RegisterList:
         Get a register from this list. Will only find single registers, not registers in a
         register array. Will raise exception if no register matches.
 
+        If the register is a default register that is shared with other register lists,
+        see :meth:`.from_default_registers`, it is first replaced with a copy that belongs to this
+        register list.
+        Hence the register that is returned can always be modified.
+
         Arguments:
             name: The name of the register.
         Return:
             The register.
         """
-        for register_object in self.register_objects:
-            if isinstance(register_object, Register) and register_object.name == name:
-                return register_object
+        if self._lazy_parser is not None:
+            # All names are known by the parser, so there is no need to create all objects
+            # in order to search.
+            register = self._lazy_parser.parse_register(name=name)
+            if isinstance(register, FrozenRegister):
+                return self._lazy_parser.copy_default_register(name=name)
+
+            if register is not None:
+                return register
+        else:
+            register_objects = self.register_objects
+            for list_index, register_object in enumerate(register_objects):
+                if isinstance(register_object, Register) and register_object.name == name:
+                    if isinstance(register_object, FrozenRegister):
+                        # A deep copy of a frozen register is a regular register.
+                        register_object = copy.deepcopy(register_object)
+                        register_objects[list_index] = register_object
+
+                    return register_object
 
         raise ValueError(f'Could not find register "{name}" within register list "{self.name}"')
 
@@ -152,14 +275,38 @@ class RegisterList:
         Return:
             The register array.
         """
-        for register_object in self.register_objects:
-            if isinstance(register_object, RegisterArray) and register_object.name == name:
-                return register_object
+        if self._lazy_parser is not None:
+            register_array = self._lazy_parser.parse_register_array(name=name)
+            if register_array is not None:
+                return register_array
+        else:
+            for register_object in self.register_objects:
+                if isinstance(register_object, RegisterArray) and register_object.name == name:
+                    return register_object
 
         raise ValueError(
             f'Could not find register array "{name}" within register list "{self.name}"'
         )
 
+    def get_commit_registers(self) -> dict[str, Register]:
+        """
+        Get the commit register of each double-buffered plain register and register array in
+        this list.
+        See :ref:`basic_feature_double_buffered`.
+
+        Return:
+            Dictionary where the key is the name of a double-buffered plain register or
+            register array, and the value is the register that commits it.
+        """
+        result: dict[str, Register] = {}
+
+        for register_object in self.register_objects:
+            if isinstance(register_object, Register):
+                for name in register_object.commits:
+                    result.setdefault(name, register_object)
+
+        return result
+
     def get_register_index(
         self,
         register_name: str,
@@ -197,7 +344,7 @@ class RegisterList:
     def add_constant(
         self,
         name: str,
-        value: Union[bool, float, int, str, UnsignedVector],
+        value: Union[bool, float, int, str, UnsignedVector, list[int], list[float]],
         description: str,
     ) -> "Constant":
         """
@@ -229,6 +376,9 @@ class RegisterList:
         elif isinstance(value, str):
             constant = StringConstant(name=name, value=value, description=description)
 
+        elif isinstance(value, list):
+            constant = ArrayConstant(name=name, value=value, description=description)
+
         else:
             message = f'Error while parsing constant "{name}": Unknown type "{type(value)}".'
             raise TypeError(message)
@@ -236,6 +386,42 @@ class RegisterList:
         self.constants.append(constant)
         return constant
 
+    def add_register_pair(self, name: str, low: str, high: str, description: str) -> RegisterPair:
+        """
+        Add a pair of adjacent plain registers, that can be accessed as one 64-bit value.
+        See :ref:`basic_feature_register_pairs` for details.
+
+        Arguments:
+            name: The name of the register pair.
+            low: The name of the plain register that holds the lower 32 bits.
+            high: The name of the plain register that holds the upper 32 bits.
+                Must be located directly after the ``low`` register.
+            description: Textual description of the register pair.
+        Return:
+            The register pair object that was created.
+        """
+        register_pair = RegisterPair(name=name, low=low, high=high, description=description)
+        self.register_pairs.append(register_pair)
+
+        return register_pair
+
+    def add_programming_sequence(self, name: str, description: str) -> ProgrammingSequence:
+        """
+        Add a named sequence of register writes, polls and delays.
+        Steps are appended to the sequence object that is returned.
+        See :ref:`basic_feature_programming_sequences` for details.
+
+        Arguments:
+            name: The name of the programming sequence.
+            description: Textual description of the programming sequence.
+        Return:
+            The programming sequence object that was created.
+        """
+        programming_sequence = ProgrammingSequence(name=name, description=description)
+        self.programming_sequences.append(programming_sequence)
+
+        return programming_sequence
+
     def get_constant(self, name: str) -> "Constant":
         """
         Get a constant from this list. Will raise exception if no constant matches.
@@ -251,6 +437,14 @@ class RegisterList:
 
         raise ValueError(f'Could not find constant "{name}" within register list "{self.name}"')
 
+    def __getstate__(self) -> dict[str, Any]:
+        """
+        Create all register objects before e.g. pickling or copying,
+        so that the result does not reference the parser or the raw register data.
+        """
+        self.register_objects  # pylint: disable=pointless-statement
+        return self.__dict__
+
     @property
     def object_hash(self) -> str:
         """
@@ -258,13 +452,38 @@ class RegisterList:
         SHA1 is the fastest method according to e.g.
         http://atodorov.org/blog/2013/02/05/performance-test-md5-sha1-sha256-sha512/
         Result is a lowercase hexadecimal string.
+
+        The representation is hashed piece by piece, so that the full representation string of a
+        large register list is never held in memory.
+        The result is the same as hashing ``repr(self)``.
         """
-        return hashlib.sha1(repr(self).encode()).hexdigest()
+        hash_object = hashlib.sha1()
+        for part in self._repr_parts():
+            hash_object.update(part.encode())
 
-    def __repr__(self) -> str:
-        return f"""{self.__class__.__name__}(\
+        return hash_object.hexdigest()
+
+    def _repr_parts(self) -> Iterator[str]:
+        """
+        The object representation, split in one part for each object in the register list.
+        """
+
+        def join(objects: list[Any]) -> Iterator[str]:
+            for object_index, list_object in enumerate(objects):
+                yield f",{list_object!r}" if object_index else repr(list_object)
+
+        yield f"""{self.__class__.__name__}(\
 name={self.name},\
 source_definition_file={repr(self.source_definition_file)},\
-register_objects={','.join([repr(register_object) for register_object in self.register_objects])},\
-constants={','.join([repr(constant) for constant in self.constants])},\
-)"""
+register_objects="""
+        yield from join(self.register_objects)
+        yield ",constants="
+        yield from join(self.constants)
+        yield ",register_pairs="
+        yield from join(self.register_pairs)
+        yield ",programming_sequences="
+        yield from join(self.programming_sequences)
+        yield ",)"
+
+    def __repr__(self) -> str:
+        return "".join(self._repr_parts())
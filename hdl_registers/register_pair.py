@@ -0,0 +1,45 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+
+class RegisterPair:
+
+    """
+    Represent two adjacent plain registers that can be accessed as one 64-bit value.
+    On a 64-bit register bus, the generated software accessors access the pair in one bus
+    transaction, which is atomic.
+    On a 32-bit register bus, they make one bus transaction for each register, so the access is
+    not atomic.
+
+    The ``low`` register holds bits 31:0 of the value, and is located at the lower address.
+    The ``high`` register holds bits 63:32, and is located directly after the ``low`` register.
+    """
+
+    __slots__ = ("name", "low", "high", "description")
+
+    def __init__(self, name: str, low: str, high: str, description: str):
+        """
+        Arguments:
+            name: The name of this register pair.
+            low: The name of the plain register that holds the lower 32 bits.
+            high: The name of the plain register that holds the upper 32 bits.
+            description: Textual register pair description.
+        """
+        self.name = name
+        self.low = low
+        self.high = high
+        self.description = description
+
+    def __repr__(self) -> str:
+        return f"""{self.__class__.__name__}(\
+name={self.name},\
+low={self.low},\
+high={self.high},\
+description={self.description},\
+)"""
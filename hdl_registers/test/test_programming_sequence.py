@@ -0,0 +1,177 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# Third party libraries
+import pytest
+
+# First party libraries
+from hdl_registers.programming_sequence import (
+    ProgrammingSequence,
+    SequenceEntry,
+    SequenceOpcode,
+)
+from hdl_registers.register_list import RegisterList
+
+
+def get_register_list():
+    register_list = RegisterList(name="apa")
+
+    register = register_list.append_register(name="config", mode="r_w", description="")
+    register.append_bit(name="enable", description="", default_value="0")
+    register.append_enumeration(
+        name="direction",
+        description="",
+        elements={"up": "", "down": ""},
+        default_value="up",
+    )
+
+    register = register_list.append_register(name="command", mode="wpulse", description="")
+    register.append_bit(name="start", description="", default_value="0")
+    register.append_bit(name="flush", description="", default_value="1")
+
+    register = register_list.append_register(name="status", mode="r", description="")
+    register.append_bit(name="ready", description="", default_value="0")
+
+    register_array = register_list.append_register_array(name="channels", length=2, description="")
+    register_array.append_register(name="gain", mode="r_w", description="")
+
+    return register_list
+
+
+def entry(opcode, address, mask, value):
+    return (opcode, address, mask, value)
+
+
+def compile_sequence(programming_sequence):
+    return [
+        entry(
+            opcode=sequence_entry.opcode,
+            address=sequence_entry.address,
+            mask=sequence_entry.mask,
+            value=sequence_entry.value,
+        )
+        for sequence_entry in programming_sequence.compile(register_list=get_register_list())
+    ]
+
+
+def test_compile():
+    programming_sequence = ProgrammingSequence(name="initialize", description="")
+    programming_sequence.append_write(register="config", field="enable", value=1)
+    programming_sequence.append_write(register="command", field="start", value=1)
+    programming_sequence.append_wait(register="status", field="ready", value=1)
+    programming_sequence.append_delay(microseconds=100)
+    programming_sequence.append_write(
+        register="gain", register_array="channels", array_index=1, value=0xABCD
+    )
+    programming_sequence.append_wait(register="status", value=0)
+
+    assert compile_sequence(programming_sequence) == [
+        # Read-modify-write, since the register has other fields.
+        entry(SequenceOpcode.MODIFY, address=0, mask=0b1, value=0b1),
+        # Everything else at default, since the register can not be read back.
+        entry(SequenceOpcode.WRITE, address=4, mask=0xFFFFFFFF, value=0b11),
+        entry(SequenceOpcode.WAIT, address=8, mask=0b1, value=0b1),
+        entry(SequenceOpcode.DELAY, address=0, mask=0, value=100),
+        entry(SequenceOpcode.WRITE, address=16, mask=0xFFFFFFFF, value=0xABCD),
+        entry(SequenceOpcode.WAIT, address=8, mask=0xFFFFFFFF, value=0),
+    ]
+
+    sequence_entry = programming_sequence.compile(register_list=get_register_list())[0]
+    assert isinstance(sequence_entry, SequenceEntry)
+    assert sequence_entry.comment == "write config.enable = 1"
+
+
+def test_field_write_to_register_with_known_value_is_compiled_to_plain_write():
+    programming_sequence = ProgrammingSequence(name="initialize", description="")
+    programming_sequence.append_write(register="config", value=0b10)
+    programming_sequence.append_write(register="config", field="enable", value=1)
+    programming_sequence.append_write(register="config", field="direction", value="up")
+
+    assert compile_sequence(programming_sequence) == [
+        entry(SequenceOpcode.WRITE, address=0, mask=0xFFFFFFFF, value=0b10),
+        entry(SequenceOpcode.WRITE, address=0, mask=0xFFFFFFFF, value=0b11),
+        entry(SequenceOpcode.WRITE, address=0, mask=0xFFFFFFFF, value=0b01),
+    ]
+
+
+@pytest.mark.parametrize(
+    "append, message",
+    [
+        (
+            lambda sequence: sequence.append_write(register="status", value=1),
+            'step 0 (write status = 1): Can not write register in mode "r".',
+        ),
+        (
+            lambda sequence: sequence.append_wait(register="command", value=1),
+            'step 0 (wait command == 1): Can not wait for register in mode "wpulse".',
+        ),
+        (
+            lambda sequence: sequence.append_write(register="config", value=1 << 32),
+            "step 0 (write config = 4294967296): "
+            "Register value must be a 32-bit unsigned integer.",
+        ),
+        (
+            lambda sequence: sequence.append_write(register="config", field="enable", value=2),
+            "step 0 (write config.enable = 2): Value: 2 out of range of 1-bit (0, 1).",
+        ),
+        (
+            lambda sequence: sequence.append_write(
+                register="config", field="direction", value="left"
+            ),
+            'step 0 (write config.direction = left): Enumeration "direction", requested '
+            'element name does not exist. Got: "left".',
+        ),
+        (
+            lambda sequence: sequence.append_write(register="gain", value=1),
+            'step 0 (write gain = 1): Could not find register "gain" within register list "apa"',
+        ),
+        (
+            lambda sequence: sequence.append_write(
+                register="gain", register_array="channels", value=1
+            ),
+            "step 0 (write channels[None].gain = 1): "
+            "No array index given for a register in an array.",
+        ),
+        (
+            lambda sequence: sequence.append_write(
+                register="gain", register_array="channels", array_index=2, value=1
+            ),
+            "step 0 (write channels[2].gain = 1): "
+            'Index 2 out of range for register array "channels" of length 2.',
+        ),
+        (
+            lambda sequence: sequence.append_delay(microseconds=-1),
+            "step 0 (delay -1 us): Delay must be a non-negative integer number of microseconds.",
+        ),
+    ],
+)
+def test_compile_invalid_step_should_raise_exception(append, message):
+    programming_sequence = ProgrammingSequence(name="initialize", description="")
+    append(programming_sequence)
+
+    with pytest.raises(ValueError) as exception_info:
+        programming_sequence.compile(register_list=get_register_list())
+    assert str(exception_info.value) == f'Programming sequence "initialize" {message}'
+
+
+def test_repr():
+    def get_sequence(value=1, description=""):
+        programming_sequence = ProgrammingSequence(name="apa", description=description)
+        programming_sequence.append_write(register="config", field="enable", value=value)
+        return programming_sequence
+
+    # Check that repr is an actual representation, not just "X object at 0xABCDEF"
+    assert "apa" in repr(get_sequence())
+    assert repr(get_sequence()) == repr(get_sequence())
+
+    # Different step
+    assert repr(get_sequence()) != repr(get_sequence(value=0))
+
+    # Different description
+    assert repr(get_sequence()) != repr(get_sequence(description="hest"))
@@ -11,6 +11,7 @@
 import pytest
 
 # First party libraries
+from hdl_registers.field.register_field_type import SignedFixedPoint
 from hdl_registers.register import Register
 
 
@@ -38,6 +39,16 @@ def test_repr_basic():
         Register(name="apa", index=0, mode="r", description="Gah")
     )
 
+    # Different commits
+    register = Register(name="apa", index=0, mode="wpulse", description="")
+    register.commits = ["hest"]
+    assert repr(register) != repr(Register(name="apa", index=0, mode="wpulse", description=""))
+
+    # Different static
+    register = Register(name="apa", index=0, mode="r", description="")
+    register.static = True
+    assert repr(register) != repr(Register(name="apa", index=0, mode="r", description=""))
+
 
 def test_repr_with_bits_appended():
     """
@@ -177,3 +188,32 @@ def test_get_field():
     with pytest.raises(ValueError) as exception_info:
         assert register.get_field("non existing") is None
     assert str(exception_info.value) == 'Could not find field "non existing" within register "apa"'
+
+
+def test_get_field_values():
+    numpy = pytest.importorskip("numpy")
+
+    register = Register(name="apa", index=0, mode="r", description="")
+    register.append_bit(name="a", description="", default_value="0")
+    register.append_integer(name="b", description="", min_value=-8, max_value=7, default_value=0)
+    register.append_bit_vector(
+        name="c",
+        description="",
+        width=4,
+        default_value="0000",
+        field_type=SignedFixedPoint(max_bit_index=1, min_bit_index=-2),
+    )
+
+    register_values = numpy.array(
+        [0b1_1110_1011, 0b0_0011_0100, 0b1_0000_1111, 0b0_0000_0000], dtype=numpy.uint32
+    ).reshape(2, 2)
+    field_values = register.get_field_values(register_values)
+
+    assert field_values.shape == (2, 2)
+    assert field_values.dtype.names == ("a", "b", "c")
+
+    for register_value, field_value in zip(register_values.flat, field_values.flat):
+        for field in register.fields:
+            assert field_value[field.name] == field.get_value(int(register_value))
+
+    assert field_values["c"].tolist() == [[-0.25, 0.25], [-2.0, 0.0]]
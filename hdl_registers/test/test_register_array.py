@@ -67,6 +67,11 @@ def test_repr_basic():
         RegisterArray(name="apa", base_index=0, length=4, description="zebra")
     )
 
+    # Different stride
+    assert repr(RegisterArray(name="apa", base_index=0, length=4, description="")) != repr(
+        RegisterArray(name="apa", base_index=0, length=4, description="", power_of_two_stride=True)
+    )
+
 
 def test_repr_with_registers_appended():
     register_array_a = RegisterArray(name="apa", base_index=0, length=4, description="")
@@ -108,6 +113,42 @@ def test_start_index():
     assert register_array.get_start_index(2) == 14
 
 
+def test_power_of_two_stride():
+    register_array = RegisterArray(
+        name="apa", base_index=10, length=4, description="", power_of_two_stride=True
+    )
+    register_array.append_register(name="hest", mode="r", description="")
+    assert register_array.stride == 1
+    assert register_array.num_padding_registers == 0
+    assert register_array.base_index == 10
+
+    register_array.append_register(name="zebra", mode="r", description="")
+    register_array.append_register(name="bamse", mode="r", description="")
+    assert register_array.stride == 4
+    assert register_array.num_padding_registers == 4
+    # Base index is aligned to the stride.
+    assert register_array.base_index == 12
+    assert register_array.num_alignment_registers == 2
+    assert register_array.index == 27
+    assert register_array.get_start_index(0) == 12
+    assert register_array.get_start_index(1) == 16
+    assert register_array.get_start_index(3) == 24
+
+    for _ in range(2):
+        register_array.append_register(name="", mode="r", description="")
+    assert register_array.stride == 8
+    assert register_array.num_padding_registers == 12
+    assert register_array.base_index == 16
+    assert register_array.num_alignment_registers == 6
+
+    register_array.power_of_two_stride = False
+    assert register_array.stride == 5
+    assert register_array.num_padding_registers == 0
+    assert register_array.base_index == 10
+    assert register_array.num_alignment_registers == 0
+    assert register_array.index == 29
+
+
 def test_start_index_with_argument_outside_of_length_should_raise_exception():
     register_array = RegisterArray(name="apa", base_index=0, length=4, description="")
     register_array.append_register(name="hest", mode="r", description="")
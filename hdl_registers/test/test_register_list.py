@@ -9,13 +9,16 @@
 
 # Standard libraries
 import copy
+import hashlib
+import pickle
 from pathlib import Path
 
 # Third party libraries
 import pytest
 
 # First party libraries
-from hdl_registers.register import Register
+from hdl_registers.constant.array_constant import ArrayConstant
+from hdl_registers.register import FrozenRegister, Register
 from hdl_registers.register_list import RegisterList
 
 
@@ -38,6 +41,145 @@ def test_from_default_registers():
     assert register_list.get_register("b").name == "b"
 
 
+def test_from_default_registers_shared():
+    register_a = Register(name="a", index=0, mode="r", description="AA")
+    register_b = Register(name="b", index=1, mode="w", description="BB")
+    default_registers = [register_a, register_b]
+
+    register_list = RegisterList.from_default_registers(
+        name="apa",
+        source_definition_file=None,
+        default_registers=default_registers,
+        share_registers=True,
+    )
+    other_register_list = RegisterList.from_default_registers(
+        name="apa",
+        source_definition_file=None,
+        default_registers=default_registers,
+        share_registers=True,
+    )
+
+    # The register objects are frozen copies, shared between the register lists.
+    shared_register_a = register_list.register_objects[0]
+    assert isinstance(shared_register_a, FrozenRegister)
+    assert shared_register_a is not register_a
+    assert other_register_list.register_objects[0] is shared_register_a
+
+    # Changing the default registers afterwards does not affect the register lists.
+    default_registers.append(Register(name="c", index=2, mode="r_w", description="CC"))
+    register_a.mode = "w"
+    assert len(register_list.register_objects) == 2
+    assert shared_register_a.mode == "r"
+
+    # Getting a register replaces it with a copy that can be modified.
+    register_list.get_register("a").append_bit(name="x", description="", default_value="0")
+    register_list.get_register("b").description = "XX"
+
+    assert not isinstance(register_list.register_objects[0], FrozenRegister)
+    assert register_list.get_register("a") is register_list.register_objects[0]
+    assert len(register_list.get_register("a").fields) == 1
+    assert register_list.get_register("b").description == "XX"
+
+    assert other_register_list.register_objects[0] is shared_register_a
+    assert not shared_register_a.fields
+    assert other_register_list.register_objects[1].description == "BB"
+
+
+def test_from_default_registers_shared_with_different_content_are_not_shared():
+    def get_register_list(description):
+        return RegisterList.from_default_registers(
+            name="apa",
+            source_definition_file=None,
+            default_registers=[Register(name="a", index=0, mode="r", description=description)],
+            share_registers=True,
+        )
+
+    register_list = get_register_list(description="AA")
+    assert get_register_list(description="AA").register_objects[0] is (
+        register_list.register_objects[0]
+    )
+
+    other_register_list = get_register_list(description="BB")
+    assert other_register_list.register_objects[0] is not register_list.register_objects[0]
+    assert other_register_list.register_objects[0].description == "BB"
+    assert register_list.register_objects[0].description == "AA"
+
+
+def test_modifying_shared_default_register_should_raise_exception():
+    register_list = RegisterList.from_default_registers(
+        name="apa",
+        source_definition_file=None,
+        default_registers=[Register(name="a", index=0, mode="r", description="")],
+        share_registers=True,
+    )
+    shared_register = register_list.register_objects[0]
+
+    expected = (
+        'Register "a" is a default register that is shared with other register lists, and can '
+        "not be modified. Use 'RegisterList.get_register' to get a copy that can be modified."
+    )
+
+    with pytest.raises(AttributeError) as exception_info:
+        shared_register.description = "apa"
+    assert str(exception_info.value) == expected
+
+    with pytest.raises(AttributeError) as exception_info:
+        shared_register.append_bit(name="x", description="", default_value="0")
+    assert str(exception_info.value) == expected
+
+    with pytest.raises(AttributeError):
+        shared_register.fields.append(None)
+
+    assert shared_register.description == ""
+    assert not shared_register.fields
+
+
+def test_copy_and_pickle_of_register_list_with_shared_default_registers():
+    register = Register(name="a", index=0, mode="r_w", description="AA")
+    register.append_bit(name="x", description="", default_value="1")
+    register.commits = ["b"]
+
+    register_list = RegisterList.from_default_registers(
+        name="apa", source_definition_file=None, default_registers=[register], share_registers=True
+    )
+
+    # A deep copy belongs to the new register list only, and can be modified.
+    register_list_copy = copy.deepcopy(register_list)
+    register_copy = register_list_copy.register_objects[0]
+    assert type(register_copy) is Register
+    register_copy.append_bit(name="y", description="", default_value="0")
+    register_copy.commits.append("c")
+    assert repr(register_list.register_objects[0]) == repr(register)
+
+    # Pickling keeps the register frozen.
+    register_list_pickled = pickle.loads(pickle.dumps(register_list))
+    assert isinstance(register_list_pickled.register_objects[0], FrozenRegister)
+    assert register_list_pickled.object_hash == register_list.object_hash
+
+
+def test_shared_default_registers_give_same_hash_as_copies():
+    def get_default_registers():
+        register = Register(name="a", index=0, mode="r_w", description="AA")
+        register.append_bit(name="x", description="", default_value="1")
+        return [register, Register(name="b", index=1, mode="w", description="BB")]
+
+    register_list = RegisterList.from_default_registers(
+        name="apa",
+        source_definition_file=None,
+        default_registers=get_default_registers(),
+        share_registers=True,
+    )
+    register_list.append_register(name="c", mode="r", description="")
+
+    copied_register_list = RegisterList.from_default_registers(
+        name="apa", source_definition_file=None, default_registers=get_default_registers()
+    )
+    copied_register_list.append_register(name="c", mode="r", description="")
+
+    assert repr(register_list) == repr(copied_register_list)
+    assert register_list.object_hash == copied_register_list.object_hash
+
+
 def test_from_default_registers_with_bad_indexes_should_raise_exception():
     register_a = Register(name="a", index=0, mode="r", description="")
     register_b = Register(name="b", index=0, mode="w", description="")
@@ -74,6 +216,17 @@ def test_header_constants():
     assert registers.get_constant("zebra").value == -5
 
 
+def test_array_constant():
+    registers = RegisterList(name="apa", source_definition_file=None)
+    hest = registers.add_constant("hest", [1, 2, 3], "")
+    zebra = registers.add_constant("zebra", [0.5, 1.5], "")
+
+    assert isinstance(hest, ArrayConstant)
+    assert hest.element_type is int
+    assert isinstance(zebra, ArrayConstant)
+    assert zebra.element_type is float
+
+
 def test_invalid_register_mode_should_raise_exception():
     registers = RegisterList(None, None)
     registers.append_register(name="test", mode="r_w", description="")
@@ -219,6 +372,35 @@ def test_repr_with_constant_added():
     assert repr(register_list_a) != repr(register_list_b)
 
 
+def test_repr_with_register_pair_added():
+    register_list_a = RegisterList(name="apa", source_definition_file=Path("."))
+    register_list_b = RegisterList(name="apa", source_definition_file=Path("."))
+
+    register_pair = register_list_a.add_register_pair(
+        name="zebra", low="low", high="high", description=""
+    )
+    assert register_list_a.register_pairs == [register_pair]
+
+    assert repr(register_list_a) != repr(register_list_b)
+
+
+def test_repr_with_programming_sequence_added():
+    register_list_a = RegisterList(name="apa", source_definition_file=Path("."))
+    register_list_b = RegisterList(name="apa", source_definition_file=Path("."))
+
+    programming_sequence = register_list_a.add_programming_sequence(
+        name="initialize", description=""
+    )
+    assert register_list_a.programming_sequences == [programming_sequence]
+    assert repr(register_list_a) != repr(register_list_b)
+
+    register_list_b.add_programming_sequence(name="initialize", description="")
+    assert repr(register_list_a) == repr(register_list_b)
+
+    programming_sequence.append_delay(microseconds=10)
+    assert repr(register_list_a) != repr(register_list_b)
+
+
 def test_repr_with_register_appended():
     register_list_a = RegisterList(name="apa", source_definition_file=Path("."))
     register_list_b = RegisterList(name="apa", source_definition_file=Path("."))
@@ -239,6 +421,39 @@ def test_repr_with_register_array_appended():
     assert repr(register_list_a) != repr(register_list_b)
 
 
+def test_object_hash_is_hash_of_repr():
+    register_list = RegisterList(name="apa", source_definition_file=Path("."))
+    register_list.add_constant(name="hest", value=3, description="")
+    register_list.append_register(name="zebra", mode="w", description="").append_bit(
+        name="bit", description="", default_value="0"
+    )
+    register_list.append_register_array(name="bamse", length=4, description="").append_register(
+        name="gorilla", mode="r", description=""
+    )
+
+    assert register_list.object_hash == hashlib.sha1(repr(register_list).encode()).hexdigest()
+
+
+def test_register_objects_are_slotted_and_can_be_pickled():
+    register_list = RegisterList(name="apa", source_definition_file=Path("."))
+    register = register_list.append_register(name="zebra", mode="r_w", description="")
+    register.append_enumeration(
+        name="enum", description="", elements={"a": "", "b": ""}, default_value="b"
+    )
+    register_list.add_constant(name="hest", value=3, description="")
+
+    for model_object in [
+        register,
+        register.fields[0],
+        register.fields[0].elements[0],
+        register_list.constants[0],
+    ]:
+        assert not hasattr(model_object, "__dict__")
+
+    restored = pickle.loads(pickle.dumps(register_list))
+    assert repr(restored) == repr(register_list)
+
+
 def test_deep_copy_of_register_list_actually_copies_everything():
     original_list = RegisterList("original", Path("/original_file.txt"))
     original_list.add_constant("original_constant", value=2, description="original constant")
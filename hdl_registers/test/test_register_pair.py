@@ -0,0 +1,32 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+# First party libraries
+from hdl_registers.register_pair import RegisterPair
+
+
+def test_repr():
+    def create(name="apa", low="hest", high="zebra", description=""):
+        return RegisterPair(name=name, low=low, high=high, description=description)
+
+    # Check that repr is an actual representation, not just "X object at 0xABCDEF"
+    assert "apa" in repr(create())
+    assert repr(create()) == repr(create())
+
+    # Different name
+    assert repr(create()) != repr(create(name="bepa"))
+
+    # Different low register
+    assert repr(create()) != repr(create(low="bepa"))
+
+    # Different high register
+    assert repr(create()) != repr(create(high="bepa"))
+
+    # Different description
+    assert repr(create()) != repr(create(description="bepa"))
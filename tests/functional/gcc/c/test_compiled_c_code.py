@@ -16,13 +16,26 @@ from tsfpga.system_utils import create_file, run_command
 
 # First party libraries
 from hdl_registers.generator.c.header import CHeaderGenerator
+from hdl_registers.generator.c.register_map_rom import CRegisterMapRomGenerator
+from hdl_registers.generator.register_map_rom import RegisterMapRom
 from tests.functional.gcc.compile_and_run_test import CompileAndRunTest
 
 THIS_DIR = Path(__file__).parent.resolve()
 
 
 class CTest(CompileAndRunTest):
-    def compile_and_run(self, test_constants, test_registers):
+    def compile_and_run(
+        self,
+        test_constants,
+        test_registers,
+        test_code="",
+        num_registers=None,
+        test_functions="",
+        defines=None,
+    ):
+        num_registers = 21 * test_registers if num_registers is None else num_registers
+        defines = [] if defines is None else defines
+
         CHeaderGenerator(self.register_list, self.include_dir).create()
 
         main_file = self.working_dir / "main.c"
@@ -35,7 +48,7 @@ class CTest(CompileAndRunTest):
             f"-I{THIS_DIR / 'include'}",
             f"-I{self.include_dir}",
             str(main_file),
-        ]
+        ] + [f"-D{define}" for define in defines]
 
         tests = ["test_constants"] if test_constants else []
         tests += ["test_registers"] if test_registers else []
@@ -53,12 +66,16 @@ class CTest(CompileAndRunTest):
 
 {includes}
 
+{test_functions}
+
 int main()
 {{
-  assert(CAESAR_NUM_REGS == {21 * test_registers});
+  assert(CAESAR_NUM_REGS == {num_registers});
 
 {main_function}
 
+{test_code}
+
   return 0;
 }}
 """
@@ -90,3 +107,224 @@ def test_c_header_with_only_registers(c_test):
 def test_c_header_with_only_constants(c_test):
     c_test.register_list.register_objects = []
     c_test.compile_and_run(test_registers=False, test_constants=True)
+
+
+def test_c_header_commit_of_double_buffered_registers(c_test):
+    register = c_test.register_list.get_register("command")
+    register.commits = ["config", "address"]
+
+    test_code = f"""\
+  caesar_regs_t regs;
+  regs.command = 1337;
+
+  CAESAR_COMMAND_COMMIT(&regs);
+  assert(regs.command == {register.default_value});
+"""
+    c_test.compile_and_run(test_registers=True, test_constants=False, test_code=test_code)
+
+
+def test_c_header_register_pairs(c_test):
+    c_test.register_list.add_register_pair(
+        name="flags", low="irq_status", high="status", description=""
+    )
+    c_test.register_list.add_register_pair(
+        name="control", low="config", high="command", description=""
+    )
+
+    test_code = """\
+  assert(CAESAR_FLAGS_INDEX == 2);
+  assert(CAESAR_FLAGS_ADDR == 8);
+  assert(CAESAR_CONTROL_ADDR == 0);
+
+  caesar_regs_t regs;
+  regs.irq_status = 0x11111111;
+  regs.status = 0x22222222;
+  assert(caesar_flags_get(&regs) == 0x2222222211111111uLL);
+
+  caesar_control_set(&regs, 0x0000000500000003uLL);
+  assert(regs.config == 3);
+  assert(regs.command == 5);
+"""
+    c_test.compile_and_run(test_registers=True, test_constants=False, test_code=test_code)
+
+
+def test_c_header_register_pairs_with_64_bit_data_width(c_test):
+    c_test.register_list.add_register_pair(
+        name="flags", low="irq_status", high="status", description=""
+    )
+    c_test.register_list.add_register_pair(
+        name="control", low="config", high="command", description=""
+    )
+
+    test_code = """\
+  assert(FPGA_REGS_DATA_WIDTH == 64);
+
+  // Aligned like the base address of a register map on a 64-bit register bus.
+  _Alignas(8) caesar_regs_t regs;
+  regs.irq_status = 0x11111111;
+  regs.status = 0x22222222;
+  assert(caesar_flags_get(&regs) == 0x2222222211111111uLL);
+
+  caesar_control_set(&regs, 0x0000000500000003uLL);
+  assert(regs.config == 3);
+  assert(regs.command == 5);
+"""
+    c_test.compile_and_run(
+        test_registers=True,
+        test_constants=False,
+        test_code=test_code,
+        defines=["FPGA_REGS_DATA_WIDTH=64"],
+    )
+
+
+def test_c_header_register_array_with_power_of_two_stride(c_test):
+    register_array = c_test.register_list.append_register_array(
+        name="channels", length=3, description="", power_of_two_stride=True
+    )
+    register_array.append_register(name="gain", mode="r_w", description="")
+    register_array.append_register(name="offset", mode="r_w", description="")
+    register_array.append_register(name="status", mode="r", description="")
+
+    test_code = """\
+  // Base index 21 is aligned up to the stride.
+  assert(CAESAR_CHANNELS_GAIN_INDEX(0) == 24);
+  assert(CAESAR_CHANNELS_GAIN_INDEX(1) == 28);
+  assert(CAESAR_CHANNELS_STATUS_INDEX(2) == 34);
+  assert(sizeof(caesar_channels_t) == 4 * 4);
+
+  caesar_regs_t regs;
+  volatile uint32_t *memory = (volatile uint32_t *)&regs;
+  regs.channels[2].status = 7;
+  assert(memory[CAESAR_CHANNELS_STATUS_INDEX(2)] == 7);
+"""
+    # The register test assumes that "dummies4" is the last register array, so it is not run.
+    c_test.compile_and_run(
+        test_registers=False, test_constants=False, test_code=test_code, num_registers=36
+    )
+
+
+def test_c_header_programming_sequence(c_test):
+    programming_sequence = c_test.register_list.add_programming_sequence(
+        name="initialize", description=""
+    )
+    programming_sequence.append_write(register="config", field="plain_bit_a", value=1)
+    programming_sequence.append_wait(register="status", field="a", value=1)
+    programming_sequence.append_delay(microseconds=5)
+    programming_sequence.append_write(register="address", value=0x1234)
+
+    test_functions = """\
+static uint32_t total_delay_us = 0;
+
+static void delay_us(uint32_t microseconds)
+{
+  total_delay_us += microseconds;
+}
+"""
+    test_code = """\
+  assert(CAESAR_INITIALIZE_SEQUENCE_LENGTH == 4);
+  assert(CAESAR_INITIALIZE_SEQUENCE[0].opcode == CAESAR_SEQUENCE_MODIFY);
+
+  caesar_regs_t regs;
+  volatile uint32_t *memory = (volatile uint32_t *)&regs;
+  regs.config = 0xF0;
+  regs.status = 0;
+
+  // Times out, since the status bit is never set.
+  assert(caesar_run_sequence(
+    memory, CAESAR_INITIALIZE_SEQUENCE, CAESAR_INITIALIZE_SEQUENCE_LENGTH, delay_us, 3) == 1);
+  assert(regs.config == 0xF1);
+  assert(total_delay_us == 0);
+
+  regs.status = 3;
+  assert(caesar_run_sequence(
+    memory, CAESAR_INITIALIZE_SEQUENCE, CAESAR_INITIALIZE_SEQUENCE_LENGTH, delay_us, 3) == 0);
+  assert(total_delay_us == 5);
+  assert(regs.address == 0x1234);
+"""
+    c_test.compile_and_run(
+        test_registers=True,
+        test_constants=False,
+        test_code=test_code,
+        test_functions=test_functions,
+    )
+
+
+def test_c_header_register_map_rom(c_test):
+    CRegisterMapRomGenerator(c_test.register_list, c_test.include_dir).create()
+
+    words = RegisterMapRom(register_list=c_test.register_list).get_words()
+    rom_words = ", ".join(f"0x{word:08X}u" for word in words)
+
+    # The ROM content as it would be read from the FPGA, into writeable memory so that
+    # the test can corrupt it.
+    test_functions = f"""\
+#include <string.h>
+
+#include "caesar_register_map_rom.h"
+
+static uint32_t rom[{len(words)}] = {{{rom_words}}};
+"""
+    config_default_value = c_test.register_list.get_register(name="config").default_value
+    test_code = f"""\
+  assert(caesar_register_map_rom_check(rom, CAESAR_REGISTER_MAP_ROM_NUM_WORDS)
+    == CAESAR_REGISTER_MAP_ROM_OK);
+  assert(caesar_register_map_rom_num_registers(rom) == 14);
+
+  caesar_register_map_rom_register_t reg;
+  caesar_register_map_rom_field_t field;
+
+  int32_t register_index = caesar_register_map_rom_find_register(rom, "config", NULL);
+  assert(register_index == 0);
+  caesar_register_map_rom_get_register(rom, register_index, &reg);
+  assert(reg.index == CAESAR_CONFIG_INDEX);
+  assert(reg.mode == CAESAR_REGISTER_MAP_ROM_MODE_R_W);
+  assert(reg.num_fields == 5);
+  assert(reg.array_length == 0);
+  assert(strcmp(reg.array_name, "") == 0);
+  assert(reg.default_value == {config_default_value});
+
+  int32_t field_index = caesar_register_map_rom_find_field(rom, &reg, "plain_enumeration");
+  assert(field_index >= 0);
+  caesar_register_map_rom_get_field(rom, field_index, &field);
+  assert(field.base_index == CAESAR_CONFIG_PLAIN_ENUMERATION_SHIFT);
+  assert(field.width == 3);
+  assert(field.type == CAESAR_REGISTER_MAP_ROM_FIELD_TYPE_ENUMERATION);
+  assert(field.data[1] == 5);
+  assert(strcmp(caesar_register_map_rom_get_element_name(rom, field.data[0] + 2), "third") == 0);
+
+  field_index = caesar_register_map_rom_find_field(rom, &reg, "plain_integer");
+  caesar_register_map_rom_get_field(rom, field_index, &field);
+  assert(field.type == CAESAR_REGISTER_MAP_ROM_FIELD_TYPE_INTEGER);
+  assert((int32_t)field.data[0] == -50);
+  assert((int32_t)field.data[1] == 100);
+
+  assert(caesar_register_map_rom_find_field(rom, &reg, "non_existent") == -1);
+
+  register_index = caesar_register_map_rom_find_register(rom, "second", "dummies");
+  caesar_register_map_rom_get_register(rom, register_index, &reg);
+  assert(reg.index == CAESAR_DUMMIES_SECOND_INDEX(0));
+  assert(reg.array_length == 3);
+  assert(reg.array_stride == 2);
+
+  assert(caesar_register_map_rom_find_register(rom, "second", NULL) == -1);
+
+  // Too few words read.
+  assert(caesar_register_map_rom_check(rom, 15) == CAESAR_REGISTER_MAP_ROM_INVALID);
+
+  // A FPGA build with another register map.
+  rom[3] ^= 1;
+  assert(caesar_register_map_rom_check(rom, CAESAR_REGISTER_MAP_ROM_NUM_WORDS)
+    == CAESAR_REGISTER_MAP_ROM_HASH_MISMATCH);
+
+  // Nothing at the address of the ROM.
+  memset(rom, 0, sizeof(rom));
+  assert(caesar_register_map_rom_check(rom, CAESAR_REGISTER_MAP_ROM_NUM_WORDS)
+    == CAESAR_REGISTER_MAP_ROM_INVALID);
+"""
+    c_test.compile_and_run(
+        test_registers=False,
+        test_constants=False,
+        test_code=test_code,
+        test_functions=test_functions,
+        num_registers=21,
+    )
@@ -21,6 +21,14 @@ void test_constants()
   assert(CAESAR_RATE == 3.5);
   assert(CAESAR_RATE != 3.6);
 
+  assert(CAESAR_COEFFICIENTS_LENGTH == 4);
+  assert(sizeof(CAESAR_COEFFICIENTS) / sizeof(CAESAR_COEFFICIENTS[0]) == 4);
+  assert(CAESAR_COEFFICIENTS[0] == 3);
+  assert(CAESAR_COEFFICIENTS[1] == -1);
+  assert(CAESAR_COEFFICIENTS[3] == 7);
+  assert(CAESAR_CALIBRATION_LENGTH == 2);
+  assert(CAESAR_CALIBRATION[1] == -1.25);
+
   assert(CAESAR_PARAGRAPH == "hello there :)");
   assert(CAESAR_PARAGRAPH != "-");
 
@@ -16,9 +16,15 @@ import pytest
 from tsfpga.system_utils import create_file, run_command
 
 # First party libraries
+from hdl_registers.generator.c.register_map_rom import CRegisterMapRomGenerator
 from hdl_registers.generator.cpp.header import CppHeaderGenerator
 from hdl_registers.generator.cpp.implementation import CppImplementationGenerator
 from hdl_registers.generator.cpp.interface import CppInterfaceGenerator
+from hdl_registers.generator.cpp.system_map import CppSystemMapGenerator
+from hdl_registers.generator.cpp.trace import CppTraceGenerator
+from hdl_registers.generator.cpp.trace_replay import Trace, TraceReplay
+from hdl_registers.generator.register_map_rom import RegisterMapRom
+from hdl_registers.generator.system_code_generator import RegisterListInstance
 from tests.functional.gcc.compile_and_run_test import CompileAndRunTest
 
 THIS_DIR = Path(__file__).parent.resolve()
@@ -37,7 +43,8 @@ class BaseCppTest(CompileAndRunTest):
 
 int main()
 {{
-  uint32_t memory[fpga_regs::Caesar::num_registers];
+  // Aligned like the base address of a register map on a 64-bit register bus.
+  alignas(8) uint32_t memory[fpga_regs::Caesar::num_registers];
   volatile uint8_t *base_address = reinterpret_cast<volatile uint8_t *>(memory);
   fpga_regs::Caesar caesar = fpga_regs::Caesar(base_address);
 
@@ -47,9 +54,19 @@ int main()
 }}
 """
 
-    def compile(self, test_code, include_directories=None, source_files=None, includes=""):
+    def compile(
+        self,
+        test_code,
+        include_directories=None,
+        source_files=None,
+        includes="",
+        defines=None,
+        compile_flags=None,
+    ):
         include_directories = [] if include_directories is None else include_directories
         source_files = [] if source_files is None else source_files
+        defines = [] if defines is None else defines
+        compile_flags = [] if compile_flags is None else compile_flags
 
         CppInterfaceGenerator(self.register_list, self.include_dir).create()
         CppHeaderGenerator(self.register_list, self.include_dir).create()
@@ -69,6 +86,8 @@ int main()
                 cpp_class_file,
             ]
             + [f"-I{path}" for path in include_directories]
+            + [f"-D{define}" for define in defines]
+            + compile_flags
             + source_files
         )
 
@@ -215,3 +234,392 @@ def test_setting_cpp_bit_vector_field_out_of_range_should_crash(base_cpp_test):
         assert (
             "Assertion `field_value & mask_at_base_inverse == 0' failed." in result.stderr
         ), result.stderr
+
+
+def test_cpp_system_map(tmp_path):
+    test = BaseCppTest(tmp_path=tmp_path)
+
+    CppSystemMapGenerator(
+        name="soc",
+        register_lists=[
+            RegisterListInstance(register_list=test.register_list, base_address=0x4000_1000),
+            RegisterListInstance(
+                register_list=test.register_list, base_address=0x4000_0000, name="caesar_0"
+            ),
+        ],
+        output_folder=test.include_dir,
+    ).create()
+
+    test_code = """\
+  static_assert(fpga_regs::soc::base_address == 0x40000000uLL, "");
+  static_assert(fpga_regs::soc::mapping_size == 0x1000uL + 4 * fpga_regs::Caesar::num_registers,
+                "");
+  static_assert(fpga_regs::soc::caesar::offset == 0x1000uL, "");
+  static_assert(fpga_regs::soc::caesar::address::config == 0x40001000uLL, "");
+  static_assert(fpga_regs::soc::caesar_0::address::tuser == 0x40000018uLL, "");
+  static_assert(fpga_regs::soc::caesar::address::dummies_second(1) == 0x40001028uLL, "");
+
+  uint32_t system_memory[fpga_regs::soc::mapping_size / 4] = {};
+  fpga_regs::Soc soc(reinterpret_cast<volatile uint8_t *>(system_memory));
+
+  soc.caesar_0.set_config(3);
+  soc.caesar.set_dummies_first(1, 5);
+
+  assert(system_memory[0] == 3);
+  assert(system_memory[(0x1000 + 0x24) / 4] == 5);
+  assert(soc.caesar.get_dummies_first(1) == 5);
+"""
+    cmd = test.compile(test_code=test_code, includes='#include "include/soc.h"')
+    run_command(cmd)
+
+
+def test_cpp_trace(tmp_path):
+    test = BaseCppTest(tmp_path=tmp_path)
+    CppTraceGenerator(output_folder=test.include_dir).create()
+
+    trace_file = tmp_path / "trace.bin"
+    test_code = f"""\
+  // Not recorded, since trace is not started.
+  caesar.set_config(1);
+
+  fpga_regs::trace::start(base_address);
+  caesar.set_config(3);
+  caesar.set_config(3);
+  assert(caesar.get_config() == 3);
+  caesar.set_dummies_first(1, 5);
+  fpga_regs::trace::stop();
+
+  // Not recorded, since trace is stopped.
+  caesar.set_config(4);
+
+  assert(fpga_regs::trace::num_recorded() == 4);
+  assert(memory[0] == 4);
+  assert(fpga_regs::trace::save("{trace_file}"));
+"""
+    cmd = test.compile(
+        test_code=test_code,
+        includes='#include "include/fpga_regs_trace.h"',
+        defines=["FPGA_REGS_TRACE"],
+    )
+    run_command(cmd)
+
+    trace = Trace.from_file(trace_file)
+    assert trace.num_recorded == 4
+    assert trace.num_overwritten == 0
+
+    dummies_first_index = test.register_list.get_register_index(
+        register_name="first", register_array_name="dummies", register_array_index=1
+    )
+    assert [(entry.offset, entry.value, entry.is_write) for entry in trace.entries] == [
+        (0, 3, True),
+        (0, 3, True),
+        (0, 3, False),
+        (4 * dummies_first_index, 5, True),
+    ]
+    assert {entry.thread for entry in trace.entries} == {0}
+    timestamps = [entry.timestamp_ns for entry in trace.entries]
+    assert timestamps == sorted(timestamps)
+
+    replay = TraceReplay(
+        register_lists=[RegisterListInstance(register_list=test.register_list, base_address=0)]
+    )
+    redundant_accesses = replay.find_redundant_accesses(trace=trace)
+    assert [
+        (redundant_access.register_name, redundant_access.reason)
+        for redundant_access in redundant_accesses
+    ] == [
+        ("caesar.config", "Write of unchanged value"),
+        ("caesar.config", "Read of already known value"),
+    ]
+
+    memory = bytearray(replay.size)
+    timing = replay.replay(trace=trace, mapping=memory)
+    assert timing.num_accesses == 4
+    assert memory[0] == 3
+    assert memory[4 * dummies_first_index] == 5
+
+
+def test_cpp_without_trace_define_does_not_need_trace_header(base_cpp_test):
+    cmd = base_cpp_test.compile(test_code="caesar.set_config(3);")
+    run_command(cmd)
+
+    assert not (base_cpp_test.include_dir / "fpga_regs_trace.h").exists()
+
+
+def test_cpp_ordered_accessors_and_register_batch(tmp_path):
+    test = BaseCppTest(tmp_path=tmp_path)
+
+    # Count the barriers instead of issuing them.
+    barrier_counter = tmp_path / "barrier_counter.h"
+    create_file(
+        file=barrier_counter,
+        contents="""\
+#pragma once
+inline int &num_barriers()
+{
+  static int result = 0;
+  return result;
+}
+""",
+    )
+
+    test_code = """\
+  caesar.set_config(3);
+  assert(caesar.get_config() == 3);
+  assert(num_barriers() == 0);
+
+  caesar.set_config_ordered(4);
+  assert(memory[0] == 4);
+  assert(num_barriers() == 1);
+
+  assert(caesar.get_config_ordered() == 4);
+  assert(num_barriers() == 2);
+
+  caesar.set_dummies_first_ordered(1, 5);
+  assert(caesar.get_dummies_first_ordered(1) == 5);
+  assert(caesar.get_dummies_first(1) == 5);
+  assert(num_barriers() == 4);
+
+  {
+    fpga_regs::RegisterBatch batch;
+    caesar.set_config(1);
+    caesar.set_address(2);
+    caesar.set_command(1);
+    assert(num_barriers() == 4);
+  }
+  assert(num_barriers() == 5);
+"""
+    cmd = test.compile(
+        test_code=test_code,
+        defines=["FPGA_REGS_BARRIER()=++num_barriers()"],
+        compile_flags=["-include", str(barrier_counter)],
+    )
+    run_command(cmd)
+
+
+def test_cpp_commit_of_double_buffered_registers(tmp_path):
+    test = BaseCppTest(tmp_path=tmp_path)
+
+    register = test.register_list.get_register("command")
+    register.commits = ["config", "address"]
+
+    test_code = f"""\
+  memory[{register.index}] = 1337;
+
+  caesar.commit_command();
+  assert(memory[{register.index}] == {register.default_value});
+"""
+    cmd = test.compile(test_code=test_code)
+    run_command(cmd)
+
+
+def test_cpp_static_registers_are_read_only_once(tmp_path):
+    test = BaseCppTest(tmp_path=tmp_path)
+
+    status = test.register_list.get_register("status")
+    status.static = True
+    test.register_list.get_register_array("dummies").get_register("second").static = True
+
+    second_index = [
+        test.register_list.get_register_index(
+            register_name="second", register_array_name="dummies", register_array_index=array_index
+        )
+        for array_index in range(2)
+    ]
+
+    test_code = f"""\
+  memory[{status.index}] = 5;
+  assert(caesar.get_status() == 5);
+
+  // Later reads give the cached value, not the value on the bus.
+  memory[{status.index}] = 6;
+  assert(caesar.get_status() == 5);
+  assert(caesar.get_status_ordered() == 5);
+  assert(caesar.get_status_a() == 1);
+
+  // Each array index is cached separately.
+  memory[{second_index[0]}] = 1;
+  memory[{second_index[1]}] = 2;
+  assert(caesar.get_dummies_second(1) == 2);
+  memory[{second_index[1]}] = 3;
+  assert(caesar.get_dummies_second(1) == 2);
+  assert(caesar.get_dummies_second(0) == 1);
+
+  // Other instances have their own cache.
+  fpga_regs::Caesar other_caesar(base_address);
+  assert(other_caesar.get_status() == 6);
+
+  // After a reset of the cache, the registers are read over the bus again.
+  caesar.reset_static_cache();
+  assert(caesar.get_status() == 6);
+  assert(caesar.get_dummies_second(1) == 3);
+  memory[{status.index}] = 7;
+  assert(caesar.get_status() == 6);
+
+  // The class is neither copyable nor movable, because of the atomic cache.
+  static_assert(!std::is_copy_constructible<fpga_regs::Caesar>::value, "");
+  static_assert(!std::is_move_constructible<fpga_regs::Caesar>::value, "");
+"""
+    cmd = test.compile(test_code=test_code, includes="#include <type_traits>")
+    run_command(cmd)
+
+
+def test_cpp_register_pairs(tmp_path):
+    test = BaseCppTest(tmp_path=tmp_path)
+    test.register_list.add_register_pair(
+        name="flags", low="irq_status", high="status", description=""
+    )
+    test.register_list.add_register_pair(
+        name="control", low="config", high="command", description=""
+    )
+    CppTraceGenerator(output_folder=test.include_dir).create()
+
+    trace_file = tmp_path / "trace.bin"
+    test_code = f"""\
+  memory[2] = 0x11111111;
+  memory[3] = 0x22222222;
+  assert(caesar.get_flags() == 0x2222222211111111uLL);
+
+  fpga_regs::trace::start(base_address);
+  caesar.set_control(0x0000000500000003uLL);
+  fpga_regs::trace::stop();
+  assert(memory[0] == 3);
+  assert(memory[1] == 5);
+
+  assert(fpga_regs::trace::save("{trace_file}"));
+"""
+    cmd = test.compile(
+        test_code=test_code,
+        includes='#include "include/fpga_regs_trace.h"',
+        defines=["FPGA_REGS_TRACE"],
+    )
+    run_command(cmd)
+
+    # The 64-bit write is recorded as a write to each register.
+    assert [
+        (entry.offset, entry.value, entry.is_write) for entry in Trace.from_file(trace_file).entries
+    ] == [(0, 3, True), (4, 5, True)]
+
+
+def test_cpp_register_pairs_with_64_bit_data_width(tmp_path):
+    test = BaseCppTest(tmp_path=tmp_path)
+    test.register_list.add_register_pair(
+        name="flags", low="irq_status", high="status", description=""
+    )
+    test.register_list.add_register_pair(
+        name="control", low="config", high="command", description=""
+    )
+    CppTraceGenerator(output_folder=test.include_dir).create()
+
+    trace_file = tmp_path / "trace.bin"
+    test_code = f"""\
+  static_assert(FPGA_REGS_DATA_WIDTH == 64);
+
+  memory[2] = 0x11111111;
+  memory[3] = 0x22222222;
+  assert(caesar.get_flags() == 0x2222222211111111uLL);
+
+  fpga_regs::trace::start(base_address);
+  caesar.set_control(0x0000000500000003uLL);
+  fpga_regs::trace::stop();
+  assert(memory[0] == 3);
+  assert(memory[1] == 5);
+
+  assert(fpga_regs::trace::save("{trace_file}"));
+"""
+    cmd = test.compile(
+        test_code=test_code,
+        includes='#include "include/fpga_regs_trace.h"',
+        defines=["FPGA_REGS_TRACE", "FPGA_REGS_DATA_WIDTH=64"],
+    )
+    run_command(cmd)
+
+    # The single 64-bit write is still recorded as a write to each register.
+    assert [
+        (entry.offset, entry.value, entry.is_write) for entry in Trace.from_file(trace_file).entries
+    ] == [(0, 3, True), (4, 5, True)]
+
+
+def test_cpp_register_array_with_power_of_two_stride(tmp_path):
+    test = BaseCppTest(tmp_path=tmp_path)
+    register_array = test.register_list.append_register_array(
+        name="channels", length=3, description="", power_of_two_stride=True
+    )
+    register_array.append_register(name="gain", mode="r_w", description="")
+    register_array.append_register(name="offset", mode="r_w", description="")
+    register_array.append_register(name="status", mode="r", description="")
+
+    test_code = """\
+  static_assert(fpga_regs::caesar::channels::array_stride == 4);
+  static_assert(fpga_regs::caesar::channels::num_padding_registers == 3);
+  // Base index 21 is aligned up to the stride.
+  static_assert(fpga_regs::Caesar::num_registers == 36);
+
+  caesar.set_channels_gain(1, 5);
+  assert(memory[24 + 4] == 5);
+
+  memory[24 + 2 * 4 + 2] = 7;
+  assert(caesar.get_channels_status(2) == 7);
+"""
+    run_command(test.compile(test_code=test_code))
+
+
+def test_cpp_programming_sequence(tmp_path):
+    test = BaseCppTest(tmp_path=tmp_path)
+    programming_sequence = test.register_list.add_programming_sequence(
+        name="initialize", description=""
+    )
+    programming_sequence.append_write(register="config", field="plain_bit_a", value=1)
+    programming_sequence.append_wait(register="status", field="a", value=1)
+    programming_sequence.append_delay(microseconds=5)
+    programming_sequence.append_write(register="address", value=0x1234)
+
+    test_code = """\
+  static_assert(fpga_regs::Caesar::initialize_sequence.size() == 4);
+  static_assert(
+    fpga_regs::Caesar::initialize_sequence[0].opcode == fpga_regs::SequenceOpcode::modify
+  );
+
+  static uint32_t total_delay_us = 0;
+  auto delay_us = [](uint32_t microseconds) { total_delay_us += microseconds; };
+  const auto &sequence = fpga_regs::Caesar::initialize_sequence;
+
+  memory[0] = 0xF0;
+  memory[3] = 0;
+
+  // Times out, since the status bit is never set.
+  assert(!caesar.run_sequence(sequence.data(), sequence.size(), delay_us, 3));
+  assert(memory[0] == 0xF1);
+  assert(total_delay_us == 0);
+
+  memory[3] = 3;
+  assert(caesar.run_sequence(sequence.data(), sequence.size(), delay_us, 3));
+  assert(total_delay_us == 5);
+  assert(memory[4] == 0x1234);
+"""
+    run_command(test.compile(test_code=test_code))
+
+
+def test_cpp_register_map_rom(tmp_path):
+    """
+    The ROM decoder is a C header, which shall work also from C++.
+    The decoding is tested more extensively in the C test.
+    """
+    test = BaseCppTest(tmp_path=tmp_path)
+    CRegisterMapRomGenerator(test.register_list, test.include_dir).create()
+
+    words = RegisterMapRom(register_list=test.register_list).get_words()
+    rom_words = ", ".join(f"0x{word:08X}u" for word in words)
+
+    test_code = f"""\
+  const uint32_t rom[] = {{{rom_words}}};
+  assert(caesar_register_map_rom_check(rom, CAESAR_REGISTER_MAP_ROM_NUM_WORDS)
+    == CAESAR_REGISTER_MAP_ROM_OK);
+
+  caesar_register_map_rom_register_t reg;
+  caesar_register_map_rom_get_register(
+    rom, caesar_register_map_rom_find_register(rom, "address", nullptr), &reg);
+  assert(reg.index == 4);
+  assert(reg.mode == CAESAR_REGISTER_MAP_ROM_MODE_W);
+"""
+    run_command(test.compile(test_code=test_code, includes='#include "caesar_register_map_rom.h"'))
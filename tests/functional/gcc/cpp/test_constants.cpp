@@ -21,6 +21,13 @@ void test_constants(uint32_t *memory, fpga_regs::Caesar *caesar)
   assert(fpga_regs::Caesar::rate == 3.5);
   assert(fpga_regs::Caesar::rate != 3.6);
 
+  static_assert(fpga_regs::Caesar::coefficients.size() == 4, "Wrong length");
+  static_assert(fpga_regs::Caesar::coefficients[1] == -1, "Wrong value");
+  assert(fpga_regs::Caesar::coefficients[0] == 3);
+  assert(fpga_regs::Caesar::coefficients[3] == 7);
+  assert(fpga_regs::Caesar::calibration.size() == 2);
+  assert(fpga_regs::Caesar::calibration[1] == -1.25);
+
   assert(fpga_regs::Caesar::paragraph == "hello there :)");
   assert(fpga_regs::Caesar::paragraph != "");
 
@@ -0,0 +1,145 @@
+-- -------------------------------------------------------------------------------------------------
+-- Copyright (c) Lukas Vik. All rights reserved.
+--
+-- This file is part of the hdl-registers project, an HDL register generator fast enough to run
+-- in real time.
+-- https://hdl-registers.com
+-- https://github.com/hdl-registers/hdl-registers
+-- -------------------------------------------------------------------------------------------------
+-- Access many register files through the generated AXI-Lite decoder.
+-- -------------------------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library vunit_lib;
+context vunit_lib.vc_context;
+context vunit_lib.vunit_context;
+
+library axi;
+use axi.axi_lite_pkg.all;
+
+library bfm;
+
+library common;
+use common.addr_pkg.all;
+
+use work.caesar_regs_pkg.all;
+use work.caesar_register_record_pkg.all;
+use work.caesar_register_read_write_pkg.all;
+
+
+entity tb_axi_lite_decoder is
+  generic (
+    pipeline_response : boolean;
+    runner_cfg : string
+  );
+end entity;
+
+architecture tb of tb_axi_lite_decoder is
+
+  constant clk_period : time := 10 ns;
+  signal clk : std_ulogic := '0';
+
+  signal axi_lite_m2s : axi_lite_m2s_t := axi_lite_m2s_init;
+  signal axi_lite_s2m : axi_lite_s2m_t := axi_lite_s2m_init;
+
+  -- The register files are placed at these base addresses by the test runner.
+  constant num_reg_files : positive := 3;
+  constant reg_file_address_step : positive := 16#1000#;
+
+  type m2s_vec_t is array (0 to num_reg_files - 1) of axi_lite_m2s_t;
+  type s2m_vec_t is array (0 to num_reg_files - 1) of axi_lite_s2m_t;
+  signal reg_files_m2s : m2s_vec_t := (others => axi_lite_m2s_init);
+  signal reg_files_s2m : s2m_vec_t := (others => axi_lite_s2m_init);
+
+  type regs_down_vec_t is array (0 to num_reg_files - 1) of caesar_regs_down_t;
+  signal regs_down : regs_down_vec_t := (others => caesar_regs_down_init);
+
+  function get_base_address(reg_file_index : natural) return addr_t is
+  begin
+    return to_unsigned(reg_file_index * reg_file_address_step, addr_t'length);
+  end function;
+
+begin
+
+  clk <= not clk after clk_period / 2;
+  test_runner_watchdog(runner, 1 ms);
+
+
+  ------------------------------------------------------------------------------
+  main : process
+    variable config : caesar_config_t := caesar_config_init;
+  begin
+    test_runner_setup(runner, runner_cfg);
+
+    if run("test_write_and_read_each_register_file") then
+      for reg_file_index in regs_down'range loop
+        config.plain_integer := 10 * reg_file_index;
+        write_caesar_config(
+          net=>net, value=>config, base_address=>get_base_address(reg_file_index)
+        );
+      end loop;
+
+      for reg_file_index in regs_down'range loop
+        read_caesar_config(
+          net=>net, value=>config, base_address=>get_base_address(reg_file_index)
+        );
+        check_equal(config.plain_integer, 10 * reg_file_index);
+        check_equal(regs_down(reg_file_index).config.plain_integer, 10 * reg_file_index);
+      end loop;
+    end if;
+
+    test_runner_cleanup(runner);
+  end process;
+
+
+  ------------------------------------------------------------------------------
+  axi_lite_master_inst : entity bfm.axi_lite_master
+    port map (
+      clk => clk,
+      --
+      axi_lite_m2s => axi_lite_m2s,
+      axi_lite_s2m => axi_lite_s2m
+    );
+
+
+  ------------------------------------------------------------------------------
+  test_system_axi_lite_decoder_inst : entity work.test_system_axi_lite_decoder
+    generic map (
+      pipeline_response => pipeline_response
+    )
+    port map (
+      clk => clk,
+      --
+      axi_lite_m2s => axi_lite_m2s,
+      axi_lite_s2m => axi_lite_s2m,
+      --
+      caesar_0_axi_lite_m2s => reg_files_m2s(0),
+      caesar_0_axi_lite_s2m => reg_files_s2m(0),
+      --
+      caesar_1_axi_lite_m2s => reg_files_m2s(1),
+      caesar_1_axi_lite_s2m => reg_files_s2m(1),
+      --
+      caesar_2_axi_lite_m2s => reg_files_m2s(2),
+      caesar_2_axi_lite_s2m => reg_files_s2m(2)
+    );
+
+
+  ------------------------------------------------------------------------------
+  reg_files_gen : for reg_file_index in regs_down'range generate
+
+    caesar_reg_file_inst : entity work.caesar_reg_file
+      port map(
+        clk => clk,
+        --
+        axi_lite_m2s => reg_files_m2s(reg_file_index),
+        axi_lite_s2m => reg_files_s2m(reg_file_index),
+        --
+        regs_down => regs_down(reg_file_index)
+      );
+
+  end generate;
+
+end architecture;
@@ -0,0 +1,196 @@
+-- -------------------------------------------------------------------------------------------------
+-- Copyright (c) Lukas Vik. All rights reserved.
+--
+-- This file is part of the hdl-registers project, an HDL register generator fast enough to run
+-- in real time.
+-- https://hdl-registers.com
+-- https://github.com/hdl-registers/hdl-registers
+-- -------------------------------------------------------------------------------------------------
+-- Check that the register file wrapper, with a 64-bit register bus, accesses the two registers
+-- of a register pair in one bus transaction, in the same clock cycle.
+-- The bus is driven directly, since the BFM is for a 32-bit bus.
+-- -------------------------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library vunit_lib;
+context vunit_lib.vunit_context;
+
+library axi;
+use axi.axi_lite_pkg.all;
+use axi.axi_pkg.all;
+
+use work.pair_regs_pkg.all;
+use work.pair_register_record_pkg.all;
+
+
+entity tb_data_width_64 is
+  generic (
+    runner_cfg : string
+  );
+end entity;
+
+architecture tb of tb_data_width_64 is
+
+  constant clk_period : time := 10 ns;
+  signal clk : std_ulogic := '0';
+
+  signal axi_lite_m2s : axi_lite_m2s_t := axi_lite_m2s_init;
+  signal axi_lite_s2m : axi_lite_s2m_t := axi_lite_s2m_init;
+
+  signal regs_up : pair_regs_up_t := pair_regs_up_init;
+  signal regs_down : pair_regs_down_t := pair_regs_down_init;
+
+  signal reg_was_read : pair_reg_was_read_t := pair_reg_was_read_init;
+  signal reg_was_written : pair_reg_was_written_t := pair_reg_was_written_init;
+
+begin
+
+  clk <= not clk after clk_period / 2;
+  test_runner_watchdog(runner, 1 ms);
+
+
+  ------------------------------------------------------------------------------
+  main : process
+
+    procedure write_word(
+      address : natural;
+      data : std_ulogic_vector(63 downto 0);
+      strb : std_ulogic_vector(7 downto 0);
+      expected_resp : axi_resp_t := axi_resp_okay
+    ) is
+    begin
+      axi_lite_m2s.write.aw.addr <= to_unsigned(address, axi_lite_m2s.write.aw.addr'length);
+      axi_lite_m2s.write.aw.valid <= '1';
+      axi_lite_m2s.write.w.data <= (others => '0');
+      axi_lite_m2s.write.w.data(data'range) <= data;
+      axi_lite_m2s.write.w.strb <= (others => '0');
+      axi_lite_m2s.write.w.strb(strb'range) <= strb;
+      axi_lite_m2s.write.w.valid <= '1';
+      wait until axi_lite_s2m.write.aw.ready = '1' and rising_edge(clk);
+
+      axi_lite_m2s.write.aw.valid <= '0';
+      axi_lite_m2s.write.w.valid <= '0';
+      axi_lite_m2s.write.b.ready <= '1';
+      wait until axi_lite_s2m.write.b.valid = '1' and rising_edge(clk);
+
+      axi_lite_m2s.write.b.ready <= '0';
+      check_equal(axi_lite_s2m.write.b.resp, expected_resp);
+    end procedure;
+
+    procedure read_word(
+      address : natural;
+      data : out std_ulogic_vector(63 downto 0);
+      expected_resp : axi_resp_t := axi_resp_okay
+    ) is
+    begin
+      axi_lite_m2s.read.ar.addr <= to_unsigned(address, axi_lite_m2s.read.ar.addr'length);
+      axi_lite_m2s.read.ar.valid <= '1';
+      wait until axi_lite_s2m.read.ar.ready = '1' and rising_edge(clk);
+
+      axi_lite_m2s.read.ar.valid <= '0';
+      axi_lite_m2s.read.r.ready <= '1';
+      wait until axi_lite_s2m.read.r.valid = '1' and rising_edge(clk);
+
+      axi_lite_m2s.read.r.ready <= '0';
+      data := axi_lite_s2m.read.r.data(data'range);
+      check_equal(axi_lite_s2m.read.r.resp, expected_resp);
+    end procedure;
+
+    variable data : std_ulogic_vector(63 downto 0) := (others => '0');
+  begin
+    test_runner_setup(runner, runner_cfg);
+
+    if run("test_register_addresses") then
+      check_equal(pair_reg_word_range'high, 2);
+
+      check_equal(pair_reg_word_index(to_unsigned(4 * pair_control_low, 32)), 1);
+      check_equal(pair_reg_word_index(to_unsigned(4 * pair_control_high, 32)), 1);
+
+    elsif run("test_read_register_pair_in_one_transaction") then
+      regs_up.counter_low <= x"89abcdef";
+      regs_up.counter_high <= x"01234567";
+
+      read_word(address=>4 * pair_counter_low, data=>data);
+      check_equal(data, std_ulogic_vector'(x"0123456789abcdef"));
+
+      -- Both registers are read in the same clock cycle.
+      check_equal(reg_was_read.counter_low, '1');
+      check_equal(reg_was_read.counter_high, '1');
+
+    elsif run("test_write_register_pair_in_one_transaction") then
+      write_word(address=>4 * pair_control_low, data=>x"fedcba9876543210", strb=>x"ff");
+      check_equal(regs_down.control_low, std_ulogic_vector'(x"76543210"));
+      check_equal(regs_down.control_high, std_ulogic_vector'(x"fedcba98"));
+
+      read_word(address=>4 * pair_control_low, data=>data);
+      check_equal(data, std_ulogic_vector'(x"fedcba9876543210"));
+
+    elsif run("test_write_one_register_of_word") then
+      write_word(address=>4 * pair_control_low, data=>x"00000002_00000001", strb=>x"ff");
+      write_word(address=>4 * pair_control_high, data=>x"00000003_00000000", strb=>x"f0");
+
+      check_equal(regs_down.control_low, 1);
+      check_equal(regs_down.control_high, 3);
+
+    elsif run("test_unused_register_index_gives_error_only_when_strobed") then
+      write_word(address=>4 * pair_pulse, data=>x"00000000_00000005", strb=>x"0f");
+      write_word(
+        address=>4 * pair_pulse,
+        data=>x"00000001_00000000",
+        strb=>x"f0",
+        expected_resp=>axi_resp_slverr
+      );
+
+      read_word(address=>4 * pair_pulse, data=>data, expected_resp=>axi_resp_slverr);
+
+    elsif run("test_write_to_read_only_register_gives_error_and_writes_nothing") then
+      write_word(
+        address=>4 * pair_counter_low,
+        data=>x"00000001_00000001",
+        strb=>x"ff",
+        expected_resp=>axi_resp_slverr
+      );
+
+    elsif run("test_out_of_range_address_gives_error") then
+      read_word(
+        address=>8 * (pair_reg_word_range'high + 1), data=>data, expected_resp=>axi_resp_slverr
+      );
+    end if;
+
+    test_runner_cleanup(runner);
+  end process;
+
+
+  ------------------------------------------------------------------------------
+  check_pulse : process
+  begin
+    wait until reg_was_written.pulse = '1' and rising_edge(clk);
+    check_equal(regs_down.pulse, 5);
+
+    wait until rising_edge(clk);
+    check_equal(regs_down.pulse, 0);
+  end process;
+
+
+  ------------------------------------------------------------------------------
+  pair_reg_file_inst : entity work.pair_reg_file
+    generic map (
+      data_width => 64
+    )
+    port map(
+      clk => clk,
+      --
+      axi_lite_m2s => axi_lite_m2s,
+      axi_lite_s2m => axi_lite_s2m,
+      --
+      regs_up => regs_up,
+      regs_down => regs_down,
+      --
+      reg_was_read => reg_was_read,
+      reg_was_written => reg_was_written
+    );
+
+end architecture;
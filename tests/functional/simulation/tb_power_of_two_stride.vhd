@@ -0,0 +1,139 @@
+-- -------------------------------------------------------------------------------------------------
+-- Copyright (c) Lukas Vik. All rights reserved.
+--
+-- This file is part of the hdl-registers project, an HDL register generator fast enough to run
+-- in real time.
+-- https://hdl-registers.com
+-- https://github.com/hdl-registers/hdl-registers
+-- -------------------------------------------------------------------------------------------------
+-- Check that the register file wrapper maps registers to the correct register index when a
+-- register array has a power-of-two stride, i.e. when the register map does not hold the
+-- register indexes that pad the array.
+-- -------------------------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library vunit_lib;
+context vunit_lib.vc_context;
+context vunit_lib.vunit_context;
+
+library axi;
+use axi.axi_lite_pkg.all;
+
+library bfm;
+
+library reg_file;
+use reg_file.reg_file_pkg.all;
+use reg_file.reg_operations_pkg.all;
+
+use work.stride_regs_pkg.all;
+use work.stride_register_record_pkg.all;
+use work.stride_register_read_write_pkg.all;
+
+
+entity tb_power_of_two_stride is
+  generic (
+    runner_cfg : string
+  );
+end entity;
+
+architecture tb of tb_power_of_two_stride is
+
+  constant clk_period : time := 10 ns;
+  signal clk : std_ulogic := '0';
+
+  signal axi_lite_m2s : axi_lite_m2s_t := axi_lite_m2s_init;
+  signal axi_lite_s2m : axi_lite_s2m_t := axi_lite_s2m_init;
+
+  signal regs_up : stride_regs_up_t := stride_regs_up_init;
+  signal regs_down : stride_regs_down_t := stride_regs_down_init;
+
+  signal reg_was_written : stride_reg_was_written_t := stride_reg_was_written_init;
+
+begin
+
+  clk <= not clk after clk_period / 2;
+  test_runner_watchdog(runner, 1 ms);
+
+
+  ------------------------------------------------------------------------------
+  main : process
+    variable reg : reg_t := (others => '0');
+  begin
+    test_runner_setup(runner, runner_cfg);
+
+    if run("test_register_map_holds_only_mapped_registers") then
+      -- One plain register, three padding registers, and three array repetitions with three
+      -- registers each.
+      check_equal(stride_reg_range'high, 4 + 3 * 4 - 1);
+      check_equal(stride_reg_map'length, 1 + 3 * 3);
+
+      check_equal(stride_channels_gain(0), 4);
+      check_equal(stride_channels_gain(1), 8);
+
+    elsif run("test_write_and_read_array_registers") then
+      for array_index in stride_channels_range loop
+        reg := std_ulogic_vector(to_unsigned(array_index + 1, reg'length));
+        write_stride_channels_gain(net=>net, array_index=>array_index, value=>reg);
+
+        reg := std_ulogic_vector(to_unsigned(array_index + 11, reg'length));
+        write_stride_channels_offset(net=>net, array_index=>array_index, value=>reg);
+
+        regs_up.channels(array_index).status <= (
+          std_ulogic_vector(to_unsigned(array_index + 21, reg'length))
+        );
+      end loop;
+
+      write_stride_config(net=>net, value=>std_ulogic_vector(to_unsigned(7, 32)));
+      wait_until_idle(net, as_sync(regs_bus_master));
+
+      check_equal(regs_down.config, 7);
+
+      for array_index in stride_channels_range loop
+        check_equal(regs_down.channels(array_index).gain, array_index + 1);
+        check_equal(regs_down.channels(array_index).offset, array_index + 11);
+
+        read_stride_channels_status(net=>net, array_index=>array_index, value=>reg);
+        check_equal(reg, array_index + 21);
+
+        read_stride_channels_gain(net=>net, array_index=>array_index, value=>reg);
+        check_equal(reg, array_index + 1);
+      end loop;
+
+    elsif run("test_reg_was_written") then
+      write_stride_channels_offset(net=>net, array_index=>2, value=>(others => '0'));
+      wait until reg_was_written.channels(2).offset = '1' and rising_edge(clk);
+
+    end if;
+
+    test_runner_cleanup(runner);
+  end process;
+
+
+  ------------------------------------------------------------------------------
+  axi_lite_master_inst : entity bfm.axi_lite_master
+    port map (
+      clk => clk,
+      --
+      axi_lite_m2s => axi_lite_m2s,
+      axi_lite_s2m => axi_lite_s2m
+    );
+
+
+  ------------------------------------------------------------------------------
+  stride_reg_file_inst : entity work.stride_reg_file
+    port map(
+      clk => clk,
+      --
+      axi_lite_m2s => axi_lite_m2s,
+      axi_lite_s2m => axi_lite_s2m,
+      --
+      regs_up => regs_up,
+      regs_down => regs_down,
+      --
+      reg_was_written => reg_was_written
+    );
+
+end architecture;
@@ -99,6 +99,13 @@ begin
       check_equal(caesar_constant_paragraph, "hello there :)");
       check_equal(caesar_constant_base_address_bin, expected_base_address);
 
+      check_equal(caesar_constant_coefficients'length, 4);
+      check_equal(caesar_constant_coefficients(0), 3);
+      check_equal(caesar_constant_coefficients(1), -1);
+      check_equal(caesar_constant_coefficients(3), 7);
+      check_equal(caesar_constant_calibration'length, 2);
+      check_equal(caesar_constant_calibration(1), -1.25);
+
     elsif run("test_bit_vector_field_types") then
       check_equal(caesar_field_test_u0_t'high, 1);
       check_equal(caesar_field_test_u0_t'low, 0);
@@ -31,6 +31,8 @@ from hdl_registers.field.register_field_type import (
     Unsigned,
     UnsignedFixedPoint,
 )
+from hdl_registers.generator.system_code_generator import RegisterListInstance
+from hdl_registers.generator.vhdl.axi_lite_decoder import VhdlAxiLiteDecoderGenerator
 from hdl_registers.generator.vhdl.axi_lite_wrapper import VhdlAxiLiteWrapperGenerator
 from hdl_registers.generator.vhdl.record_package import VhdlRecordPackageGenerator
 from hdl_registers.generator.vhdl.register_package import VhdlRegisterPackageGenerator
@@ -44,6 +46,7 @@ from hdl_registers.generator.vhdl.test.test_register_vhdl_generator import (
     generate_strange_register_maps,
 )
 from hdl_registers.parser.toml import from_toml
+from hdl_registers.register_list import RegisterList
 
 DOC_SIM_FOLDER = HDL_REGISTERS_DOC / "sphinx" / "rst" / "generator" / "sim"
 
@@ -61,6 +64,8 @@ def test_running_simulation(tmp_path):
     generate_toml_registers(output_path=tmp_path)
     generate_strange_register_maps(output_path=tmp_path)
     generate_doc_registers(output_path=tmp_path)
+    generate_power_of_two_stride_registers(output_path=tmp_path)
+    generate_register_pair_registers(output_path=tmp_path)
 
     def run(args, exit_code):
         argv = ["--minimal", "--num-threads", "10", "--output-path", str(tmp_path)] + args
@@ -79,6 +84,13 @@ def test_running_simulation(tmp_path):
         for vhd_file in tmp_path.glob("*.vhd"):
             library.add_source_file(vhd_file)
 
+        testbench = library.test_bench("tb_axi_lite_decoder")
+        for pipeline_response in [False, True]:
+            testbench.add_config(
+                name=f"pipeline_response_{pipeline_response}",
+                generics=dict(pipeline_response=pipeline_response),
+            )
+
         for module in get_hdl_modules():
             vunit_library = vunit_proj.add_library(library_name=module.library_name)
             for hdl_file in module.get_simulation_files(include_tests=False):
@@ -150,6 +162,20 @@ def generate_toml_registers(output_path):
         register_list=register_list, output_folder=output_path
     ).create_if_needed()
 
+    # Three register files, placed at the base addresses expected by 'tb_axi_lite_decoder'.
+    VhdlAxiLiteDecoderGenerator(
+        name="test_system",
+        register_lists=[
+            RegisterListInstance(
+                register_list=register_list,
+                base_address=instance_index * 0x1000,
+                name=f"caesar_{instance_index}",
+            )
+            for instance_index in range(3)
+        ],
+        output_folder=output_path,
+    ).create_if_needed()
+
 
 def generate_doc_registers(output_path):
     register_list = from_toml(name="counter", toml_file=DOC_SIM_FOLDER / "regs_counter.toml")
@@ -178,3 +204,67 @@ def generate_doc_registers(output_path):
 if __name__ == "__main__":
     vunit_output_path = create_directory(HDL_REGISTERS_GENERATED / "vunit_out", empty=False)
     test_running_simulation(tmp_path=vunit_output_path)
+
+
+def generate_power_of_two_stride_registers(output_path):
+    """
+    Register list for 'tb_power_of_two_stride', where the register array is padded and aligned.
+    """
+    register_list = RegisterList(name="stride")
+
+    register_list.append_register(name="config", mode="r_w", description="")
+
+    register_array = register_list.append_register_array(
+        name="channels", length=3, description="", power_of_two_stride=True
+    )
+    register_array.append_register(name="gain", mode="r_w", description="")
+    register_array.append_register(name="offset", mode="w", description="")
+    register_array.append_register(name="status", mode="r", description="")
+
+    VhdlRegisterPackageGenerator(
+        register_list=register_list, output_folder=output_path
+    ).create_if_needed()
+
+    VhdlRecordPackageGenerator(
+        register_list=register_list, output_folder=output_path
+    ).create_if_needed()
+
+    VhdlSimulationReadWritePackageGenerator(
+        register_list=register_list, output_folder=output_path
+    ).create_if_needed()
+
+    VhdlAxiLiteWrapperGenerator(
+        register_list=register_list, output_folder=output_path
+    ).create_if_needed()
+
+
+def generate_register_pair_registers(output_path):
+    """
+    Register list for 'tb_data_width_64', with register pairs and a padded last word.
+    """
+    register_list = RegisterList(name="pair")
+
+    register_list.append_register(name="counter_low", mode="r", description="")
+    register_list.append_register(name="counter_high", mode="r", description="")
+    register_list.append_register(name="control_low", mode="r_w", description="")
+    register_list.append_register(name="control_high", mode="r_w", description="")
+    register_list.append_register(name="pulse", mode="wpulse", description="")
+
+    register_list.add_register_pair(
+        name="counter", low="counter_low", high="counter_high", description=""
+    )
+    register_list.add_register_pair(
+        name="control", low="control_low", high="control_high", description=""
+    )
+
+    VhdlRegisterPackageGenerator(
+        register_list=register_list, output_folder=output_path
+    ).create_if_needed()
+
+    VhdlRecordPackageGenerator(
+        register_list=register_list, output_folder=output_path
+    ).create_if_needed()
+
+    VhdlAxiLiteWrapperGenerator(
+        register_list=register_list, output_folder=output_path
+    ).create_if_needed()
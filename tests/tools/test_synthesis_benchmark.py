@@ -0,0 +1,157 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+"""
+Test the synthesis benchmark script without running GHDL or yosys.
+"""
+
+# Standard libraries
+import json
+from pathlib import Path
+from unittest.mock import MagicMock, patch
+
+# Third party libraries
+import pytest
+from tsfpga.system_utils import create_file
+
+# First party libraries
+from tools import synthesis_benchmark
+
+STAT = {
+    "modules": {
+        "\\benchmark_8_reg_file": {
+            "num_cells_by_type": {
+                "LUT6": 20,
+                "LUT2": 3,
+                "FDRE": 40,
+                "FDSE": 2,
+                "CARRY4": 1,
+            }
+        }
+    }
+}
+
+LOG = """\
+Longest topological path in benchmark_8_reg_file (length=7):
+    0: axi_lite_m2s.read.ar.valid
+"""
+
+
+def test_get_register_list():
+    # The register array always has at least one element, with two registers.
+    for num_registers, num_register_indexes in [(1, 2), (8, 8), (64, 64), (255, 255)]:
+        register_list = synthesis_benchmark.get_register_list(num_registers=num_registers)
+
+        assert register_list.name == f"benchmark_{num_registers}"
+        assert register_list.register_objects[-1].index + 1 == num_register_indexes
+
+
+def test_get_result():
+    assert synthesis_benchmark.get_result(stat=STAT, log=LOG) == {
+        "luts": 23,
+        "flip_flops": 42,
+        "logic_depth": 7,
+        "cells": {"CARRY4": 1, "FDRE": 40, "FDSE": 2, "LUT2": 3, "LUT6": 20},
+    }
+
+
+def test_get_result_without_logic_depth_in_log_should_raise_exception():
+    with pytest.raises(ValueError) as exception_info:
+        synthesis_benchmark.get_result(stat=STAT, log="Found 0 SCCs.\n")
+    assert str(exception_info.value) == "Could not find the logic depth in the yosys log."
+
+
+def test_import_hdl_modules(tmp_path):
+    module = MagicMock()
+    module.library_name = "reg_file"
+    module.get_synthesis_files.return_value = [
+        MagicMock(path=Path("reg_file.vhd"), is_vhdl=True),
+        MagicMock(path=Path("reg_file.tcl"), is_vhdl=False),
+    ]
+    module_without_vhdl = MagicMock()
+    module_without_vhdl.get_synthesis_files.return_value = []
+
+    with patch(
+        "tools.synthesis_benchmark.get_hdl_modules", return_value=[module, module_without_vhdl]
+    ), patch("tools.synthesis_benchmark.run_command", autospec=True) as run_command:
+        synthesis_benchmark.import_hdl_modules(work_folder=tmp_path)
+
+    run_command.assert_called_once_with(
+        [
+            "ghdl",
+            "-i",
+            "--std=08",
+            "--work=reg_file",
+            f"--workdir={tmp_path}",
+            f"-P{tmp_path}",
+            "reg_file.vhd",
+        ]
+    )
+
+
+def test_synthesize(tmp_path):
+    register_list = synthesis_benchmark.get_register_list(num_registers=8)
+    work_folder = tmp_path / "ghdl"
+    output_folder = tmp_path / "benchmark_8"
+
+    def run_command(cmd):
+        # Create the files that yosys would have written.
+        if cmd[0] == "yosys":
+            create_file(output_folder / "stat.json", json.dumps(STAT))
+            create_file(output_folder / "yosys.log", LOG)
+
+    with patch(
+        "tools.synthesis_benchmark.run_command", autospec=True, side_effect=run_command
+    ) as mocked_run_command:
+        result = synthesis_benchmark.synthesize(
+            register_list=register_list, work_folder=work_folder, output_folder=output_folder
+        )
+
+    assert result["luts"] == 23
+    assert result["logic_depth"] == 7
+
+    register_code_folder = output_folder / "register_code"
+    vhd_files = sorted(register_code_folder.glob("*.vhd"))
+    assert [path.name for path in vhd_files] == [
+        "benchmark_8_reg_file.vhd",
+        "benchmark_8_register_record_pkg.vhd",
+        "benchmark_8_regs_pkg.vhd",
+    ]
+
+    ghdl_options = [
+        "--std=08",
+        "--work=register_benchmark",
+        f"--workdir={work_folder}",
+        f"-P{work_folder}",
+    ]
+    (import_command,), (make_command,), (yosys_command,) = [
+        call.args for call in mocked_run_command.call_args_list
+    ]
+
+    assert import_command[:6] == ["ghdl", "-i"] + ghdl_options
+    assert sorted(import_command[6:]) == [str(path) for path in vhd_files]
+
+    assert make_command == ["ghdl", "-m"] + ghdl_options + ["benchmark_8_reg_file"]
+
+    assert yosys_command[:6] == [
+        "yosys",
+        "-m",
+        "ghdl",
+        "-q",
+        "-l",
+        str(output_folder / "yosys.log"),
+    ]
+    assert yosys_command[6] == "-p"
+    assert yosys_command[7].split("; ") == [
+        " ".join(["ghdl"] + ghdl_options + ["benchmark_8_reg_file"]),
+        "synth_xilinx -flatten -top benchmark_8_reg_file",
+        f"tee -q -o {output_folder / 'stat.json'} stat -json",
+        "ltp -noff t:* t:FD* %d",
+    ]
+    assert len(yosys_command) == 8
@@ -0,0 +1,115 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+"""
+Benchmark the memory usage of the register list object model, for register lists of
+increasing size.
+
+Reports the memory held by the register list objects, and the peak memory while calculating
+:meth:`.RegisterList.object_hash`, which is done for every generator.
+"""
+
+# Standard libraries
+import gc
+import sys
+import tracemalloc
+from pathlib import Path
+
+# Do PYTHONPATH insert() instead of append() to prefer any local repo checkout over any pip install
+REPO_ROOT = Path(__file__).parent.parent.resolve()
+sys.path.insert(0, str(REPO_ROOT))
+
+# Import before others since it modifies PYTHONPATH. pylint: disable=unused-import
+import tools.tools_pythonpath  # noqa: F401
+
+# First party libraries
+from hdl_registers.register_list import RegisterList
+
+# Number of registers in each benchmarked register list.
+# The largest is similar to the register map of a very large FPGA design.
+NUM_REGISTERS = [1_000, 10_000, 100_000]
+
+# Number of fields in each register.
+NUM_FIELDS_PER_REGISTER = 10
+
+# Registers are grouped in blocks, that are repeated with the same field names and descriptions.
+# Similar to e.g. many instances of the same IP core.
+NUM_REGISTERS_PER_BLOCK = 50
+
+
+def get_register_list(num_registers: int) -> RegisterList:
+    """
+    Strings are created at run time, the way a parser would, instead of being literals that
+    Python shares automatically.
+    """
+    register_list = RegisterList(name="benchmark")
+
+    for register_index in range(num_registers):
+        block_index, index_in_block = divmod(register_index, NUM_REGISTERS_PER_BLOCK)
+
+        register = register_list.append_register(
+            name=f"block_{block_index}_register_{index_in_block}",
+            mode="r_w",
+            description=" ".join(["Configuration register", str(index_in_block), "of the block."]),
+        )
+
+        for field_index in range(NUM_FIELDS_PER_REGISTER):
+            register.append_bit_vector(
+                name="_".join(["field", str(field_index)]),
+                description=" ".join(["Setting", str(field_index), "of the register."]),
+                width=3,
+                default_value="".join(["0", "0", "0"]),
+            )
+
+    return register_list
+
+
+def measure(num_registers: int) -> tuple[int, int]:
+    """
+    Return the memory, in bytes, held by the register list, and the peak memory while
+    calculating the object hash.
+    """
+    gc.collect()
+    tracemalloc.start()
+
+    register_list = get_register_list(num_registers=num_registers)
+    gc.collect()
+    model_size, _ = tracemalloc.get_traced_memory()
+
+    tracemalloc.reset_peak()
+    register_list.object_hash  # pylint: disable=pointless-statement
+    _, hash_peak = tracemalloc.get_traced_memory()
+
+    tracemalloc.stop()
+
+    return model_size, hash_peak - model_size
+
+
+def main() -> None:
+    print(
+        f"""
+{NUM_FIELDS_PER_REGISTER} fields per register.
+--------------------------------------------------------------------------
+  Registers |     Fields | Model memory | Per field | Object hash peak
+------------+------------+--------------+-----------+---------------------\
+"""
+    )
+
+    for num_registers in NUM_REGISTERS:
+        model_size, hash_peak = measure(num_registers=num_registers)
+        num_fields = num_registers * NUM_FIELDS_PER_REGISTER
+
+        print(
+            f"{num_registers:>11} | {num_fields:>10} | {model_size / 1e6:>9.1f} MB | "
+            f"{model_size / num_fields:>7.0f} B | {hash_peak / 1e6:.2f} MB"
+        )
+
+
+if __name__ == "__main__":
+    main()
@@ -26,6 +26,10 @@ from tsfpga.system_utils import create_directory, run_command
 
 # First party libraries
 from hdl_registers import HDL_REGISTERS_GENERATED, HDL_REGISTERS_TESTS
+from hdl_registers.generator.c.header import CHeaderGenerator
+from hdl_registers.generator.cpp.header import CppHeaderGenerator
+from hdl_registers.generator.cpp.implementation import CppImplementationGenerator
+from hdl_registers.generator.cpp.interface import CppInterfaceGenerator
 from hdl_registers.generator.vhdl.axi_lite_wrapper import VhdlAxiLiteWrapperGenerator
 from hdl_registers.generator.vhdl.record_package import VhdlRecordPackageGenerator
 from hdl_registers.generator.vhdl.register_package import VhdlRegisterPackageGenerator
@@ -39,6 +43,8 @@ from hdl_registers.parser.json import from_json
 from hdl_registers.parser.toml import _load_toml_file, from_toml
 
 NUM_ITERATIONS = 10_000
+# Generating code is much slower than the parse and 'should_create' checks that are profiled above.
+NUM_GET_CODE_ITERATIONS = 100
 
 OUTPUT_FOLDER = create_directory(HDL_REGISTERS_GENERATED / "profiling", empty=False)
 TOML_FILE = HDL_REGISTERS_TESTS / "regs_test.toml"
@@ -111,9 +117,39 @@ def profile_generate(output_folder: Path) -> cProfile.Profile:
     return profiler
 
 
+def profile_generate_c_cpp(output_folder: Path) -> cProfile.Profile:
+    """
+    Profile the code generation itself, not only the 'should_create' check.
+    The C and C++ generators call the naming helpers in :class:`.RegisterCodeGeneratorHelpers`
+    many times for each field, e.g. for getter and setter function names and descriptions.
+    """
+    register_list = from_toml(name="apa", toml_file=TOML_FILE)
+
+    generators = [
+        generator_class(register_list=register_list, output_folder=output_folder)
+        for generator_class in [
+            CHeaderGenerator,
+            CppInterfaceGenerator,
+            CppHeaderGenerator,
+            CppImplementationGenerator,
+        ]
+    ]
+
+    profiler = cProfile.Profile()
+
+    profiler.enable()
+    for _ in range(NUM_GET_CODE_ITERATIONS):
+        for generator in generators:
+            generator.get_code()
+    profiler.disable()
+
+    return profiler
+
+
 def run_profiling(verbose: bool) -> None:
     for test_function, name in [
         (profile_generate, "generate"),
+        (profile_generate_c_cpp, "generate_c_cpp"),
         (profile_parse_json, "parse_json"),
         (profile_parse_toml, "parse_toml"),
     ]:
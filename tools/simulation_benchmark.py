@@ -0,0 +1,295 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+"""
+Benchmark the simulation performance of generated VHDL code.
+
+Compares the record conversion functions of :class:`.VhdlRecordPackageGenerator`, where register
+arrays are converted with a VHDL 'for' loop, with the unrolled form that has one assignment per
+array element.
+
+Also measures the throughput of the generated register file, record conversion functions and
+read/write procedures, for register lists of increasing size:
+
+* Simulated bus transactions per wall-clock second, using the procedures from
+  :class:`.VhdlSimulationReadWritePackageGenerator` towards the register file from
+  :class:`.VhdlAxiLiteWrapperGenerator`.
+  The wall-clock time of an empty test is subtracted, so that elaboration is not included.
+* Number of delta cycles, and number of signal events, that the conversions inside the register
+  file wrapper take to update their output.
+  The values are written and read over AXI-Lite, and the conversions are observed inside the
+  wrapper with VHDL-2008 external names.
+
+The throughput result is printed as JSON, and written to a file.
+The simulator is given by the ``VUNIT_SIMULATOR`` environment variable, as usual with VUnit.
+"""
+
+# Standard libraries
+import json
+import sys
+from pathlib import Path
+from typing import Any, Callable, Optional
+
+# Do PYTHONPATH insert() instead of append() to prefer any local repo checkout over any pip install
+REPO_ROOT = Path(__file__).parent.parent.resolve()
+sys.path.insert(0, str(REPO_ROOT))
+
+# Import before others since it modifies PYTHONPATH. pylint: disable=unused-import
+import tools.tools_pythonpath  # noqa: F401
+
+# Third party libraries
+from tsfpga.examples.example_env import get_hdl_modules
+from tsfpga.system_utils import create_directory, create_file, read_file
+from vunit import VUnit
+
+# First party libraries
+from hdl_registers import HDL_REGISTERS_GENERATED, __version__
+from hdl_registers.generator.vhdl.axi_lite_wrapper import VhdlAxiLiteWrapperGenerator
+from hdl_registers.generator.vhdl.record_package import VhdlRecordPackageGenerator
+from hdl_registers.generator.vhdl.register_package import VhdlRegisterPackageGenerator
+from hdl_registers.generator.vhdl.simulation.read_write_package import (
+    VhdlSimulationReadWritePackageGenerator,
+)
+from hdl_registers.register import Register
+from hdl_registers.register_array import RegisterArray
+from hdl_registers.register_list import RegisterList
+
+THIS_FOLDER = Path(__file__).parent.resolve()
+SIMULATION_BENCHMARK_FOLDER = THIS_FOLDER / "simulation_benchmark"
+
+OUTPUT_FOLDER = HDL_REGISTERS_GENERATED / "simulation_benchmark"
+
+# Length of the register array in the benchmark register list.
+# Similar to a large status counter bank.
+ARRAY_LENGTH = 1024
+
+# Number of register value changes to simulate in each test.
+NUM_ITERATIONS = 10_000
+
+# Register array lengths of the register lists in the throughput benchmark.
+# Each one is compiled into its own VHDL library.
+THROUGHPUT_ARRAY_LENGTHS = [16, 256, 1024]
+
+# Number of bus transactions to simulate in the throughput benchmark.
+NUM_TRANSACTIONS = 2_000
+
+
+class UnrolledVhdlRecordPackageGenerator(VhdlRecordPackageGenerator):
+    """
+    Generate the record package with one assignment per register array element,
+    instead of a VHDL 'for' loop.
+    Used as reference in the benchmark.
+    """
+
+    def _iterate_with_array_loops(
+        self,
+        get_assignment: Callable[[Register, Optional[RegisterArray], str], str],
+        register_is_included: Callable[[Register], bool],
+    ) -> str:
+        vhdl = ""
+
+        for register, register_array in self.iterate_registers():
+            if not register_is_included(register):
+                continue
+
+            assignment = get_assignment(register, register_array, "    ")
+
+            if register_array is None:
+                vhdl += assignment
+                continue
+
+            for array_index in range(register_array.length):
+                vhdl += assignment.replace("array_index=>array_index", "array_index").replace(
+                    "(array_index)", f"({array_index})"
+                )
+
+        return vhdl
+
+
+def get_register_list(name: str, array_length: int = ARRAY_LENGTH) -> RegisterList:
+    register_list = RegisterList(name=name)
+
+    register_array = register_list.append_register_array(
+        name="channels", length=array_length, description=""
+    )
+
+    register = register_array.append_register(name="status", mode="r", description="")
+    register.append_bit_vector(name="count", description="", width=32, default_value="0" * 32)
+
+    register = register_array.append_register(name="config", mode="r_w", description="")
+    register.append_bit_vector(name="count", description="", width=32, default_value="0" * 32)
+
+    return register_list
+
+
+def generate_register_code(output_folder: Path) -> None:
+    for name, record_generator_class in [
+        ("looped", VhdlRecordPackageGenerator),
+        ("unrolled", UnrolledVhdlRecordPackageGenerator),
+    ]:
+        register_list = get_register_list(name=name)
+
+        VhdlRegisterPackageGenerator(
+            register_list=register_list, output_folder=output_folder
+        ).create_if_needed()
+
+        record_generator_class(
+            register_list=register_list, output_folder=output_folder
+        ).create_if_needed()
+
+
+def generate_throughput_register_code(array_length: int, output_folder: Path) -> None:
+    """
+    The register list has the same name for all array lengths, so that the same testbench can
+    be used.
+    """
+    register_list = get_register_list(name="throughput", array_length=array_length)
+
+    for generator_class in [
+        VhdlRegisterPackageGenerator,
+        VhdlRecordPackageGenerator,
+        VhdlSimulationReadWritePackageGenerator,
+        VhdlAxiLiteWrapperGenerator,
+    ]:
+        generator_class(register_list=register_list, output_folder=output_folder).create_if_needed()
+
+
+def get_throughput_result(array_length: int, tests: dict[str, Any]) -> dict[str, Any]:
+    """
+    Get the throughput result from the VUnit report of the tests in one library.
+    """
+    bus_time = tests["test_bus_transactions"].time - tests["test_elaboration"].time
+
+    delta_cycles = json.loads(
+        read_file(Path(tests["test_conversion_delta_cycles"].path) / "delta_cycles.json")
+    )
+
+    return {
+        "array_length": array_length,
+        "num_registers": 2 * array_length,
+        "elaboration_time": tests["test_elaboration"].time,
+        "num_transactions": NUM_TRANSACTIONS,
+        "transactions_per_second": NUM_TRANSACTIONS / bus_time if bus_time > 0 else None,
+        "conversion": delta_cycles,
+    }
+
+
+def print_record_conversion_result(tests: dict[str, Any]) -> None:
+    """
+    Print a table comparing the looped and unrolled record conversion functions.
+    """
+    print(
+        f"""
+Register array length {ARRAY_LENGTH}, {NUM_ITERATIONS} iterations.
+Execution time includes elaboration.
+--------------------------------------------------------------------------
+                           Test | Execution time | Relative (lower is better)
+--------------------------------+----------------+------------------------\
+"""
+    )
+
+    relative_baseline = None
+    for test_name, test_result in sorted(tests.items()):
+        if relative_baseline is None:
+            relative_baseline = test_result.time
+            relative = "1x (baseline)"
+        else:
+            relative = f"{test_result.time / relative_baseline:.2g}x"
+
+        print(f"{test_name.split('.')[-1]:>31} | {test_result.time:>12.3g} s | {relative}")
+
+
+def main() -> None:
+    vunit_out = create_directory(OUTPUT_FOLDER / "vunit_out", empty=False)
+    register_code_folder = create_directory(OUTPUT_FOLDER / "register_code", empty=False)
+
+    generate_register_code(output_folder=register_code_folder)
+
+    vunit_proj = VUnit.from_argv(
+        argv=["--minimal", "--num-threads", "1", "--output-path", str(vunit_out)]
+    )
+    vunit_proj.add_verification_components()
+    vunit_proj.add_vhdl_builtins()
+
+    library = vunit_proj.add_library(library_name="example")
+    library.add_source_file(SIMULATION_BENCHMARK_FOLDER / "tb_record_conversion_benchmark.vhd")
+
+    for vhd_file in register_code_folder.glob("*.vhd"):
+        library.add_source_file(vhd_file)
+
+    for array_length in THROUGHPUT_ARRAY_LENGTHS:
+        library_name = f"throughput_{array_length}"
+        library_code_folder = create_directory(register_code_folder / library_name, empty=False)
+        generate_throughput_register_code(
+            array_length=array_length, output_folder=library_code_folder
+        )
+
+        throughput_library = vunit_proj.add_library(library_name=library_name)
+        throughput_library.add_source_file(
+            SIMULATION_BENCHMARK_FOLDER / "tb_register_file_throughput_benchmark.vhd"
+        )
+        for vhd_file in library_code_folder.glob("*.vhd"):
+            throughput_library.add_source_file(vhd_file)
+
+        throughput_library.test_bench("tb_register_file_throughput_benchmark").set_generic(
+            "num_transactions", NUM_TRANSACTIONS
+        )
+        throughput_library.test_bench("tb_register_file_throughput_benchmark").set_generic(
+            "num_iterations", NUM_ITERATIONS
+        )
+
+    for module in get_hdl_modules():
+        vunit_library = vunit_proj.add_library(library_name=module.library_name)
+        for hdl_file in module.get_simulation_files(include_tests=False):
+            vunit_library.add_source_file(hdl_file.path)
+
+    library.test_bench("tb_record_conversion_benchmark").set_generic(
+        "num_iterations", NUM_ITERATIONS
+    )
+
+    def post_run(results: Any) -> None:
+        tests = results.get_report().tests
+
+        print_record_conversion_result(
+            tests={name: result for name, result in tests.items() if name.startswith("example.")}
+        )
+
+        throughput_results = []
+        for array_length in THROUGHPUT_ARRAY_LENGTHS:
+            prefix = f"throughput_{array_length}.tb_register_file_throughput_benchmark."
+            throughput_results.append(
+                get_throughput_result(
+                    array_length=array_length,
+                    tests={
+                        name[len(prefix) :]: result
+                        for name, result in tests.items()
+                        if name.startswith(prefix)
+                    },
+                )
+            )
+
+        report = json.dumps(
+            {
+                "hdl_registers_version": __version__,
+                "results": throughput_results,
+            },
+            indent=2,
+        )
+
+        create_file(OUTPUT_FOLDER / "throughput.json", report)
+        print(report)
+
+    try:
+        vunit_proj.main(post_run=post_run)
+    except SystemExit as exception:
+        assert exception.code == 0
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,111 @@
+-- -------------------------------------------------------------------------------------------------
+-- Copyright (c) Lukas Vik. All rights reserved.
+--
+-- This file is part of the hdl-registers project, an HDL register generator fast enough to run
+-- in real time.
+-- https://hdl-registers.com
+-- https://github.com/hdl-registers/hdl-registers
+-- -------------------------------------------------------------------------------------------------
+-- Benchmark the simulation performance of the record conversion functions in the generated
+-- register record package.
+-- The 'looped' packages are generated with the current generator, where register arrays are
+-- converted with a VHDL 'for' loop.
+-- The 'unrolled' packages are generated with one assignment per array element, which is how
+-- the generator used to work.
+-- The register lists are otherwise identical.
+--
+-- Each iteration changes one array element in each direction, which triggers a re-evaluation
+-- of the combinatorial conversion processes.
+-- -------------------------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library vunit_lib;
+context vunit_lib.vunit_context;
+
+library reg_file;
+use reg_file.reg_file_pkg.all;
+
+use work.looped_regs_pkg.all;
+use work.looped_register_record_pkg.all;
+use work.unrolled_regs_pkg.all;
+use work.unrolled_register_record_pkg.all;
+
+
+entity tb_record_conversion_benchmark is
+  generic (
+    num_iterations : positive;
+    runner_cfg : string
+  );
+end entity;
+
+architecture tb of tb_record_conversion_benchmark is
+
+  signal looped_regs_up : looped_regs_up_t := looped_regs_up_init;
+  signal looped_regs_down : looped_regs_down_t := looped_regs_down_init;
+  signal looped_regs_up_slv, looped_regs_down_slv : looped_regs_t := looped_regs_init;
+
+  signal unrolled_regs_up : unrolled_regs_up_t := unrolled_regs_up_init;
+  signal unrolled_regs_down : unrolled_regs_down_t := unrolled_regs_down_init;
+  signal unrolled_regs_up_slv, unrolled_regs_down_slv : unrolled_regs_t := unrolled_regs_init;
+
+begin
+
+  test_runner_watchdog(runner, 1 sec);
+
+
+  ------------------------------------------------------------------------------
+  main : process
+    variable array_index : natural := 0;
+    variable value : u_unsigned(32 - 1 downto 0) := (others => '0');
+  begin
+    test_runner_setup(runner, runner_cfg);
+
+    if run("test_looped") then
+      for iteration in 0 to num_iterations - 1 loop
+        array_index := iteration mod looped_channels_array_length;
+        value := to_unsigned(iteration, value'length);
+
+        looped_regs_up.channels(array_index).status.count <= value;
+        looped_regs_down_slv(looped_channels_config(array_index)) <= std_ulogic_vector(value);
+
+        wait for 1 ns;
+
+        check_equal(
+          looped_regs_up_slv(looped_channels_status(array_index)), std_ulogic_vector(value)
+        );
+        check_equal(looped_regs_down.channels(array_index).config.count, value);
+      end loop;
+
+    elsif run("test_unrolled") then
+      for iteration in 0 to num_iterations - 1 loop
+        array_index := iteration mod unrolled_channels_array_length;
+        value := to_unsigned(iteration, value'length);
+
+        unrolled_regs_up.channels(array_index).status.count <= value;
+        unrolled_regs_down_slv(unrolled_channels_config(array_index)) <= std_ulogic_vector(value);
+
+        wait for 1 ns;
+
+        check_equal(
+          unrolled_regs_up_slv(unrolled_channels_status(array_index)), std_ulogic_vector(value)
+        );
+        check_equal(unrolled_regs_down.channels(array_index).config.count, value);
+      end loop;
+
+    end if;
+
+    test_runner_cleanup(runner);
+  end process;
+
+
+  ------------------------------------------------------------------------------
+  looped_regs_up_slv <= to_slv(looped_regs_up);
+  looped_regs_down <= to_looped_regs_down(looped_regs_down_slv);
+
+  unrolled_regs_up_slv <= to_slv(unrolled_regs_up);
+  unrolled_regs_down <= to_unrolled_regs_down(unrolled_regs_down_slv);
+
+end architecture;
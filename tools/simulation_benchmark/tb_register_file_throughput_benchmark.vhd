@@ -0,0 +1,238 @@
+-- -------------------------------------------------------------------------------------------------
+-- Copyright (c) Lukas Vik. All rights reserved.
+--
+-- This file is part of the hdl-registers project, an HDL register generator fast enough to run
+-- in real time.
+-- https://hdl-registers.com
+-- https://github.com/hdl-registers/hdl-registers
+-- -------------------------------------------------------------------------------------------------
+-- Benchmark the simulation throughput of the generated register file, record conversion
+-- functions and read/write procedures.
+-- The 'throughput' register list is generated with a different register array length for each
+-- library that this testbench is compiled into.
+--
+-- The 'test_elaboration' test does nothing, and is used as a baseline for the wall-clock time
+-- of the other tests.
+-- The 'test_bus_transactions' test writes and reads registers with the generated procedures.
+-- The 'test_conversion_delta_cycles' test counts the delta cycles that the conversions inside the
+-- register file wrapper take, and writes the result to a file in the test output folder.
+-- Values are written and read over AXI-Lite, and the SLV side of the conversions is observed
+-- inside the wrapper with VHDL-2008 external names.
+-- -------------------------------------------------------------------------------------------------
+
+library ieee;
+use ieee.std_logic_1164.all;
+use ieee.numeric_std.all;
+
+library std;
+use std.textio.all;
+
+library vunit_lib;
+context vunit_lib.vc_context;
+context vunit_lib.vunit_context;
+
+library axi;
+use axi.axi_lite_pkg.all;
+
+library bfm;
+
+library reg_file;
+use reg_file.reg_file_pkg.all;
+use reg_file.reg_operations_pkg.all;
+
+use work.throughput_regs_pkg.all;
+use work.throughput_register_record_pkg.all;
+use work.throughput_register_read_write_pkg.all;
+
+
+entity tb_register_file_throughput_benchmark is
+  generic (
+    num_transactions : natural;
+    num_iterations : natural;
+    runner_cfg : string
+  );
+end entity;
+
+architecture tb of tb_register_file_throughput_benchmark is
+
+  constant clk_period : time := 10 ns;
+  signal clk : std_ulogic := '0';
+
+  signal axi_lite_m2s : axi_lite_m2s_t := axi_lite_m2s_init;
+  signal axi_lite_s2m : axi_lite_s2m_t := axi_lite_s2m_init;
+
+  signal regs_up : throughput_regs_up_t := throughput_regs_up_init;
+  signal regs_down : throughput_regs_down_t := throughput_regs_down_init;
+
+  signal num_conversion_events : natural := 0;
+
+begin
+
+  clk <= not clk after clk_period / 2;
+  test_runner_watchdog(runner, 1 sec);
+
+
+  ------------------------------------------------------------------------------
+  axi_lite_master_inst : entity bfm.axi_lite_master
+    port map (
+      clk => clk,
+      --
+      axi_lite_m2s => axi_lite_m2s,
+      axi_lite_s2m => axi_lite_s2m
+    );
+
+
+  ------------------------------------------------------------------------------
+  throughput_reg_file_inst : entity work.throughput_reg_file
+    port map(
+      clk => clk,
+      --
+      axi_lite_m2s => axi_lite_m2s,
+      axi_lite_s2m => axi_lite_s2m,
+      --
+      regs_up => regs_up,
+      regs_down => regs_down
+    );
+
+
+  ------------------------------------------------------------------------------
+  -- Placed after the instance, since an external name can only refer to an object that has
+  -- already been elaborated.
+  main : process
+    -- The SLV side of the conversions inside the register file wrapper.
+    alias dut_regs_up_slv is
+      << signal .tb_register_file_throughput_benchmark.throughput_reg_file_inst.regs_up_slv
+        : throughput_regs_t >>;
+    alias dut_regs_down_slv is
+      << signal .tb_register_file_throughput_benchmark.throughput_reg_file_inst.regs_down_slv
+        : throughput_regs_t >>;
+
+    procedure run_bus_transactions is
+      variable array_index : natural := 0;
+      variable value : u_unsigned(32 - 1 downto 0) := (others => '0');
+      variable config : throughput_channels_config_t := throughput_channels_config_init;
+      variable status : throughput_channels_status_t := throughput_channels_status_init;
+    begin
+      -- One write and one read in each iteration.
+      for iteration in 0 to num_transactions / 2 - 1 loop
+        array_index := iteration mod throughput_channels_array_length;
+        value := to_unsigned(iteration, value'length);
+
+        config.count := value;
+        write_throughput_channels_config(net=>net, array_index=>array_index, value=>config);
+
+        regs_up.channels(array_index).status.count <= value;
+        read_throughput_channels_status(net=>net, array_index=>array_index, value=>status);
+        check_equal(status.count, value);
+      end loop;
+
+      wait_until_idle(net, as_sync(regs_bus_master));
+      check_equal(regs_down.channels(array_index).config.count, value);
+    end procedure;
+
+    procedure run_conversions is
+      -- Upper limit, so that the test fails instead of hanging if a conversion never settles.
+      constant max_delta_cycles : positive := 1000;
+
+      variable array_index : natural := 0;
+      variable value : u_unsigned(32 - 1 downto 0) := (others => '0');
+      variable config : throughput_channels_config_t := throughput_channels_config_init;
+      variable status : throughput_channels_status_t := throughput_channels_status_init;
+      variable delta_cycles, total_delta_cycles, max_iteration_delta_cycles : natural := 0;
+
+      procedure add_delta_cycles is
+      begin
+        total_delta_cycles := total_delta_cycles + delta_cycles;
+        max_iteration_delta_cycles := maximum(max_iteration_delta_cycles, delta_cycles);
+      end procedure;
+
+      file result_file : text;
+      variable result_line : line;
+    begin
+      for iteration in 0 to num_iterations - 1 loop
+        array_index := iteration mod throughput_channels_array_length;
+        -- Each array index gets a new value in each iteration, so that every write is an event.
+        value := to_unsigned(iteration + 1, value'length);
+
+        -- Write over the bus, and count delta cycles from when the register file updates its
+        -- SLV output until the wrapper has converted it to the record.
+        config.count := value;
+        write_throughput_channels_config(net=>net, array_index=>array_index, value=>config);
+        wait until dut_regs_down_slv(throughput_channels_config(array_index))
+          = std_ulogic_vector(value);
+
+        delta_cycles := 0;
+        while regs_down.channels(array_index).config.count /= value loop
+          wait for 0 ns;
+          delta_cycles := delta_cycles + 1;
+          check_relation(delta_cycles < max_delta_cycles);
+        end loop;
+        add_delta_cycles;
+
+        -- Update the record, and count delta cycles until the wrapper has converted it to the SLV
+        -- input of the register file.
+        -- Then read it over the bus, to check the whole path.
+        regs_up.channels(array_index).status.count <= value;
+
+        delta_cycles := 0;
+        loop
+          wait for 0 ns;
+          delta_cycles := delta_cycles + 1;
+
+          exit when dut_regs_up_slv(throughput_channels_status(array_index))
+            = std_ulogic_vector(value);
+
+          check_relation(delta_cycles < max_delta_cycles);
+        end loop;
+        add_delta_cycles;
+
+        read_throughput_channels_status(net=>net, array_index=>array_index, value=>status);
+        check_equal(status.count, value);
+      end loop;
+
+      file_open(result_file, output_path(runner_cfg) & "delta_cycles.json", write_mode);
+
+      write(result_line, string'("{""num_iterations"": "));
+      write(result_line, num_iterations);
+      write(result_line, string'(", ""total_delta_cycles"": "));
+      write(result_line, total_delta_cycles);
+      write(result_line, string'(", ""max_delta_cycles"": "));
+      write(result_line, max_iteration_delta_cycles);
+      write(result_line, string'(", ""conversion_events"": "));
+      write(result_line, num_conversion_events);
+      write(result_line, string'("}"));
+      writeline(result_file, result_line);
+
+      file_close(result_file);
+    end procedure;
+  begin
+    test_runner_setup(runner, runner_cfg);
+
+    if run("test_elaboration") then
+      null;
+
+    elsif run("test_bus_transactions") then
+      run_bus_transactions;
+
+    elsif run("test_conversion_delta_cycles") then
+      run_conversions;
+
+    end if;
+
+    test_runner_cleanup(runner);
+  end process;
+
+
+  ------------------------------------------------------------------------------
+  -- Count the number of times that the outputs of the conversions in the wrapper are updated.
+  count_conversion_events : process
+    alias dut_regs_up_slv is
+      << signal .tb_register_file_throughput_benchmark.throughput_reg_file_inst.regs_up_slv
+        : throughput_regs_t >>;
+  begin
+    wait on dut_regs_up_slv, regs_down;
+
+    num_conversion_events <= num_conversion_events + 1;
+  end process;
+
+end architecture;
@@ -0,0 +1,284 @@
+# --------------------------------------------------------------------------------------------------
+# Copyright (c) Lukas Vik. All rights reserved.
+#
+# This file is part of the hdl-registers project, an HDL register generator fast enough to run
+# in real time.
+# https://hdl-registers.com
+# https://github.com/hdl-registers/hdl-registers
+# --------------------------------------------------------------------------------------------------
+
+"""
+Benchmark the resource usage and logic depth of the generated VHDL register file, using the
+open-source GHDL and yosys tools.
+Gives a quick indication of whether a generator change makes the register file bigger or slower,
+without running a full vendor build.
+
+The register file from :class:`.VhdlAxiLiteWrapperGenerator` is synthesized for register lists
+of increasing size.
+It instantiates the ``axi_lite_reg_file`` from hdl-modules and uses the packages from
+:class:`.VhdlRegisterPackageGenerator` and :class:`.VhdlRecordPackageGenerator`, so the result
+covers all three generators.
+
+Needs ``ghdl`` and ``yosys``, with the ``ghdl`` yosys plugin, in ``PATH``.
+Synthesis is done with the yosys ``synth_xilinx`` script, so the LUT and flip-flop counts are
+for a 6-input LUT architecture.
+The logic depth is the number of cells, e.g. LUTs and carry chain elements, on the longest path
+between flip-flops, as reported by the yosys ``ltp`` command.
+The result is printed as JSON.
+"""
+
+# Standard libraries
+import argparse
+import json
+import re
+import shutil
+import sys
+from pathlib import Path
+from typing import Any
+
+# Do PYTHONPATH insert() instead of append() to prefer any local repo checkout over any pip install
+REPO_ROOT = Path(__file__).parent.parent.resolve()
+sys.path.insert(0, str(REPO_ROOT))
+
+# Import before others since it modifies PYTHONPATH. pylint: disable=unused-import
+import tools.tools_pythonpath  # noqa: F401
+
+# Third party libraries
+from tsfpga.examples.example_env import get_hdl_modules
+from tsfpga.system_utils import create_directory, create_file, read_file, run_command
+
+# First party libraries
+from hdl_registers import HDL_REGISTERS_GENERATED, __version__
+from hdl_registers.generator.vhdl.axi_lite_wrapper import VhdlAxiLiteWrapperGenerator
+from hdl_registers.generator.vhdl.record_package import VhdlRecordPackageGenerator
+from hdl_registers.generator.vhdl.register_package import VhdlRegisterPackageGenerator
+from hdl_registers.register import REGISTER_MODES
+from hdl_registers.register_list import RegisterList
+
+OUTPUT_FOLDER = HDL_REGISTERS_GENERATED / "synthesis_benchmark"
+
+# Number of registers in each benchmarked register list.
+NUM_REGISTERS = [8, 64, 256]
+
+# VHDL library that the generated code is analyzed into.
+LIBRARY_NAME = "register_benchmark"
+
+
+def get_register_list(num_registers: int) -> RegisterList:
+    """
+    Registers of all modes, with one field of each type, are mixed in the same way as in a
+    typical register list.
+    Half of the registers are in a register array.
+    """
+    register_list = RegisterList(name=f"benchmark_{num_registers}")
+    modes = list(REGISTER_MODES)
+
+    num_plain_registers = num_registers // 2
+    for register_index in range(num_plain_registers):
+        register = register_list.append_register(
+            name=f"register_{register_index}",
+            mode=modes[register_index % len(modes)],
+            description="",
+        )
+        register.append_bit(name="enable", description="", default_value="0")
+        register.append_bit_vector(
+            name="level", description="", width=12, default_value="000000000000"
+        )
+        register.append_enumeration(
+            name="direction",
+            description="",
+            elements={"up": "", "down": "", "left": "", "right": ""},
+            default_value="up",
+        )
+        register.append_integer(
+            name="count", description="", min_value=0, max_value=1000, default_value=0
+        )
+
+    num_array_registers = num_registers - num_plain_registers
+    if num_array_registers:
+        register_array = register_list.append_register_array(
+            name="channels", length=num_array_registers // 2 or 1, description=""
+        )
+
+        register = register_array.append_register(name="config", mode="r_w", description="")
+        register.append_bit_vector(
+            name="gain", description="", width=16, default_value="0000000000000000"
+        )
+
+        register = register_array.append_register(name="status", mode="r", description="")
+        register.append_bit_vector(name="count", description="", width=32, default_value="0" * 32)
+
+    return register_list
+
+
+def generate_register_code(register_list: RegisterList, output_folder: Path) -> None:
+    for generator_class in [
+        VhdlRegisterPackageGenerator,
+        VhdlRecordPackageGenerator,
+        VhdlAxiLiteWrapperGenerator,
+    ]:
+        generator_class(register_list=register_list, output_folder=output_folder).create_if_needed()
+
+
+def import_hdl_modules(work_folder: Path) -> None:
+    """
+    Import, but do not analyze, the synthesis files of all hdl-modules.
+    Only the files that are needed by the register file are analyzed when elaborating.
+    """
+    for module in get_hdl_modules():
+        vhdl_files = [
+            str(hdl_file.path) for hdl_file in module.get_synthesis_files() if hdl_file.is_vhdl
+        ]
+        if vhdl_files:
+            run_ghdl(
+                command="-i",
+                library_name=module.library_name,
+                work_folder=work_folder,
+                arguments=vhdl_files,
+            )
+
+
+def run_ghdl(command: str, library_name: str, work_folder: Path, arguments: list[str]) -> None:
+    run_command(
+        [
+            "ghdl",
+            command,
+            "--std=08",
+            f"--work={library_name}",
+            f"--workdir={work_folder}",
+            f"-P{work_folder}",
+        ]
+        + arguments
+    )
+
+
+def synthesize(
+    register_list: RegisterList, work_folder: Path, output_folder: Path
+) -> dict[str, Any]:
+    """
+    Synthesize the register file of the register list, and return the resource usage
+    and logic depth.
+    """
+    register_code_folder = create_directory(output_folder / "register_code", empty=True)
+    generate_register_code(register_list=register_list, output_folder=register_code_folder)
+
+    top = f"{register_list.name}_reg_file"
+
+    run_ghdl(
+        command="-i",
+        library_name=LIBRARY_NAME,
+        work_folder=work_folder,
+        arguments=[str(path) for path in register_code_folder.glob("*.vhd")],
+    )
+    # Analyze the register file and everything it depends on, in the correct order.
+    run_ghdl(command="-m", library_name=LIBRARY_NAME, work_folder=work_folder, arguments=[top])
+
+    stat_file = output_folder / "stat.json"
+    log_file = output_folder / "yosys.log"
+    script = "; ".join(
+        [
+            f"ghdl --std=08 --work={LIBRARY_NAME} --workdir={work_folder} -P{work_folder} {top}",
+            f"synth_xilinx -flatten -top {top}",
+            f"tee -q -o {stat_file} stat -json",
+            # After 'synth_xilinx' the flip-flops are Xilinx 'FD*' cells, which the '-noff' option
+            # does not recognize.
+            # Leave them out of the selection instead, so that paths start and end at flip-flops.
+            "ltp -noff t:* t:FD* %d",
+        ]
+    )
+    run_command(["yosys", "-m", "ghdl", "-q", "-l", str(log_file), "-p", script])
+
+    return get_result(stat=json.loads(read_file(stat_file)), log=read_file(log_file))
+
+
+def get_result(stat: dict[str, Any], log: str) -> dict[str, Any]:
+    """
+    Get the result from the yosys 'stat -json' output and the log of the 'ltp' command.
+    """
+    # The design is flattened, so there is only one module.
+    (module_stat,) = stat["modules"].values()
+    cells = module_stat["num_cells_by_type"]
+
+    match = re.search(r"Longest topological path in .+ \(length=(\d+)\)", log)
+    if match is None:
+        raise ValueError("Could not find the logic depth in the yosys log.")
+
+    return {
+        "luts": sum(count for cell, count in cells.items() if cell.startswith("LUT")),
+        "flip_flops": sum(count for cell, count in cells.items() if cell.startswith("FD")),
+        # Number of cells on the longest combinational path between flip-flops (or ports).
+        "logic_depth": int(match.group(1)),
+        "cells": dict(sorted(cells.items())),
+    }
+
+
+def get_tool_version(command: list[str]) -> str:
+    return run_command(command, capture_output=True).stdout.split("\n")[0].strip()
+
+
+def arguments() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(
+        "Benchmark the synthesis result of the generated VHDL register file",
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+    )
+
+    parser.add_argument(
+        "--num-registers",
+        type=int,
+        nargs="+",
+        default=NUM_REGISTERS,
+        help="number of registers in each benchmarked register list",
+    )
+    parser.add_argument(
+        "--output-file",
+        type=Path,
+        default=OUTPUT_FOLDER / "result.json",
+        help="the JSON result is written to this file, in addition to being printed",
+    )
+
+    return parser.parse_args()
+
+
+def main() -> None:
+    args = arguments()
+
+    for tool in ["ghdl", "yosys"]:
+        if shutil.which(tool) is None:
+            sys.exit(f"Could not find '{tool}' in PATH.")
+
+    work_folder = create_directory(OUTPUT_FOLDER / "ghdl", empty=True)
+    import_hdl_modules(work_folder=work_folder)
+
+    results = []
+    for num_registers in args.num_registers:
+        register_list = get_register_list(num_registers=num_registers)
+        output_folder = create_directory(OUTPUT_FOLDER / register_list.name, empty=True)
+
+        result = synthesize(
+            register_list=register_list, work_folder=work_folder, output_folder=output_folder
+        )
+        results.append(
+            {
+                "name": register_list.name,
+                "num_registers": num_registers,
+                "num_register_indexes": register_list.register_objects[-1].index + 1,
+                **result,
+            }
+        )
+
+    report = json.dumps(
+        {
+            "hdl_registers_version": __version__,
+            "ghdl_version": get_tool_version(["ghdl", "--version"]),
+            "yosys_version": get_tool_version(["yosys", "-V"]),
+            "results": results,
+        },
+        indent=2,
+    )
+
+    create_file(args.output_file, report)
+    print(report)
+
+
+if __name__ == "__main__":
+    main()